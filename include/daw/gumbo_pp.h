@@ -9,9 +9,28 @@
 #pragma once
 
 #include "gumbo_pp/details/gumbo_pp.h"
+#include "gumbo_pp/gumbo_arena.h"
+#include "gumbo_pp/gumbo_class_index.h"
+#include "gumbo_pp/gumbo_content_text_index.h"
+#include "gumbo_pp/gumbo_css.h"
+#include "gumbo_pp/gumbo_document_cache.h"
+#include "gumbo_pp/gumbo_encoding.h"
+#include "gumbo_pp/gumbo_entities.h"
+#include "gumbo_pp/gumbo_flat_document.h"
 #include "gumbo_pp/gumbo_handle.h"
+#include "gumbo_pp/gumbo_id_index.h"
+#include "gumbo_pp/gumbo_interner.h"
+#include "gumbo_pp/gumbo_keyword_set.h"
+#include "gumbo_pp/gumbo_match_many.h"
+#include "gumbo_pp/gumbo_matcher_compiler.h"
 #include "gumbo_pp/gumbo_matchers.h"
 #include "gumbo_pp/gumbo_node_iterator.h"
+#include "gumbo_pp/gumbo_parse_context.h"
+#include "gumbo_pp/gumbo_parse_many.h"
+#include "gumbo_pp/gumbo_selector.h"
+#include "gumbo_pp/gumbo_snapshot.h"
+#include "gumbo_pp/gumbo_source_span_map.h"
+#include "gumbo_pp/gumbo_tag_index.h"
 #include "gumbo_pp/gumbo_text.h"
 #include "gumbo_pp/gumbo_util.h"
 #include "gumbo_pp/gumbo_vector_iterator.h"
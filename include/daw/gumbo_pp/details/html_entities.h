@@ -0,0 +1,33 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "gumbo_pp.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace daw::gumbo::entity_details {
+	inline constexpr std::size_t max_entity_name_size = 31U;
+
+	struct html_entity {
+		std::uint16_t name_offset;
+		std::uint8_t name_size;
+		std::uint8_t utf8_size;
+		// Also recognized without the terminating ;, like &amp
+		bool legacy;
+		char utf8[7];
+	};
+
+	/// The named character reference, without the & and ;, or nullptr
+	[[nodiscard]] html_entity const *
+	find_html_entity( daw::string_view name ) noexcept;
+} // namespace daw::gumbo::entity_details
@@ -0,0 +1,96 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+
+#include <cstddef>
+#include <gumbo.h>
+
+namespace daw::gumbo {
+	/// A monotonic allocator that can be plugged into GumboOptions.  Gumbo's
+	/// individual deallocations are ignored and all memory is reclaimed at once
+	/// when the last GumboOutput parsed into the arena is destroyed, or reset( )
+	/// is called.  The blocks are kept so that parsing further documents with the
+	/// same arena does not call the system allocator once it has warmed up.
+	/// The arena must outlive all outputs parsed into it.
+	class gumbo_arena {
+		struct block_t;
+		block_t *m_first = nullptr;
+		block_t *m_current = nullptr;
+		std::size_t m_block_size;
+		std::size_t m_live_outputs = 0;
+		std::size_t m_max_retained = static_cast<std::size_t>( -1 );
+
+		block_t *add_block( std::size_t min_capacity ) noexcept;
+
+	public:
+		static constexpr std::size_t default_block_size = 64U * 1024U;
+
+		explicit gumbo_arena(
+		  std::size_t block_size = default_block_size ) noexcept;
+		~gumbo_arena( );
+
+		gumbo_arena( gumbo_arena const & ) = delete;
+		gumbo_arena &operator=( gumbo_arena const & ) = delete;
+		// Outputs hold a pointer to their arena, it cannot be moved
+		gumbo_arena( gumbo_arena && ) = delete;
+		gumbo_arena &operator=( gumbo_arena && ) = delete;
+
+		/// Allocate size bytes aligned for any type.  Returns nullptr when the
+		/// system allocator fails, like malloc does
+		[[nodiscard]] void *allocate( std::size_t size ) noexcept;
+
+		/// Make all memory available again, keeping the blocks allocated.  Any
+		/// output still parsed into the arena is invalidated
+		void reset( ) noexcept;
+
+		/// Return all blocks to the system allocator
+		void release( ) noexcept;
+
+		/// Ensure at least capacity bytes are held in blocks and touch them so
+		/// that the first document parsed does not page fault on them
+		void reserve( std::size_t capacity ) noexcept;
+
+		/// Free blocks until at most max_capacity bytes are retained.  Only valid
+		/// when there are no live outputs
+		void shrink_to( std::size_t max_capacity ) noexcept;
+
+		/// The capacity the arena shrinks to when the last output is destroyed.
+		/// Keeps a single large document from pinning memory forever
+		[[nodiscard]] constexpr std::size_t max_retained( ) const noexcept {
+			return m_max_retained;
+		}
+
+		constexpr void set_max_retained( std::size_t max_capacity ) noexcept {
+			m_max_retained = max_capacity;
+		}
+
+		/// Total bytes held in blocks
+		[[nodiscard]] std::size_t capacity( ) const noexcept;
+
+		/// Bytes handed out since the last reset
+		[[nodiscard]] std::size_t size( ) const noexcept;
+
+		/// Number of outputs currently parsed into the arena
+		[[nodiscard]] constexpr std::size_t live_outputs( ) const noexcept {
+			return m_live_outputs;
+		}
+
+		/// Returns a copy of opts with the allocator hooks pointing to this arena
+		[[nodiscard]] GumboOptions
+		options( GumboOptions opts = kGumboDefaultOptions ) noexcept;
+
+		/// Called when an output is parsed into/destroyed from the arena.  When
+		/// the last output is destroyed the arena is reset and shrunk to
+		/// max_retained( )
+		void add_output( ) noexcept;
+		void remove_output( ) noexcept;
+	};
+} // namespace daw::gumbo
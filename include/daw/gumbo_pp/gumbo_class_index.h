@@ -0,0 +1,66 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_node_iterator.h"
+#include "gumbo_tag_index.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace daw::gumbo {
+	/// For each class token in a document, the elements that have it in their
+	/// class list in document order.  Each distinct token is stored once, as a
+	/// view of the first attribute value it was seen in, so the range indexed
+	/// must outlive the index
+	class class_index {
+		std::unordered_map<std::string_view, std::vector<tag_index_entry>>
+		  m_classes{ };
+
+	public:
+		explicit class_index( gumbo_range const &rng );
+		class_index( gumbo_node_iterator_t first, gumbo_node_iterator_t last );
+
+		/// The elements with the class token, in document order
+		[[nodiscard]] std::vector<tag_index_entry> const &
+		entries( daw::string_view class_name ) const;
+
+		/// The elements that have any of the class tokens, in document order.
+		/// Elements with more than one of them are only visited once
+		template<typename... StringView>
+		[[nodiscard]] tag_index_range<1U + sizeof...( StringView )>
+		find( daw::string_view class_name, StringView &&...class_names ) const {
+			return find_impl( entries( class_name ), entries( class_names )... );
+		}
+
+		/// The number of elements with the class token
+		[[nodiscard]] inline std::size_t
+		count( daw::string_view class_name ) const {
+			return entries( class_name ).size( );
+		}
+
+		/// The number of distinct class tokens in the document
+		[[nodiscard]] inline std::size_t size( ) const noexcept {
+			return m_classes.size( );
+		}
+
+	private:
+		template<typename... Lists>
+		[[nodiscard]] static tag_index_range<sizeof...( Lists )>
+		find_impl( Lists const &...lists ) {
+			return tag_index_range<sizeof...( Lists )>(
+			  { lists.data( )... }, { ( lists.data( ) + lists.size( ) )... } );
+		}
+	};
+} // namespace daw::gumbo
@@ -0,0 +1,73 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_node_iterator.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+#include <string>
+#include <unordered_map>
+
+namespace daw::gumbo {
+	/// The content text of every node of a document, precomputed in one pass.
+	/// The text of all nodes is concatenated in document order into a single
+	/// buffer, so the content text of any node is a contiguous slice of it and
+	/// looking it up neither copies nor allocates.  The range indexed must
+	/// outlive the index
+	class content_text_index {
+		struct span_t {
+			std::uint32_t first;
+			std::uint32_t last;
+		};
+
+		std::string m_text{ };
+		std::unordered_map<GumboNode const *, span_t> m_spans{ };
+
+	public:
+		/// Index the whole document, including the document node
+		explicit content_text_index( gumbo_range const &rng );
+
+		/// Index node and its descendants
+		explicit content_text_index( GumboNode const &node );
+
+		/// Is the node part of the index
+		[[nodiscard]] inline bool contains( GumboNode const &node ) const {
+			return m_spans.find( &node ) != m_spans.end( );
+		}
+
+		/// The content text of node, the same as node_content_text( node ).
+		/// Nodes that are not part of the index have no text
+		[[nodiscard]] inline daw::string_view
+		text( GumboNode const &node ) const {
+			auto pos = m_spans.find( &node );
+			assert( pos != m_spans.end( ) );
+			if( pos == m_spans.end( ) ) {
+				return { };
+			}
+			return daw::string_view( m_text.data( ) + pos->second.first,
+			                         pos->second.last - pos->second.first );
+		}
+
+		/// The text of all the nodes indexed
+		[[nodiscard]] inline daw::string_view text( ) const noexcept {
+			return daw::string_view( m_text.data( ), m_text.size( ) );
+		}
+
+		/// Number of nodes indexed
+		[[nodiscard]] inline std::size_t size( ) const noexcept {
+			return m_spans.size( );
+		}
+	};
+} // namespace daw::gumbo
@@ -0,0 +1,636 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "details/tag_names.h"
+#include "gumbo_matchers.h"
+#include "gumbo_selector.h"
+#include "gumbo_util.h"
+
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <cstddef>
+#include <gumbo.h>
+#include <utility>
+
+namespace daw::gumbo {
+	namespace css_details {
+		/// Why a selector given to match::css or DAW_GUMBO_CSS was rejected.  It
+		/// is reported, with the offset into the selector, by the failing
+		/// static_assert in invalid_css_selector
+		enum class css_error : unsigned char {
+			none,
+			expected_selector,
+			expected_identifier,
+			expected_closing_bracket,
+			expected_closing_paren,
+			unterminated_string,
+			unknown_tag,
+			unsupported_escape,
+			unsupported_attribute_flag,
+			empty_attribute_value,
+			unsupported_pseudo_class,
+			pseudo_elements_not_supported,
+			combinators_not_supported
+		};
+
+		enum class simple_kind : unsigned char {
+			tag,
+			any_element,
+			id,
+			class_name,
+			attribute,
+			is,
+			not_
+		};
+
+		inline constexpr std::size_t css_npos = static_cast<std::size_t>( -1 );
+
+		struct css_range {
+			std::size_t first = 0;
+			std::size_t size = 0;
+		};
+
+		/// A simple selector.  The simple selectors of a compound are linked by
+		/// next, as those of a nested :not( ) are parsed between them
+		struct css_simple {
+			simple_kind kind = simple_kind::any_element;
+			selector_details::attribute_op op =
+			  selector_details::attribute_op::exists;
+			GumboTag tag = GUMBO_TAG_UNKNOWN;
+			css_range name{ };
+			css_range value{ };
+			// The selector list of :is( ) and :not( )
+			std::size_t list = 0;
+			std::size_t next = css_npos;
+		};
+
+		struct css_compound {
+			std::size_t first = css_npos;
+			std::size_t size = 0;
+			std::size_t next = css_npos;
+		};
+
+		struct css_list {
+			std::size_t first = css_npos;
+			std::size_t size = 0;
+		};
+
+		/// A selector parsed at compile time.  Each simple selector takes at
+		/// least a character of the selector, so no table holds more than
+		/// SelectorSize entries.  chars holds the names and values, unescaped
+		template<std::size_t SelectorSize>
+		struct css_program {
+			std::array<char, SelectorSize + 1> chars{ };
+			std::size_t char_count = 0;
+			std::array<css_simple, SelectorSize + 1> simples{ };
+			std::size_t simple_count = 0;
+			std::array<css_compound, SelectorSize + 1> compounds{ };
+			std::size_t compound_count = 0;
+			std::array<css_list, SelectorSize + 1> lists{ };
+			std::size_t list_count = 0;
+			css_error error = css_error::none;
+			std::size_t error_position = 0;
+
+			constexpr daw::string_view text( css_range r ) const {
+				return daw::string_view( chars.data( ) + r.first, r.size );
+			}
+
+			constexpr std::size_t nth_simple( std::size_t compound,
+			                                  std::size_t n ) const {
+				auto result = compounds[compound].first;
+				while( n-- > 0 ) {
+					result = simples[result].next;
+				}
+				return result;
+			}
+
+			constexpr std::size_t nth_compound( std::size_t list,
+			                                    std::size_t n ) const {
+				auto result = lists[list].first;
+				while( n-- > 0 ) {
+					result = compounds[result].next;
+				}
+				return result;
+			}
+		};
+
+		constexpr bool is_css_space( char c ) noexcept {
+			return c == ' ' or c == '\t' or c == '\n' or c == '\r' or c == '\f';
+		}
+
+		constexpr bool is_hex_digit( char c ) noexcept {
+			return ( c >= '0' and c <= '9' ) or ( c >= 'a' and c <= 'f' ) or
+			       ( c >= 'A' and c <= 'F' );
+		}
+
+		constexpr bool is_ident_start( char c ) noexcept {
+			return ( c >= 'a' and c <= 'z' ) or ( c >= 'A' and c <= 'Z' ) or
+			       c == '_' or c == '-' or c == '\\' or
+			       static_cast<unsigned char>( c ) >= 0x80U;
+		}
+
+		constexpr bool is_ident_char( char c ) noexcept {
+			return is_ident_start( c ) or ( c >= '0' and c <= '9' );
+		}
+
+		constexpr bool starts_selector( char c ) noexcept {
+			return is_ident_start( c ) or c == '*' or c == '#' or c == '.' or
+			       c == '[' or c == ':' or c == '>' or c == '+' or c == '~';
+		}
+
+		/// Parses the same grammar as css_selector without combinators, into a
+		/// program that build_selector turns into matcher types
+		template<std::size_t SelectorSize>
+		struct css_parser {
+			daw::string_view m_selector;
+			std::size_t m_pos = 0;
+			css_program<SelectorSize> m_program{ };
+
+			constexpr bool failed( ) const {
+				return m_program.error != css_error::none;
+			}
+
+			constexpr void fail( css_error error, std::size_t position ) {
+				if( not failed( ) ) {
+					m_program.error = error;
+					m_program.error_position = position;
+				}
+			}
+
+			constexpr bool at_end( ) const {
+				return m_pos >= m_selector.size( );
+			}
+
+			constexpr char peek( ) const {
+				return at_end( ) ? '\0' : m_selector[m_pos];
+			}
+
+			constexpr void skip_space( ) {
+				while( not at_end( ) and is_css_space( m_selector[m_pos] ) ) {
+					++m_pos;
+				}
+			}
+
+			constexpr void append( char c, bool lower ) {
+				m_program.chars[m_program.char_count++] =
+				  lower ? tag_details::ascii_lower( c ) : c;
+			}
+
+			/// Append the escaped character following a backslash
+			constexpr void escape( bool lower ) {
+				auto const start = m_pos++;
+				if( at_end( ) or is_hex_digit( peek( ) ) ) {
+					fail( css_error::unsupported_escape, start );
+					return;
+				}
+				append( m_selector[m_pos++], lower );
+			}
+
+			constexpr css_range identifier( bool lower ) {
+				css_range result{ m_program.char_count, 0 };
+				if( not is_ident_start( peek( ) ) ) {
+					fail( css_error::expected_identifier, m_pos );
+					return result;
+				}
+				while( not at_end( ) and is_ident_char( peek( ) ) and not failed( ) ) {
+					if( peek( ) == '\\' ) {
+						escape( lower );
+					} else {
+						append( m_selector[m_pos++], lower );
+					}
+				}
+				result.size = m_program.char_count - result.first;
+				return result;
+			}
+
+			constexpr css_range quoted_string( ) {
+				auto const start = m_pos;
+				char const quote = m_selector[m_pos++];
+				css_range result{ m_program.char_count, 0 };
+				while( not failed( ) ) {
+					if( at_end( ) ) {
+						fail( css_error::unterminated_string, start );
+						break;
+					}
+					if( peek( ) == quote ) {
+						++m_pos;
+						break;
+					}
+					if( peek( ) == '\\' ) {
+						escape( false );
+					} else {
+						append( m_selector[m_pos++], false );
+					}
+				}
+				result.size = m_program.char_count - result.first;
+				return result;
+			}
+
+			constexpr std::size_t add_simple( css_simple simple ) {
+				m_program.simples[m_program.simple_count] = simple;
+				return m_program.simple_count++;
+			}
+
+			constexpr void attribute( css_simple &simple ) {
+				using selector_details::attribute_op;
+				simple.kind = simple_kind::attribute;
+				++m_pos;
+				skip_space( );
+				simple.name = identifier( true );
+				skip_space( );
+				if( failed( ) or peek( ) == ']' ) {
+					++m_pos;
+					return;
+				}
+				auto const op_pos = m_pos;
+				switch( peek( ) ) {
+				case '=':
+					simple.op = attribute_op::equals;
+					break;
+				case '~':
+					simple.op = attribute_op::includes;
+					break;
+				case '|':
+					simple.op = attribute_op::dash_match;
+					break;
+				case '^':
+					simple.op = attribute_op::prefix;
+					break;
+				case '$':
+					simple.op = attribute_op::suffix;
+					break;
+				case '*':
+					simple.op = attribute_op::substring;
+					break;
+				default:
+					fail( css_error::expected_closing_bracket, m_pos );
+					return;
+				}
+				++m_pos;
+				if( simple.op != attribute_op::equals ) {
+					if( peek( ) != '=' ) {
+						fail( css_error::expected_closing_bracket, op_pos );
+						return;
+					}
+					++m_pos;
+				}
+				skip_space( );
+				auto const value_pos = m_pos;
+				if( peek( ) == '"' or peek( ) == '\'' ) {
+					simple.value = quoted_string( );
+				} else {
+					simple.value = identifier( false );
+				}
+				// These match nothing in CSS, where a hand written matcher matches
+				// every value
+				if( simple.value.size == 0 and simple.op != attribute_op::equals and
+				    simple.op != attribute_op::dash_match ) {
+					fail( css_error::empty_attribute_value, value_pos );
+				}
+				skip_space( );
+				if( is_ident_start( peek( ) ) ) {
+					// The s flag is the default
+					if( tag_details::ascii_lower( peek( ) ) != 's' ) {
+						fail( css_error::unsupported_attribute_flag, m_pos );
+						return;
+					}
+					++m_pos;
+					skip_space( );
+				}
+				if( peek( ) != ']' ) {
+					fail( css_error::expected_closing_bracket, m_pos );
+					return;
+				}
+				++m_pos;
+			}
+
+			constexpr void pseudo_class( css_simple &simple ) {
+				++m_pos;
+				if( peek( ) == ':' ) {
+					fail( css_error::pseudo_elements_not_supported, m_pos );
+					return;
+				}
+				auto const name_pos = m_pos;
+				auto const name = m_program.text( identifier( true ) );
+				if( failed( ) ) {
+					return;
+				}
+				if( name == "not" ) {
+					simple.kind = simple_kind::not_;
+				} else if( name == "is" or name == "where" ) {
+					simple.kind = simple_kind::is;
+				} else {
+					fail( css_error::unsupported_pseudo_class, name_pos );
+					return;
+				}
+				if( peek( ) != '(' ) {
+					fail( css_error::unsupported_pseudo_class, name_pos );
+					return;
+				}
+				++m_pos;
+				simple.list = selector_list( );
+				if( failed( ) ) {
+					return;
+				}
+				if( peek( ) != ')' ) {
+					end_of_compound( css_error::expected_closing_paren );
+					return;
+				}
+				++m_pos;
+			}
+
+			/// Something other than end follows a selector, report a combinator
+			/// if that is what it is
+			constexpr void end_of_compound( css_error otherwise ) {
+				fail( starts_selector( peek( ) ) ? css_error::combinators_not_supported
+				                                 : otherwise,
+				      m_pos );
+			}
+
+			constexpr std::size_t compound( ) {
+				auto const start = m_pos;
+				std::size_t last = css_npos;
+				css_compound result{ };
+				bool has_tag = false;
+				bool has_not = false;
+				auto const link = [&]( std::size_t simple ) {
+					if( last == css_npos ) {
+						result.first = simple;
+					} else {
+						m_program.simples[last].next = simple;
+					}
+					last = simple;
+					++result.size;
+				};
+				bool has_universal = false;
+				if( peek( ) == '*' ) {
+					has_universal = true;
+					++m_pos;
+				} else if( is_ident_start( peek( ) ) ) {
+					auto const name_pos = m_pos;
+					auto const name = m_program.text( identifier( true ) );
+					auto const tag = tag_details::find_tag( name );
+					if( not failed( ) and tag == GUMBO_TAG_UNKNOWN ) {
+						fail( css_error::unknown_tag, name_pos );
+					}
+					css_simple simple{ };
+					simple.kind = simple_kind::tag;
+					simple.tag = tag;
+					link( add_simple( simple ) );
+					has_tag = true;
+				}
+				while( not failed( ) ) {
+					css_simple simple{ };
+					auto const c = peek( );
+					if( c == '#' or c == '.' ) {
+						++m_pos;
+						simple.kind = c == '#' ? simple_kind::id : simple_kind::class_name;
+						simple.value = identifier( false );
+					} else if( c == '[' ) {
+						attribute( simple );
+					} else if( c == ':' ) {
+						pseudo_class( simple );
+						has_not = has_not or simple.kind == simple_kind::not_;
+					} else {
+						break;
+					}
+					link( add_simple( simple ) );
+				}
+				if( failed( ) ) {
+					return 0;
+				}
+				if( result.size == 0 and not has_universal ) {
+					fail( css_error::expected_selector, start );
+					return 0;
+				}
+				// A lone :not( ) would match the text nodes too
+				if( not has_tag and ( result.size == 0 or has_not ) ) {
+					auto const any = add_simple( css_simple{ } );
+					m_program.simples[any].next = result.first;
+					result.first = any;
+					++result.size;
+				}
+				m_program.compounds[m_program.compound_count] = result;
+				return m_program.compound_count++;
+			}
+
+			constexpr std::size_t selector_list( ) {
+				auto const list = m_program.list_count++;
+				std::size_t last = css_npos;
+				while( not failed( ) ) {
+					skip_space( );
+					auto const c = compound( );
+					if( failed( ) ) {
+						break;
+					}
+					if( last == css_npos ) {
+						m_program.lists[list].first = c;
+					} else {
+						m_program.compounds[last].next = c;
+					}
+					last = c;
+					++m_program.lists[list].size;
+					skip_space( );
+					if( peek( ) != ',' ) {
+						break;
+					}
+					++m_pos;
+				}
+				return list;
+			}
+
+			constexpr css_program<SelectorSize> parse( ) {
+				(void)selector_list( );
+				if( not failed( ) and not at_end( ) ) {
+					end_of_compound( css_error::expected_selector );
+				}
+				return m_program;
+			}
+		};
+
+		template<std::size_t SelectorSize>
+		constexpr css_program<SelectorSize> parse_css( daw::string_view selector ) {
+			return css_parser<SelectorSize>{ selector }.parse( );
+		}
+
+		/// Source is a type whose static value( ) returns the selector
+		template<typename Source>
+		inline constexpr auto css_program_v =
+		  parse_css<Source::value( ).size( )>( Source::value( ) );
+
+		/// Fails to compile with the error and the offset into the selector
+		/// where parsing stopped
+		template<css_error Error, std::size_t Position>
+		struct invalid_css_selector {
+			static_assert( Error == css_error::none,
+			               "Invalid CSS selector, see the css_error and position "
+			               "given to invalid_css_selector" );
+		};
+
+		/// Elements of any tag, for * and compounds like :not( .a ).  As with
+		/// css_selector, a <template> is an element
+		struct any_element {
+			static constexpr matcher_cost cost = matcher_cost::tag;
+
+			constexpr bool operator( )( GumboNode const &node ) const noexcept {
+				return node.type == GUMBO_NODE_ELEMENT or
+				       node.type == GUMBO_NODE_TEMPLATE;
+			}
+		};
+
+		/// The predicate of [name~=value]
+		struct attribute_token_is {
+			daw::string_view m_name;
+			daw::string_view m_token;
+
+			constexpr bool operator( )( daw::string_view name,
+			                            daw::string_view value ) const {
+				return name == m_name and class_list_contains( value, m_token );
+			}
+		};
+
+		template<typename Source, std::size_t List>
+		constexpr auto build_list( );
+
+		template<typename Source, std::size_t Simple>
+		constexpr auto build_simple( ) {
+			using selector_details::attribute_op;
+			namespace attribute = match_details::match_attribute;
+			constexpr auto const &program = css_program_v<Source>;
+			constexpr css_simple simple = program.simples[Simple];
+			constexpr auto name = program.text( simple.name );
+			constexpr auto value = program.text( simple.value );
+			if constexpr( simple.kind == simple_kind::tag ) {
+				return match_details::match_tag::types_t<simple.tag>{ };
+			} else if constexpr( simple.kind == simple_kind::any_element ) {
+				return any_element{ };
+			} else if constexpr( simple.kind == simple_kind::id ) {
+				return match_details::match_id::is( value );
+			} else if constexpr( simple.kind == simple_kind::class_name ) {
+				return match_details::match_class::has( value );
+			} else if constexpr( simple.kind == simple_kind::is ) {
+				return build_list<Source, simple.list>( );
+			} else if constexpr( simple.kind == simple_kind::not_ ) {
+				return match_not{ build_list<Source, simple.list>( ) };
+			} else if constexpr( simple.op == attribute_op::exists ) {
+				return attribute::exists( name );
+			} else if constexpr( simple.op == attribute_op::equals ) {
+				return attribute::value::is( name, value );
+			} else if constexpr( simple.op == attribute_op::includes ) {
+				return attribute::where( attribute_token_is{ name, value } );
+			} else if constexpr( simple.op == attribute_op::dash_match ) {
+				return attribute::value::contains_prefix( name, value );
+			} else if constexpr( simple.op == attribute_op::prefix ) {
+				return attribute::value::starts_with( name, value );
+			} else if constexpr( simple.op == attribute_op::suffix ) {
+				return attribute::value::ends_with( name, value );
+			} else {
+				return attribute::value::contains( name, value );
+			}
+		}
+
+		template<typename Source, std::size_t Compound, std::size_t... Is>
+		constexpr auto build_compound( std::index_sequence<Is...> ) {
+			constexpr auto const &program = css_program_v<Source>;
+			if constexpr( sizeof...( Is ) == 1 ) {
+				return build_simple<Source, program.nth_simple( Compound, 0 )>( );
+			} else {
+				return match_all{
+				  build_simple<Source, program.nth_simple( Compound, Is )>( )... };
+			}
+		}
+
+		template<typename Source, std::size_t List, std::size_t... Is>
+		constexpr auto build_list( std::index_sequence<Is...> ) {
+			constexpr auto const &program = css_program_v<Source>;
+			if constexpr( sizeof...( Is ) == 1 ) {
+				constexpr auto compound = program.nth_compound( List, 0 );
+				return build_compound<Source, compound>(
+				  std::make_index_sequence<program.compounds[compound].size>{ } );
+			} else {
+				return match_any{ build_compound<Source,
+				                                 program.nth_compound( List, Is )>(
+				  std::make_index_sequence<
+				    program.compounds[program.nth_compound( List, Is )].size>{ } )... };
+			}
+		}
+
+		template<typename Source, std::size_t List>
+		constexpr auto build_list( ) {
+			return build_list<Source, List>(
+			  std::make_index_sequence<css_program_v<Source>.lists[List].size>{ } );
+		}
+
+		/// The matcher of the selector returned by Source::value( )
+		template<typename Source>
+		constexpr auto build_selector( ) {
+			constexpr auto const &program = css_program_v<Source>;
+			if constexpr( program.error != css_error::none ) {
+				(void)invalid_css_selector<program.error, program.error_position>{ };
+				return any_element{ };
+			} else {
+				return build_list<Source, 0>( );
+			}
+		}
+
+#if defined( __cpp_nontype_template_args ) and \
+  __cpp_nontype_template_args >= 201911L
+		template<std::size_t Size>
+		struct fixed_string {
+			char m_data[Size]{ };
+
+			constexpr fixed_string( char const ( &str )[Size] ) {
+				for( std::size_t n = 0; n < Size; ++n ) {
+					m_data[n] = str[n];
+				}
+			}
+		};
+
+		template<fixed_string Selector>
+		struct fixed_source {
+			static constexpr daw::string_view value( ) {
+				return daw::string_view( Selector.m_data,
+				                         sizeof( Selector.m_data ) - 1 );
+			}
+		};
+#endif
+	} // namespace css_details
+
+#if defined( __cpp_nontype_template_args ) and \
+  __cpp_nontype_template_args >= 201911L
+	namespace match {
+		/// The matcher of a CSS selector parsed at compile time, like
+		/// match::css<"a.nav[href^='/']">.  It is composed of the same matchers
+		/// as the hand written equivalent, here match::tag::A and
+		/// match::class_type::has( "nav" ) and
+		/// match::attribute::value::starts_with( "href", "/" ).  Compound
+		/// selectors, selector lists, :is( ), :where( ) and :not( ) are
+		/// supported.  Combinators and the other pseudo classes need the
+		/// runtime css_selector
+		template<css_details::fixed_string Selector>
+		inline constexpr auto css =
+		  css_details::build_selector<css_details::fixed_source<Selector>>( );
+	} // namespace match
+#endif
+} // namespace daw::gumbo
+
+/// The C++17 form of match::css, DAW_GUMBO_CSS( "a.nav[href^='/']" ) is the
+/// matcher of the selector
+#define DAW_GUMBO_CSS( selector )                                             \
+	( [] {                                                                      \
+		struct daw_gumbo_css_source {                                             \
+			static constexpr ::daw::string_view value( ) {                          \
+				return ::daw::string_view( selector );                                \
+			}                                                                       \
+		};                                                                        \
+		return ::daw::gumbo::css_details::build_selector<daw_gumbo_css_source>( ); \
+	}( ) )
@@ -0,0 +1,90 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_node_iterator.h"
+
+#include <daw/daw_string_view.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace daw::gumbo {
+	/// A fast, non-cryptographic 64bit hash of the bytes of a document.  Reads
+	/// a machine word at a time
+	[[nodiscard]] std::uint64_t document_hash( daw::string_view bytes ) noexcept;
+
+	struct document_cache_stats {
+		std::size_t hits = 0;
+		std::size_t misses = 0;
+		std::size_t evictions = 0;
+		std::size_t entries = 0;
+		std::size_t memory_used = 0;
+	};
+
+	/// Caches parsed documents by their content.  get( ) hashes the document and
+	/// returns the shared, read only range of an earlier parse of the same bytes
+	/// or parses it.  Each entry owns a copy of its document and the arena it was
+	/// parsed into, so its memory use is known exactly and the least recently
+	/// used entries are evicted to stay within the memory budget.  Ranges handed
+	/// out stay valid after eviction for as long as they are held.
+	/// All members are safe to call concurrently
+	class document_cache {
+		struct entry_t;
+		using lru_list_t = std::list<std::shared_ptr<entry_t const>>;
+
+		mutable std::mutex m_mutex{ };
+		// Most recently used first
+		lru_list_t m_lru{ };
+		std::unordered_map<std::uint64_t, lru_list_t::iterator> m_entries{ };
+		std::size_t m_memory_budget;
+		std::size_t m_memory_used = 0;
+		GumboOptions m_options;
+		std::atomic<std::size_t> m_hits{ 0 };
+		std::atomic<std::size_t> m_misses{ 0 };
+		std::atomic<std::size_t> m_evictions{ 0 };
+
+		// Requires m_mutex to be held
+		void evict_to( std::size_t memory_limit );
+
+	public:
+		explicit document_cache(
+		  std::size_t memory_budget,
+		  GumboOptions const &options = kGumboDefaultOptions );
+
+		document_cache( document_cache const & ) = delete;
+		document_cache &operator=( document_cache const & ) = delete;
+		document_cache( document_cache && ) = delete;
+		document_cache &operator=( document_cache && ) = delete;
+		~document_cache( );
+
+		/// The parsed document.  The range refers to the cache's copy of the
+		/// document, html_document does not need to outlive it.  Documents larger
+		/// than the budget are parsed but not cached
+		[[nodiscard]] std::shared_ptr<gumbo_range const>
+		get( daw::string_view html_document );
+
+		/// Remove all entries.  Ranges that are held stay valid
+		void clear( );
+
+		[[nodiscard]] std::size_t memory_budget( ) const;
+
+		/// Change the budget, evicting entries to fit it
+		void set_memory_budget( std::size_t memory_budget );
+
+		[[nodiscard]] document_cache_stats stats( ) const;
+	};
+} // namespace daw::gumbo
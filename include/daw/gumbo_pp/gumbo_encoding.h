@@ -0,0 +1,89 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <string>
+
+namespace daw::gumbo {
+	/// The encodings that can be converted to UTF-8 before parsing.  unknown
+	/// means the document does not declare an encoding, and one that is not
+	/// valid UTF-8 is decoded as windows-1252, the most common legacy
+	/// encoding.  unsupported means it declares an encoding that is not listed
+	/// here, like Shift_JIS, so it cannot be converted
+	enum class html_encoding {
+		unknown,
+		unsupported,
+		utf8,
+		utf16le,
+		utf16be,
+		windows_1252,
+		iso_8859_15
+	};
+
+	constexpr daw::string_view to_string( html_encoding encoding ) {
+		switch( encoding ) {
+		case html_encoding::utf8:
+			return "UTF-8";
+		case html_encoding::utf16le:
+			return "UTF-16LE";
+		case html_encoding::utf16be:
+			return "UTF-16BE";
+		case html_encoding::windows_1252:
+			return "windows-1252";
+		case html_encoding::iso_8859_15:
+			return "ISO-8859-15";
+		case html_encoding::unsupported:
+			return "unsupported";
+		case html_encoding::unknown:
+		default:
+			return "unknown";
+		}
+	}
+
+	/// Map an encoding label, like the value of <meta charset>, to an encoding.
+	/// Labels that are not recognized are unsupported, an empty one is unknown
+	[[nodiscard]] html_encoding encoding_from_label( daw::string_view label );
+
+	struct encoding_sniff_result {
+		html_encoding encoding;
+		// Size of the byte order mark at the start of the document, if any
+		std::size_t bom_size;
+	};
+
+	/// Determine the encoding of the raw document from the byte order mark, or
+	/// the <meta charset> and <meta http-equiv> tags in the first 1024 bytes.
+	/// unknown is returned when there is no indication and unsupported when
+	/// the declared encoding cannot be converted
+	[[nodiscard]] encoding_sniff_result sniff_encoding( daw::string_view raw );
+
+	/// Is the whole buffer well formed UTF-8.  Runs of ASCII are checked 8 bytes
+	/// at a time
+	[[nodiscard]] bool is_valid_utf8( daw::string_view str ) noexcept;
+
+	struct decoded_html {
+		// The UTF-8 document, either a view of the input or of the buffer
+		daw::string_view html;
+		html_encoding encoding;
+		bool transcoded;
+	};
+
+	/// Get a UTF-8 view of the raw document.  Documents that are already valid
+	/// UTF-8 are returned as is, without their byte order mark.  Otherwise they
+	/// are transcoded into buffer, which is cleared first and can be reused
+	/// between documents to avoid allocating.  Documents in an unsupported
+	/// encoding are returned as is with the encoding unsupported, so callers
+	/// can send them elsewhere instead of parsing them garbled
+	[[nodiscard]] decoded_html to_utf8( daw::string_view raw,
+	                                    std::string &buffer );
+} // namespace daw::gumbo
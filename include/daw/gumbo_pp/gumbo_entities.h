@@ -0,0 +1,43 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+
+#include <daw/daw_string_view.h>
+
+#include <string>
+
+namespace daw::gumbo {
+	/// Append text to out with its character references decoded.  Meant for the
+	/// raw source slices returned by node_inner_text and node_outer_text.  Named
+	/// references are the full HTML set, including the legacy ones accepted
+	/// without a ;, and numeric references are decoded as the HTML standard
+	/// specifies.  Text without a & is copied in bulk
+	void decode_entities( daw::string_view text, std::string &out );
+
+	[[nodiscard]] std::string decode_entities( daw::string_view text );
+
+	/// Decode text in place.  The decoded text is shorter than the source for
+	/// all but two references, so no memory is needed unless those grow it
+	void decode_entities_in_place( std::string &text );
+
+	/// Decodes a document that arrives in chunks.  A reference split between
+	/// two chunks is held back until the next chunk or finish( )
+	class entity_decoder {
+		std::string m_pending{ };
+
+	public:
+		/// Append the decoded chunk to out
+		void decode( daw::string_view chunk, std::string &out );
+
+		/// Append anything held back to out.  The decoder can then be reused
+		void finish( std::string &out );
+	};
+} // namespace daw::gumbo
@@ -0,0 +1,533 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_interner.h"
+#include "gumbo_node_iterator.h"
+
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace daw::gumbo {
+	class flat_document;
+
+	/// An attribute of a flat_document node.  name is an atom of the
+	/// document's interner.  value is an atom too unless it was too long to be
+	/// interned, then it is no_atom and value_offset is its offset into the
+	/// document's string pool
+	struct flat_attribute {
+		string_interner::atom_t name;
+		string_interner::atom_t value;
+		std::uint32_t value_offset;
+	};
+
+	/// A reference to a node of a flat_document.  The tag and attribute
+	/// matchers of gumbo_matchers.h, and those built on them, read the flat
+	/// arrays directly.  Other matchers go through the conversion to
+	/// GumboNode const &, which throws once the gumbo tree is released
+	class flat_node {
+		flat_document const *m_doc = nullptr;
+		std::uint32_t m_index = 0;
+
+	public:
+		constexpr flat_node( ) = default;
+		constexpr flat_node( flat_document const &doc,
+		                     std::uint32_t index ) noexcept
+		  : m_doc( &doc )
+		  , m_index( index ) {}
+
+		[[nodiscard]] constexpr std::uint32_t index( ) const noexcept {
+			return m_index;
+		}
+
+		[[nodiscard]] constexpr flat_document const &document( ) const noexcept {
+			assert( m_doc );
+			return *m_doc;
+		}
+
+		[[nodiscard]] inline GumboNodeType type( ) const;
+		[[nodiscard]] inline GumboTag tag( ) const;
+		[[nodiscard]] inline GumboNode const &gumbo_node( ) const;
+
+		inline operator GumboNode const &( ) const {
+			return gumbo_node( );
+		}
+
+		[[nodiscard]] friend constexpr bool
+		operator==( flat_node const &lhs, flat_node const &rhs ) noexcept {
+			return lhs.m_doc == rhs.m_doc and lhs.m_index == rhs.m_index;
+		}
+
+		[[nodiscard]] friend constexpr bool
+		operator!=( flat_node const &lhs, flat_node const &rhs ) noexcept {
+			return not( lhs == rhs );
+		}
+	};
+
+	/// Iterates the nodes of a flat_document in document order
+	class flat_node_iterator {
+		flat_document const *m_doc = nullptr;
+		std::uint32_t m_index = 0;
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using value_type = flat_node;
+		using pointer = void;
+		using reference = flat_node;
+		using iterator_category = std::random_access_iterator_tag;
+
+		constexpr flat_node_iterator( ) = default;
+		constexpr flat_node_iterator( flat_document const &doc,
+		                              std::uint32_t index ) noexcept
+		  : m_doc( &doc )
+		  , m_index( index ) {}
+
+		[[nodiscard]] constexpr std::uint32_t index( ) const noexcept {
+			return m_index;
+		}
+
+		[[nodiscard]] constexpr flat_node operator*( ) const noexcept {
+			assert( m_doc );
+			return flat_node( *m_doc, m_index );
+		}
+
+		[[nodiscard]] constexpr flat_node
+		operator[]( difference_type n ) const noexcept {
+			return *( *this + n );
+		}
+
+		constexpr flat_node_iterator &operator++( ) noexcept {
+			++m_index;
+			return *this;
+		}
+
+		constexpr flat_node_iterator operator++( int ) noexcept {
+			auto result = *this;
+			++m_index;
+			return result;
+		}
+
+		constexpr flat_node_iterator &operator--( ) noexcept {
+			--m_index;
+			return *this;
+		}
+
+		constexpr flat_node_iterator operator--( int ) noexcept {
+			auto result = *this;
+			--m_index;
+			return result;
+		}
+
+		constexpr flat_node_iterator &operator+=( difference_type n ) noexcept {
+			m_index = static_cast<std::uint32_t>(
+			  static_cast<difference_type>( m_index ) + n );
+			return *this;
+		}
+
+		constexpr flat_node_iterator &operator-=( difference_type n ) noexcept {
+			return *this += -n;
+		}
+
+		[[nodiscard]] friend constexpr flat_node_iterator
+		operator+( flat_node_iterator it, difference_type n ) noexcept {
+			it += n;
+			return it;
+		}
+
+		[[nodiscard]] friend constexpr flat_node_iterator
+		operator+( difference_type n, flat_node_iterator it ) noexcept {
+			it += n;
+			return it;
+		}
+
+		[[nodiscard]] friend constexpr flat_node_iterator
+		operator-( flat_node_iterator it, difference_type n ) noexcept {
+			it -= n;
+			return it;
+		}
+
+		[[nodiscard]] friend constexpr difference_type
+		operator-( flat_node_iterator const &lhs,
+		           flat_node_iterator const &rhs ) noexcept {
+			return static_cast<difference_type>( lhs.m_index ) -
+			       static_cast<difference_type>( rhs.m_index );
+		}
+
+		[[nodiscard]] friend constexpr bool
+		operator==( flat_node_iterator const &lhs,
+		            flat_node_iterator const &rhs ) noexcept {
+			return lhs.m_index == rhs.m_index;
+		}
+
+		[[nodiscard]] friend constexpr bool
+		operator!=( flat_node_iterator const &lhs,
+		            flat_node_iterator const &rhs ) noexcept {
+			return lhs.m_index != rhs.m_index;
+		}
+
+		[[nodiscard]] friend constexpr bool
+		operator<( flat_node_iterator const &lhs,
+		           flat_node_iterator const &rhs ) noexcept {
+			return lhs.m_index < rhs.m_index;
+		}
+
+		[[nodiscard]] friend constexpr bool
+		operator<=( flat_node_iterator const &lhs,
+		            flat_node_iterator const &rhs ) noexcept {
+			return lhs.m_index <= rhs.m_index;
+		}
+
+		[[nodiscard]] friend constexpr bool
+		operator>( flat_node_iterator const &lhs,
+		           flat_node_iterator const &rhs ) noexcept {
+			return lhs.m_index > rhs.m_index;
+		}
+
+		[[nodiscard]] friend constexpr bool
+		operator>=( flat_node_iterator const &lhs,
+		            flat_node_iterator const &rhs ) noexcept {
+			return lhs.m_index >= rhs.m_index;
+		}
+	};
+
+	/// Whether a flat_document built from a gumbo_range it owns keeps the gumbo
+	/// tree after flattening
+	enum class gumbo_tree_retention { keep, release };
+
+	/// A pre-order, struct of arrays copy of a parsed document.  Nodes are
+	/// addressed by their 32bit index in document order and the descendants of
+	/// node n are the nodes [n + 1, subtree_end( n ) ).  Attribute names/values
+	/// and text are copied into a string pool so the flattened data is usable
+	/// after the gumbo tree has been released.  Attribute names and short values
+	/// are interned, optionally into an interner shared with other documents.
+	class flat_document {
+	public:
+		using index_t = std::uint32_t;
+		using atom_t = string_interner::atom_t;
+		static constexpr index_t npos = static_cast<index_t>( -1 );
+		static constexpr atom_t no_atom = string_interner::no_atom;
+
+	private:
+		std::vector<std::uint8_t> m_types{ };
+		std::vector<std::uint16_t> m_tags{ };
+		std::vector<index_t> m_parents{ };
+		std::vector<index_t> m_subtree_ends{ };
+		// Attributes of node n are [m_attribute_first[n], m_attribute_first[n+1])
+		std::vector<index_t> m_attribute_first{ };
+		// Offset into the string pool of the text of text, comment, cdata and
+		// whitespace nodes. npos for others
+		std::vector<index_t> m_text{ };
+		std::vector<source_span> m_outer_spans{ };
+		std::vector<source_span> m_inner_spans{ };
+		std::vector<flat_attribute> m_attributes{ };
+		// NUL terminated strings
+		std::string m_strings{ };
+		std::shared_ptr<string_interner> m_interner;
+		std::vector<GumboNode const *> m_nodes{ };
+		std::optional<gumbo_range> m_range{ };
+		std::shared_ptr<void const> m_source{ };
+		daw::string_view m_html{ };
+		index_t m_root = 0;
+
+		void build( gumbo_range const &rng );
+		index_t add_string( char const *str );
+
+	public:
+		/// Flatten the range.  The nodes refer to the range's gumbo tree, so it
+		/// must outlive the flat_document.  Attribute strings are interned into
+		/// interner, or a new interner for this document when it is null
+		explicit flat_document(
+		  gumbo_range const &rng,
+		  std::shared_ptr<string_interner> interner = nullptr );
+
+		/// Flatten the range and take ownership of it.  When retention is release
+		/// the gumbo tree is destroyed once flattened and only the flat data is
+		/// available.  The document is kept if the range owns it
+		explicit flat_document(
+		  gumbo_range &&rng,
+		  gumbo_tree_retention retention = gumbo_tree_retention::keep,
+		  std::shared_ptr<string_interner> interner = nullptr );
+
+		/// Flatten the range, keeping it and its gumbo tree, and intern into
+		/// interner.  Without this a temporary range would bind to the const &
+		/// overload and be destroyed while the nodes still refer to it
+		flat_document( gumbo_range &&rng,
+		               std::shared_ptr<string_interner> interner );
+
+		/// Number of nodes, including the document node at index 0
+		[[nodiscard]] inline index_t size( ) const noexcept {
+			return static_cast<index_t>( m_types.size( ) );
+		}
+
+		/// The index of the root html element.  Iteration starts here, the same
+		/// as gumbo_range
+		[[nodiscard]] inline index_t root( ) const noexcept {
+			return m_root;
+		}
+
+		[[nodiscard]] inline flat_node_iterator begin( ) const noexcept {
+			return flat_node_iterator( *this, m_root );
+		}
+
+		[[nodiscard]] inline flat_node_iterator end( ) const noexcept {
+			return flat_node_iterator( *this, size( ) );
+		}
+
+		[[nodiscard]] inline flat_node operator[]( index_t idx ) const noexcept {
+			assert( idx < size( ) );
+			return flat_node( *this, idx );
+		}
+
+		[[nodiscard]] inline GumboNodeType type( index_t idx ) const noexcept {
+			return static_cast<GumboNodeType>( m_types[idx] );
+		}
+
+		/// The tag of element nodes, GUMBO_TAG_UNKNOWN for others
+		[[nodiscard]] inline GumboTag tag( index_t idx ) const noexcept {
+			return static_cast<GumboTag>( m_tags[idx] );
+		}
+
+		/// The parent of the node, npos for the document node
+		[[nodiscard]] inline index_t parent( index_t idx ) const noexcept {
+			return m_parents[idx];
+		}
+
+		/// One past the last descendant of the node
+		[[nodiscard]] inline index_t subtree_end( index_t idx ) const noexcept {
+			return m_subtree_ends[idx];
+		}
+
+		[[nodiscard]] inline flat_attribute const *
+		attributes_begin( index_t idx ) const noexcept {
+			return m_attributes.data( ) + m_attribute_first[idx];
+		}
+
+		[[nodiscard]] inline flat_attribute const *
+		attributes_end( index_t idx ) const noexcept {
+			return m_attributes.data( ) + m_attribute_first[idx + 1U];
+		}
+
+		[[nodiscard]] inline index_t attribute_count( index_t idx ) const noexcept {
+			return m_attribute_first[idx + 1U] - m_attribute_first[idx];
+		}
+
+		/// A NUL terminated string from the pool
+		[[nodiscard]] inline daw::string_view
+		string_at( std::uint32_t offset ) const noexcept {
+			return daw::string_view( m_strings.data( ) + offset );
+		}
+
+		/// The interner holding the attribute names and short values
+		[[nodiscard]] inline string_interner const &interner( ) const noexcept {
+			return *m_interner;
+		}
+
+		[[nodiscard]] inline daw::string_view
+		attribute_name( flat_attribute const &attr ) const {
+			return m_interner->str( attr.name );
+		}
+
+		[[nodiscard]] inline daw::string_view
+		attribute_value( flat_attribute const &attr ) const {
+			if( attr.value == no_atom ) {
+				return string_at( attr.value_offset );
+			}
+			return m_interner->str( attr.value );
+		}
+
+		/// The attribute of node idx named by the atom, or nullptr
+		[[nodiscard]] inline flat_attribute const *
+		find_attribute( index_t idx, atom_t name ) const noexcept {
+			auto const *last = attributes_end( idx );
+			for( auto const *attr = attributes_begin( idx ); attr != last; ++attr ) {
+				if( attr->name == name ) {
+					return attr;
+				}
+			}
+			return nullptr;
+		}
+
+		/// The value of the named attribute, or an empty view
+		[[nodiscard]] daw::string_view
+		attribute_value( index_t idx, daw::string_view name ) const;
+
+		/// The decoded text of text, comment, cdata and whitespace nodes
+		[[nodiscard]] inline daw::string_view text( index_t idx ) const noexcept {
+			if( m_text[idx] == npos ) {
+				return { };
+			}
+			return string_at( m_text[idx] );
+		}
+
+		/// Byte offsets of the source of the node, including its tags
+		[[nodiscard]] inline source_span outer_span( index_t idx ) const noexcept {
+			return m_outer_spans[idx];
+		}
+
+		/// Byte offsets of the source between the node's tags
+		[[nodiscard]] inline source_span inner_span( index_t idx ) const noexcept {
+			return m_inner_spans[idx];
+		}
+
+		/// The html document the spans refer to
+		[[nodiscard]] inline daw::string_view html( ) const noexcept {
+			return m_html;
+		}
+
+		[[nodiscard]] inline daw::string_view outer_text( index_t idx ) const {
+			auto const span = m_outer_spans[idx];
+			return m_html.substr( span.first, span.size( ) );
+		}
+
+		[[nodiscard]] inline daw::string_view inner_text( index_t idx ) const {
+			auto const span = m_inner_spans[idx];
+			return m_html.substr( span.first, span.size( ) );
+		}
+
+		/// Is the gumbo tree still available
+		[[nodiscard]] inline bool has_tree( ) const noexcept {
+			return not m_nodes.empty( );
+		}
+
+		/// The gumbo node at idx.  Throws when the tree has been released
+		[[nodiscard]] inline GumboNode const &gumbo_node( index_t idx ) const {
+			if( not has_tree( ) ) {
+				throw std::runtime_error(
+				  "The gumbo tree of the flat_document has been released" );
+			}
+			return *m_nodes[idx];
+		}
+	};
+
+	inline GumboNodeType flat_node::type( ) const {
+		return document( ).type( m_index );
+	}
+
+	inline GumboTag flat_node::tag( ) const {
+		return document( ).tag( m_index );
+	}
+
+	inline GumboNode const &flat_node::gumbo_node( ) const {
+		return document( ).gumbo_node( m_index );
+	}
+
+	/// Number of attributes of the node, read from the flat arrays
+	[[nodiscard]] inline std::size_t get_attribute_count( flat_node node ) {
+		return node.document( ).attribute_count( node.index( ) );
+	}
+} // namespace daw::gumbo
+
+namespace daw::gumbo::match_details::match_attribute::atom {
+	/// Matchers for flat_document nodes that compare interned atoms instead of
+	/// strings.  The strings are looked up in the interner when the matcher is
+	/// created, it must be the interner of the documents matched.  A string
+	/// that was not interned yet may be interned by a later document, so those
+	/// are compared as strings
+	namespace atom_details {
+		struct name_atom_t {
+			string_interner::atom_t atom;
+			daw::string_view str;
+
+			[[nodiscard]] inline bool
+			matches( flat_document const &doc,
+			         flat_attribute const &attr ) const {
+				if( atom == string_interner::no_atom ) {
+					return doc.attribute_name( attr ) == str;
+				}
+				return attr.name == atom;
+			}
+		};
+
+		struct value_atom_t {
+			string_interner::atom_t atom;
+			daw::string_view str;
+
+			[[nodiscard]] inline bool
+			matches( flat_document const &doc,
+			         flat_attribute const &attr ) const {
+				// Values too long to be interned are in the document's pool
+				if( attr.value == string_interner::no_atom or
+				    atom == string_interner::no_atom ) {
+					return doc.attribute_value( attr ) == str;
+				}
+				return attr.value == atom;
+			}
+		};
+	} // namespace atom_details
+
+	/// Match any flat_node with an attribute with one of the names
+	template<typename... StringView>
+	auto exists( string_interner const &interner,
+	             daw::string_view name,
+	             StringView &&...names ) {
+		using atom_details::name_atom_t;
+		using atoms_t = std::array<name_atom_t, 1U + sizeof...( names )>;
+		auto const atoms =
+		  atoms_t{ name_atom_t{ interner.find( name ), name },
+		           name_atom_t{ interner.find( names ), names }... };
+		return [atoms]( flat_node node ) {
+			auto const &doc = node.document( );
+			auto const *last = doc.attributes_end( node.index( ) );
+			for( auto const *attr = doc.attributes_begin( node.index( ) );
+			     attr != last;
+			     ++attr ) {
+				for( auto const &a : atoms ) {
+					if( a.matches( doc, *attr ) ) {
+						return true;
+					}
+				}
+			}
+			return false;
+		};
+	}
+
+	/// Match any flat_node with the named attribute equal to one of the values
+	template<typename... StringView>
+	auto is( string_interner const &interner,
+	         daw::string_view name,
+	         daw::string_view value,
+	         StringView &&...values ) {
+		using atom_details::name_atom_t;
+		using atom_details::value_atom_t;
+		return [name_atom = name_atom_t{ interner.find( name ), name },
+		        value_atoms = std::array<value_atom_t, 1U + sizeof...( values )>{
+		          value_atom_t{ interner.find( value ), value },
+		          value_atom_t{ interner.find( values ), values }... }](
+		         flat_node node ) {
+			auto const &doc = node.document( );
+			auto const *last = doc.attributes_end( node.index( ) );
+			for( auto const *attr = doc.attributes_begin( node.index( ) );
+			     attr != last;
+			     ++attr ) {
+				if( not name_atom.matches( doc, *attr ) ) {
+					continue;
+				}
+				for( auto const &v : value_atoms ) {
+					if( v.matches( doc, *attr ) ) {
+						return true;
+					}
+				}
+				return false;
+			}
+			return false;
+		};
+	}
+} // namespace daw::gumbo::match_details::match_attribute::atom
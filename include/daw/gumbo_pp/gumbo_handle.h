@@ -9,18 +9,29 @@
 #pragma once
 
 #include "details/gumbo_pp.h"
+#include "gumbo_arena.h"
 
 #include <gumbo.h>
 #include <memory>
 
 namespace daw::gumbo {
 	struct GumboDeleter {
+		// When set, the output was allocated in the arena and is released with it
+		gumbo_arena *arena = nullptr;
+
 		constexpr GumboDeleter( ) = default;
 
+		explicit constexpr GumboDeleter( gumbo_arena &a ) noexcept
+		  : arena( &a ) {}
+
 		inline void operator( )( GumboOutput *output ) const {
 			if( not output ) {
 				return;
 			}
+			if( arena ) {
+				arena->remove_output( );
+				return;
+			}
 			gumbo_destroy_output( &kGumboDefaultOptions, output );
 		}
 	};
@@ -29,5 +40,8 @@ namespace daw::gumbo {
 		using base = std::unique_ptr<GumboOutput, GumboDeleter>;
 		inline GumboHandle( GumboOutput *ptr )
 		  : base( ptr ) {}
+
+		inline GumboHandle( GumboOutput *ptr, GumboDeleter deleter )
+		  : base( ptr, deleter ) {}
 	};
 } // namespace daw::gumbo
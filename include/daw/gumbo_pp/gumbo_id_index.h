@@ -0,0 +1,141 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_matchers.h"
+#include "gumbo_node_iterator.h"
+
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <gumbo.h>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace daw::gumbo {
+	/// The elements with one id, in document order
+	class id_index_range {
+		GumboNode const *const *m_first = nullptr;
+		GumboNode const *const *m_last = nullptr;
+
+	public:
+		constexpr id_index_range( ) = default;
+
+		constexpr id_index_range( GumboNode const *const *first,
+		                          GumboNode const *const *last ) noexcept
+		  : m_first( first )
+		  , m_last( last ) {}
+
+		[[nodiscard]] constexpr GumboNode const *const *begin( ) const noexcept {
+			return m_first;
+		}
+
+		[[nodiscard]] constexpr GumboNode const *const *end( ) const noexcept {
+			return m_last;
+		}
+
+		[[nodiscard]] constexpr std::size_t size( ) const noexcept {
+			return static_cast<std::size_t>( m_last - m_first );
+		}
+
+		[[nodiscard]] constexpr bool empty( ) const noexcept {
+			return m_first == m_last;
+		}
+	};
+
+	/// Maps the id attribute values of a document to their elements.  The map
+	/// is built on the first lookup, so an index that is never queried costs
+	/// nothing.  The ids are kept sorted in one flat array, with the elements of
+	/// a repeated id next to each other in document order.  The range indexed
+	/// must outlive the index
+	class id_index {
+		gumbo_node_iterator_t m_first;
+		gumbo_node_iterator_t m_last;
+		mutable std::once_flag m_built{ };
+		mutable std::vector<std::string_view> m_ids{ };
+		mutable std::vector<GumboNode const *> m_nodes{ };
+		mutable std::size_t m_distinct = 0;
+
+		void build( ) const;
+
+		inline void ensure_built( ) const {
+			std::call_once( m_built, [this] {
+				build( );
+			} );
+		}
+
+	public:
+		explicit id_index( gumbo_range const &rng ) noexcept;
+		id_index( gumbo_node_iterator_t first,
+		          gumbo_node_iterator_t last ) noexcept;
+
+		// Matchers created from the index refer to it
+		id_index( id_index const & ) = delete;
+		id_index &operator=( id_index const & ) = delete;
+		id_index( id_index && ) = delete;
+		id_index &operator=( id_index && ) = delete;
+
+		/// Every element with the id, in document order
+		[[nodiscard]] inline id_index_range find_all( daw::string_view id ) const {
+			ensure_built( );
+			auto const pos =
+			  std::equal_range( m_ids.begin( ),
+			                    m_ids.end( ),
+			                    std::string_view( id.data( ), id.size( ) ) );
+			auto const *const nodes = m_nodes.data( );
+			return id_index_range( nodes + ( pos.first - m_ids.begin( ) ),
+			                       nodes + ( pos.second - m_ids.begin( ) ) );
+		}
+
+		/// The element with the id, or nullptr when there is none.  Like
+		/// getElementById, when an id is repeated the first element in document
+		/// order wins
+		[[nodiscard]] inline GumboNode const *find( daw::string_view id ) const {
+			auto const nodes = find_all( id );
+			if( nodes.empty( ) ) {
+				return nullptr;
+			}
+			return *nodes.begin( );
+		}
+
+		[[nodiscard]] inline bool contains( daw::string_view id ) const {
+			return find( id ) != nullptr;
+		}
+
+		/// The number of distinct ids in the document
+		[[nodiscard]] inline std::size_t size( ) const {
+			ensure_built( );
+			return m_distinct;
+		}
+	};
+} // namespace daw::gumbo
+
+namespace daw::gumbo::match_details::match_id {
+	/// Match the elements with any of the ids, including every element of an id
+	/// that is repeated.  The elements are looked up in the index once when the
+	/// matcher is created, leaving a few pointer comparisons per node
+	template<typename... StringView>
+	auto is( id_index const &ids,
+	         daw::string_view id_name,
+	         StringView &&...id_names ) {
+		auto nodes = std::vector<GumboNode const *>( );
+		for( auto const &nodes_of_id :
+		     { ids.find_all( id_name ), ids.find_all( id_names )... } ) {
+			nodes.insert( nodes.end( ), nodes_of_id.begin( ), nodes_of_id.end( ) );
+		}
+		return with_cost<matcher_cost::tag>(
+		  [nodes = std::move( nodes )]( GumboNode const &node ) noexcept {
+			  return std::find( nodes.begin( ), nodes.end( ), &node ) !=
+			         nodes.end( );
+		  } );
+	}
+} // namespace daw::gumbo::match_details::match_id
@@ -0,0 +1,80 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace daw::gumbo {
+	/// Maps strings to small integer atoms so that equal strings are stored once
+	/// and compared as integers.  Attribute names are always interned, values
+	/// only when they are at most max_value_size( ) bytes; short values like
+	/// class names or input types repeat, long ones like urls rarely do.
+	/// An interner can be shared by the flat_documents of many pages.  It is not
+	/// synchronized, interning from more than one thread needs external locking.
+	/// Reading atoms is safe once nothing is being interned
+	class string_interner {
+	public:
+		using atom_t = std::uint32_t;
+		static constexpr atom_t no_atom = static_cast<atom_t>( -1 );
+		static constexpr std::size_t default_max_value_size = 32U;
+
+	private:
+		// A deque never moves its elements, so the views in m_atoms stay valid
+		std::deque<std::string> m_strings{ };
+		std::unordered_map<std::string_view, atom_t> m_atoms{ };
+		std::size_t m_max_value_size;
+
+	public:
+		explicit string_interner(
+		  std::size_t max_value_size = default_max_value_size );
+
+		// The map refers to the strings, a copy would refer to the original's
+		string_interner( string_interner const & ) = delete;
+		string_interner &operator=( string_interner const & ) = delete;
+		string_interner( string_interner && ) = default;
+		string_interner &operator=( string_interner && ) = default;
+
+		/// The atom for str, adding it when it is not interned yet
+		[[nodiscard]] atom_t intern( daw::string_view str );
+
+		/// The atom for str, or no_atom when it has not been interned.  Matchers
+		/// use this so that looking for a string never seen cannot grow the table
+		[[nodiscard]] atom_t find( daw::string_view str ) const;
+
+		/// The NUL terminated string of an atom
+		[[nodiscard]] inline daw::string_view str( atom_t atom ) const {
+			auto const &result = m_strings[atom];
+			return daw::string_view( result.data( ), result.size( ) );
+		}
+
+		/// Number of distinct strings interned
+		[[nodiscard]] inline std::size_t size( ) const noexcept {
+			return m_strings.size( );
+		}
+
+		[[nodiscard]] inline std::size_t max_value_size( ) const noexcept {
+			return m_max_value_size;
+		}
+
+		/// Are attribute values like value interned
+		[[nodiscard]] inline bool
+		interns_value( daw::string_view value ) const noexcept {
+			return value.size( ) <= m_max_value_size;
+		}
+	};
+} // namespace daw::gumbo
@@ -0,0 +1,89 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace daw::gumbo {
+	namespace keyword_details {
+		struct automaton;
+	} // namespace keyword_details
+
+	/// A keyword found in a text
+	struct keyword_match {
+		/// Index of the keyword in the keyword_set
+		std::size_t keyword;
+		/// Offset of the start of the keyword in the text
+		std::size_t position;
+	};
+
+	/// A set of keywords compiled into an Aho-Corasick automaton, so that a
+	/// text is searched for all of them in one pass, however many there are.
+	/// The automaton is immutable once built and copies share it, so a
+	/// keyword_set can be captured by matchers and used across documents and
+	/// threads.  Empty keywords are ignored
+	class keyword_set {
+		std::shared_ptr<keyword_details::automaton const> m_automaton;
+
+	public:
+		/// The empty set, that matches nothing
+		keyword_set( );
+
+		explicit keyword_set( std::vector<std::string> keywords );
+
+		keyword_set( std::initializer_list<daw::string_view> keywords );
+
+		/// Build from a container of things convertible to daw::string_view
+		template<typename Container,
+		         std::enable_if_t<
+		           daw::traits::is_container_like_v<daw::remove_cvref_t<Container>>,
+		           std::nullptr_t> = nullptr>
+		explicit keyword_set( Container const &keywords )
+		  : keyword_set( to_strings( keywords ) ) {}
+
+		/// Number of keywords, including any that are empty
+		[[nodiscard]] std::size_t size( ) const noexcept;
+
+		/// The keyword at index, as given to the constructor
+		[[nodiscard]] daw::string_view keyword( std::size_t index ) const;
+
+		/// Does text contain any of the keywords.  Stops at the first one found
+		[[nodiscard]] bool contains_any( daw::string_view text ) const;
+
+		/// Append every occurrence of the keywords in text to matches, ordered by
+		/// where they end, longest first when several end at the same place.
+		/// Overlapping occurrences are all reported.  Returns the number appended
+		std::size_t find_all( daw::string_view text,
+		                      std::vector<keyword_match> &matches ) const;
+
+		[[nodiscard]] std::vector<keyword_match>
+		find_all( daw::string_view text ) const;
+
+	private:
+		template<typename Container>
+		static std::vector<std::string> to_strings( Container const &keywords ) {
+			auto result = std::vector<std::string>{ };
+			for( auto const &keyword : keywords ) {
+				auto const sv = daw::string_view( keyword );
+				result.emplace_back( sv.data( ), sv.size( ) );
+			}
+			return result;
+		}
+	};
+} // namespace daw::gumbo
@@ -0,0 +1,272 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_matcher_compiler.h"
+#include "gumbo_matchers.h"
+#include "gumbo_text.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/daw_tuple2.h>
+
+#include <array>
+#include <cstddef>
+#include <gumbo.h>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace daw::gumbo {
+	namespace many_details {
+		template<typename... Ts>
+		struct type_list {};
+
+		template<typename... Lists>
+		struct concat {
+			using type = type_list<>;
+		};
+
+		template<typename... Ts>
+		struct concat<type_list<Ts...>> {
+			using type = type_list<Ts...>;
+		};
+
+		template<typename... Ts, typename... Us, typename... Lists>
+		struct concat<type_list<Ts...>, type_list<Us...>, Lists...> {
+			using type =
+			  typename concat<type_list<Ts..., Us...>, Lists...>::type;
+		};
+
+		/// The matchers a query is built from, looking through match_all,
+		/// match_any, match_one and match_not
+		template<typename Matcher>
+		struct leaves {
+			using type = type_list<Matcher>;
+		};
+
+		template<typename... Matchers>
+		struct leaves<match_all<Matchers...>> {
+			using type = typename concat<typename leaves<Matchers>::type...>::type;
+		};
+
+		template<typename... Matchers>
+		struct leaves<match_any<Matchers...>> {
+			using type = typename concat<typename leaves<Matchers>::type...>::type;
+		};
+
+		template<typename... Matchers>
+		struct leaves<match_one<Matchers...>> {
+			using type = typename concat<typename leaves<Matchers>::type...>::type;
+		};
+
+		template<typename Matcher>
+		struct leaves<match_not<Matcher>> {
+			using type = typename leaves<Matcher>::type;
+		};
+
+		/// The stateless matchers of List, each once.  Two of them with the same
+		/// type give the same answer for a node, like match::tag::TD in several
+		/// queries, so they are evaluated once per node
+		template<typename List, typename Result = type_list<>>
+		struct shared_leaves {
+			using type = Result;
+		};
+
+		template<typename Matcher, typename... Matchers, typename... Result>
+		struct shared_leaves<type_list<Matcher, Matchers...>,
+		                     type_list<Result...>> {
+			using type = typename shared_leaves<
+			  type_list<Matchers...>,
+			  std::conditional_t<std::is_empty_v<Matcher> and
+			                       not( std::is_same_v<Matcher, Result> or ... ),
+			                     type_list<Result..., Matcher>,
+			                     type_list<Result...>>>::type;
+		};
+
+		template<typename Matcher, typename... Shared>
+		constexpr std::size_t shared_index( type_list<Shared...> ) {
+			constexpr bool found[] = { std::is_same_v<Matcher, Shared>..., false };
+			std::size_t n = 0;
+			while( n < sizeof...( Shared ) and not found[n] ) {
+				++n;
+			}
+			return n;
+		}
+
+		/// What is known about the node being tested.  The results of the shared
+		/// matchers and the content text are computed on first use and reused by
+		/// every query
+		template<typename Shared>
+		class node_state;
+
+		template<typename... Shared>
+		class node_state<type_list<Shared...>> {
+			static constexpr std::size_t shared_count = sizeof...( Shared );
+
+			GumboNode const *m_node = nullptr;
+			// 0 not tested yet, 1 not matched, 2 matched
+			std::array<unsigned char, shared_count> m_shared{ };
+			std::string m_text_buffer{ };
+			bool m_has_text = false;
+
+		public:
+			void reset( GumboNode const &node ) {
+				m_node = &node;
+				m_shared.fill( 0 );
+				m_has_text = false;
+			}
+
+			[[nodiscard]] GumboNode const &node( ) const {
+				return *m_node;
+			}
+
+			[[nodiscard]] daw::string_view text( ) {
+				if( not m_has_text ) {
+					m_text_buffer.clear( );
+					node_content_text( *m_node, m_text_buffer );
+					m_has_text = true;
+				}
+				return daw::string_view( m_text_buffer.data( ),
+				                         m_text_buffer.size( ) );
+			}
+
+			template<typename Matcher, typename Evaluate>
+			bool shared( Evaluate &&evaluate ) {
+				constexpr std::size_t index =
+				  shared_index<Matcher>( type_list<Shared...>{ } );
+				if constexpr( index == shared_count ) {
+					return evaluate( );
+				} else {
+					auto &result = m_shared[index];
+					if( result == 0 ) {
+						result = evaluate( ) ? 2 : 1;
+					}
+					return result == 2;
+				}
+			}
+		};
+
+		template<typename Matcher, typename State>
+		bool evaluate( Matcher const &matcher, State &state );
+
+		template<typename... Matchers, typename State>
+		bool evaluate( match_all<Matchers...> const &matcher, State &state );
+
+		template<typename... Matchers, typename State>
+		bool evaluate( match_any<Matchers...> const &matcher, State &state );
+
+		template<typename... Matchers, typename State>
+		bool evaluate( match_one<Matchers...> const &matcher, State &state );
+
+		template<typename Matcher, typename State>
+		bool evaluate( match_not<Matcher> const &matcher, State &state );
+
+		template<typename Matcher, typename State>
+		bool evaluate( Matcher const &matcher, State &state ) {
+			return state.template shared<Matcher>( [&]( ) -> bool {
+				if constexpr( compile_details::is_content_text_where_v<Matcher> ) {
+					return matcher.test( state.text( ) );
+				} else {
+					return static_cast<bool>( matcher( state.node( ) ) );
+				}
+			} );
+		}
+
+		/// Like match_all and match_any, the matchers are run cheapest first
+		template<typename... Matchers, typename Tuple, typename State,
+		         std::size_t... Is>
+		bool all_of( Tuple const &matchers, State &state,
+		             std::index_sequence<Is...> ) {
+			constexpr auto order = cost_details::cost_order_v<Matchers...>;
+			return ( evaluate( std::get<order[Is]>( matchers ), state ) and ... );
+		}
+
+		template<typename... Matchers, typename Tuple, typename State,
+		         std::size_t... Is>
+		bool any_of( Tuple const &matchers, State &state,
+		             std::index_sequence<Is...> ) {
+			constexpr auto order = cost_details::cost_order_v<Matchers...>;
+			return ( evaluate( std::get<order[Is]>( matchers ), state ) or ... );
+		}
+
+		template<typename... Matchers, typename State>
+		bool evaluate( match_all<Matchers...> const &matcher, State &state ) {
+			return daw::apply( matcher.m_matchers, [&]( auto const &...ms ) {
+				return all_of<Matchers...>(
+				  std::tie( ms... ),
+				  state,
+				  std::make_index_sequence<sizeof...( Matchers )>{ } );
+			} );
+		}
+
+		template<typename... Matchers, typename State>
+		bool evaluate( match_any<Matchers...> const &matcher, State &state ) {
+			return daw::apply( matcher.m_matchers, [&]( auto const &...ms ) {
+				return any_of<Matchers...>(
+				  std::tie( ms... ),
+				  state,
+				  std::make_index_sequence<sizeof...( Matchers )>{ } );
+			} );
+		}
+
+		template<typename... Matchers, typename State>
+		bool evaluate( match_one<Matchers...> const &matcher, State &state ) {
+			return daw::apply( matcher.m_matchers, [&]( auto const &...ms ) {
+				return ( evaluate( ms, state ) ^ ... );
+			} );
+		}
+
+		template<typename Matcher, typename State>
+		bool evaluate( match_not<Matcher> const &matcher, State &state ) {
+			return not evaluate( matcher.matcher( ), state );
+		}
+
+		template<typename Queries, typename Buckets, typename State,
+		         std::size_t... Is>
+		void bucket_node( Queries const &queries, Buckets &buckets, State &state,
+		                  std::index_sequence<Is...> ) {
+			auto const add = [&]( std::size_t query, bool matched ) {
+				if( matched ) {
+					buckets[query].push_back( &state.node( ) );
+				}
+			};
+			( add( Is, evaluate( std::get<Is>( queries ), state ) ), ... );
+		}
+	} // namespace many_details
+
+	/// Test every node of rng against each of the queries in one walk of the
+	/// document.  Element n of the result holds the nodes matched by query n,
+	/// in document order.  Where the queries share work it is done once per
+	/// node: stateless matchers of the same type, like match::tag::TD, are run
+	/// once and the content text is built once for all the content text
+	/// matchers.  Prefer this to a find_if or count_if per query when many
+	/// queries are run over the same document
+	template<typename Range, typename... Queries>
+	[[nodiscard]] std::array<std::vector<GumboNode const *>, sizeof...( Queries )>
+	match_many( Range const &rng, Queries const &...queries ) {
+		using namespace many_details;
+		using shared_t = typename shared_leaves<typename concat<
+		  typename leaves<Queries>::type...>::type>::type;
+		auto result =
+		  std::array<std::vector<GumboNode const *>, sizeof...( Queries )>{ };
+		auto state = node_state<shared_t>{ };
+		auto const query_list = std::tie( queries... );
+		for( GumboNode const &node : rng ) {
+			state.reset( node );
+			bucket_node( query_list,
+			             result,
+			             state,
+			             std::make_index_sequence<sizeof...( Queries )>{ } );
+		}
+		return result;
+	}
+} // namespace daw::gumbo
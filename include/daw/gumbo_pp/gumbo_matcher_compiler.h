@@ -0,0 +1,288 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_matchers.h"
+#include "gumbo_text.h"
+#include "gumbo_util.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/daw_tuple2.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+#include <type_traits>
+
+namespace daw::gumbo {
+	namespace compile_details {
+		template<typename>
+		inline constexpr bool is_tag_check_v = false;
+
+		template<GumboTag... tags>
+		inline constexpr bool
+		  is_tag_check_v<match_details::match_tag::types_t<tags...>> = true;
+
+		template<typename>
+		inline constexpr bool is_attribute_where_v = false;
+
+		template<typename... Predicates>
+		inline constexpr bool
+		  is_attribute_where_v<attribute_where<Predicates...>> = true;
+
+		template<typename>
+		inline constexpr bool is_content_text_where_v = false;
+
+		template<typename... Predicates>
+		inline constexpr bool
+		  is_content_text_where_v<content_text_where<Predicates...>> = true;
+
+		/// Matchers that are not merged with others and run last
+		template<typename Matcher>
+		inline constexpr bool is_other_v =
+		  not is_tag_check_v<Matcher> and not is_attribute_where_v<Matcher> and
+		  not is_content_text_where_v<Matcher>;
+
+		template<typename... Matchers>
+		inline constexpr std::size_t attribute_where_count_v =
+		  ( std::size_t{ 0 } + ... +
+		    static_cast<std::size_t>( is_attribute_where_v<Matchers> ) );
+
+		template<typename... Matchers>
+		inline constexpr bool has_content_text_where_v =
+		  ( is_content_text_where_v<Matchers> or ... );
+
+		/// The stages below test only the matchers of their kind.  Others return
+		/// Otherwise so they do not change the result of the fold
+		template<bool Otherwise, typename Matcher>
+		constexpr bool test_tag( Matcher const &matcher, GumboNode const &node ) {
+			if constexpr( is_tag_check_v<Matcher> ) {
+				return matcher( node );
+			} else {
+				return Otherwise;
+			}
+		}
+
+		template<bool Otherwise, typename Matcher>
+		constexpr bool test_other( Matcher const &matcher,
+		                           GumboNode const &node ) {
+			if constexpr( is_other_v<Matcher> ) {
+				return static_cast<bool>( matcher( node ) );
+			} else {
+				return Otherwise;
+			}
+		}
+
+		template<bool Otherwise, typename Matcher>
+		constexpr bool test_text( Matcher const &matcher, daw::string_view text ) {
+			if constexpr( is_content_text_where_v<Matcher> ) {
+				return matcher.test( text );
+			} else {
+				return Otherwise;
+			}
+		}
+
+		/// Test an attribute against a matcher of match_all that no attribute has
+		/// satisfied yet.  Each attribute matcher owns a bit of found
+		template<typename Matcher>
+		constexpr void test_attribute_all( Matcher const &matcher,
+		                                   daw::string_view name,
+		                                   daw::string_view value,
+		                                   std::uint64_t &found,
+		                                   std::uint64_t &bit ) {
+			if constexpr( is_attribute_where_v<Matcher> ) {
+				if( ( found & bit ) == 0 and matcher.test( name, value ) ) {
+					found |= bit;
+				}
+				bit <<= 1U;
+			}
+		}
+
+		template<typename Matcher>
+		constexpr bool test_attribute_any( Matcher const &matcher,
+		                                   daw::string_view name,
+		                                   daw::string_view value ) {
+			if constexpr( is_attribute_where_v<Matcher> ) {
+				return matcher.test( name, value );
+			} else {
+				return false;
+			}
+		}
+
+		/// Scan the attributes of node once, testing each against all the
+		/// attribute matchers.  True when every one was satisfied by some
+		/// attribute
+		template<typename... Matchers>
+		constexpr bool all_attributes( GumboNode const &node,
+		                               Matchers const &...matchers ) {
+			constexpr std::size_t count = attribute_where_count_v<Matchers...>;
+			static_assert( count <= 64U,
+			               "Only 64 attribute matchers can be merged in one scan" );
+			constexpr std::uint64_t all_found =
+			  count == 64U ? ~std::uint64_t{ 0 }
+			               : ( std::uint64_t{ 1 } << count ) - 1U;
+			std::uint64_t found = 0;
+			auto const attr_count = get_attribute_count( node );
+			for( std::size_t n = 0; n < attr_count; ++n ) {
+				auto const *attr = get_attribute_node_at( node, n );
+				auto const name = daw::string_view( attr->name );
+				auto const value = daw::string_view( attr->value );
+				std::uint64_t bit = 1;
+				( test_attribute_all( matchers, name, value, found, bit ), ... );
+				if( found == all_found ) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/// Scan the attributes of node once.  True when any attribute satisfies
+		/// any of the attribute matchers
+		template<typename... Matchers>
+		constexpr bool any_attribute( GumboNode const &node,
+		                              Matchers const &...matchers ) {
+			auto const attr_count = get_attribute_count( node );
+			for( std::size_t n = 0; n < attr_count; ++n ) {
+				auto const *attr = get_attribute_node_at( node, n );
+				auto const name = daw::string_view( attr->name );
+				auto const value = daw::string_view( attr->value );
+				if( ( test_attribute_any( matchers, name, value ) or ... ) ) {
+					return true;
+				}
+			}
+			return false;
+		}
+	} // namespace compile_details
+
+	/// A match_all after compile_matcher.  The matchers are run in stages, each
+	/// paying for its shared work once per node: tag checks, then one scan of
+	/// the attributes for all the attribute matchers, then the content text is
+	/// built once for all the content text matchers, then the rest in order
+	template<typename... Matchers>
+	struct compiled_all {
+		static constexpr matcher_cost cost =
+		  cost_details::max_cost<Matchers...>( );
+
+		daw::tuple2<Matchers...> m_matchers;
+
+		constexpr bool operator( )( GumboNode const &node ) const {
+			using namespace compile_details;
+			return daw::apply( m_matchers, [&]( auto const &...matchers ) -> bool {
+				if( not( test_tag<true>( matchers, node ) and ... ) ) {
+					return false;
+				}
+				if constexpr( attribute_where_count_v<Matchers...> > 0 ) {
+					if( not all_attributes( node, matchers... ) ) {
+						return false;
+					}
+				}
+				if constexpr( has_content_text_where_v<Matchers...> ) {
+					auto const text = text_details::content_text_scratch( node );
+					if( not( test_text<true>( matchers, text ) and ... ) ) {
+						return false;
+					}
+				}
+				return ( test_other<true>( matchers, node ) and ... );
+			} );
+		}
+	};
+
+	/// A match_any after compile_matcher.  The stages are the same as
+	/// compiled_all, stopping at the first matcher that is satisfied
+	template<typename... Matchers>
+	struct compiled_any {
+		static constexpr matcher_cost cost =
+		  cost_details::max_cost<Matchers...>( );
+
+		daw::tuple2<Matchers...> m_matchers;
+
+		constexpr bool operator( )( GumboNode const &node ) const {
+			using namespace compile_details;
+			return daw::apply( m_matchers, [&]( auto const &...matchers ) -> bool {
+				if( ( test_tag<false>( matchers, node ) or ... ) ) {
+					return true;
+				}
+				if constexpr( attribute_where_count_v<Matchers...> > 0 ) {
+					if( any_attribute( node, matchers... ) ) {
+						return true;
+					}
+				}
+				if constexpr( has_content_text_where_v<Matchers...> ) {
+					auto const text = text_details::content_text_scratch( node );
+					if( ( test_text<false>( matchers, text ) or ... ) ) {
+						return true;
+					}
+				}
+				return ( test_other<false>( matchers, node ) or ... );
+			} );
+		}
+	};
+
+	template<typename Matcher>
+	constexpr Matcher compile_matcher( Matcher const &matcher );
+
+	template<typename... Matchers>
+	constexpr auto compile_matcher( match_all<Matchers...> const &matcher );
+
+	template<typename... Matchers>
+	constexpr auto compile_matcher( match_any<Matchers...> const &matcher );
+
+	template<typename... Matchers>
+	constexpr auto compile_matcher( match_one<Matchers...> const &matcher );
+
+	template<typename Matcher>
+	constexpr auto compile_matcher( match_not<Matcher> const &matcher );
+
+	/// Matchers other than the combinators are already a single step
+	template<typename Matcher>
+	constexpr Matcher compile_matcher( Matcher const &matcher ) {
+		return matcher;
+	}
+
+	/// Flatten a combined matcher so that work shared by its matchers is done
+	/// once per node.  Attribute matchers, created by match::attribute::where
+	/// and the class and id matchers built on it, are merged into one scan of
+	/// the attributes.  Content text matchers are merged so the text is built
+	/// once.  Tag checks run first as they are the cheapest.  The result
+	/// matches the same nodes as matcher.  The merged scan tests every
+	/// attribute matcher, so it pays off when the nodes left by the tag checks
+	/// mostly match.  A leading attribute matcher that rejects most nodes can
+	/// fail sooner uncompiled
+	template<typename... Matchers>
+	constexpr auto compile_matcher( match_all<Matchers...> const &matcher ) {
+		return daw::apply( matcher.m_matchers, []( auto const &...matchers ) {
+			return compiled_all<decltype( compile_matcher( matchers ) )...>{
+			  { compile_matcher( matchers )... } };
+		} );
+	}
+
+	template<typename... Matchers>
+	constexpr auto compile_matcher( match_any<Matchers...> const &matcher ) {
+		return daw::apply( matcher.m_matchers, []( auto const &...matchers ) {
+			return compiled_any<decltype( compile_matcher( matchers ) )...>{
+			  { compile_matcher( matchers )... } };
+		} );
+	}
+
+	/// Exactly one of the matchers must match, so all of them are run.  Only
+	/// the matchers inside are compiled
+	template<typename... Matchers>
+	constexpr auto compile_matcher( match_one<Matchers...> const &matcher ) {
+		return daw::apply( matcher.m_matchers, []( auto const &...matchers ) {
+			return match_one<decltype( compile_matcher( matchers ) )...>(
+			  compile_matcher( matchers )... );
+		} );
+	}
+
+	template<typename Matcher>
+	constexpr auto compile_matcher( match_not<Matcher> const &matcher ) {
+		return match_not{ compile_matcher( matcher.matcher( ) ) };
+	}
+} // namespace daw::gumbo
@@ -10,24 +10,114 @@
 
 #include "details/find_attrib_if_impl.h"
 #include "details/gumbo_pp.h"
+#include "gumbo_content_text_index.h"
+#include "gumbo_flat_document.h"
+#include "gumbo_keyword_set.h"
 #include "gumbo_node_iterator.h"
 #include "gumbo_text.h"
+#include "gumbo_util.h"
 
 #include <daw/daw_logic.h>
 #include <daw/daw_move.h>
 #include <daw/daw_string_view.h>
 #include <daw/daw_tuple2.h>
 
+#include <array>
 #include <cstddef>
 #include <functional>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 namespace daw::gumbo {
+	/// How expensive a matcher is to run on a node.  match_all and match_any
+	/// run cheaper matchers first
+	enum class matcher_cost : unsigned {
+		/// Checks of the node's type or tag
+		tag,
+		/// Scans of the node's attributes, and matchers with no cost
+		attribute,
+		/// Matchers that build or search the text of the node's subtree
+		text
+	};
+
+	namespace cost_details {
+		template<typename Matcher, typename = void>
+		struct cost_of {
+			static constexpr matcher_cost value = matcher_cost::attribute;
+		};
+
+		template<typename Matcher>
+		struct cost_of<Matcher, std::void_t<decltype( Matcher::cost )>> {
+			static constexpr matcher_cost value = Matcher::cost;
+		};
+	} // namespace cost_details
+
+	/// The cost of a matcher, from its static cost member.  Matchers without
+	/// one, like lambdas, are assumed to cost as much as an attribute scan
+	template<typename Matcher>
+	inline constexpr matcher_cost matcher_cost_v =
+	  cost_details::cost_of<daw::remove_cvref_t<Matcher>>::value;
+
+	namespace cost_details {
+		template<typename... Matchers>
+		constexpr matcher_cost max_cost( ) {
+			matcher_cost result = matcher_cost::tag;
+			for( matcher_cost c :
+			     { matcher_cost::tag, matcher_cost_v<Matchers>... } ) {
+				if( c > result ) {
+					result = c;
+				}
+			}
+			return result;
+		}
+
+		/// The indices of the matchers sorted by cost.  The sort is stable, so
+		/// matchers of the same cost keep the order they were written in
+		template<typename... Matchers>
+		constexpr std::array<std::size_t, sizeof...( Matchers )> cost_order( ) {
+			constexpr std::size_t count = sizeof...( Matchers );
+			std::array<matcher_cost, count> costs{ matcher_cost_v<Matchers>... };
+			std::array<std::size_t, count> result{ };
+			for( std::size_t n = 0; n < count; ++n ) {
+				std::size_t pos = n;
+				while( pos > 0 and costs[result[pos - 1U]] > costs[n] ) {
+					result[pos] = result[pos - 1U];
+					--pos;
+				}
+				result[pos] = n;
+			}
+			return result;
+		}
+
+		template<typename... Matchers>
+		inline constexpr auto cost_order_v = cost_order<Matchers...>( );
+	} // namespace cost_details
+
+	/// Give a matcher, like a lambda, a cost so that match_all and match_any
+	/// order it correctly
+	template<matcher_cost Cost, typename Matcher>
+	struct costed_matcher : Matcher {
+		static constexpr matcher_cost cost = Cost;
+
+		explicit constexpr costed_matcher( Matcher const &matcher )
+		  : Matcher( matcher ) {}
+	};
+
+	template<matcher_cost Cost, typename Matcher>
+	constexpr costed_matcher<Cost, daw::remove_cvref_t<Matcher>>
+	with_cost( Matcher &&matcher ) {
+		return costed_matcher<Cost, daw::remove_cvref_t<Matcher>>( matcher );
+	}
+
 	// A combined predicate that returns true when all of it's predicates return
-	// true
+	// true.  The predicates are run cheapest first, by matcher_cost, so they
+	// must not depend on being called in the order written
 	template<typename... Matchers>
 	struct match_all {
+		static constexpr matcher_cost cost =
+		  cost_details::max_cost<Matchers...>( );
+
 		daw::tuple2<Matchers...> m_matchers;
 
 		constexpr match_all( daw::tuple2<Matchers...> &&m )
@@ -41,8 +131,10 @@ namespace daw::gumbo {
 
 		template<typename Node>
 		constexpr bool operator( )( Node const &node ) const {
-			return daw::apply( m_matchers, [&]( auto &&...matchers ) -> bool {
-				return ( DAW_FWD( matchers )( node ) and ... );
+			return daw::apply( m_matchers, [&]( auto const &...matchers ) -> bool {
+				return run( std::tie( matchers... ),
+				            node,
+				            std::make_index_sequence<sizeof...( Matchers )>{ } );
 			} );
 		}
 
@@ -57,13 +149,26 @@ namespace daw::gumbo {
 		append( match_all<Ms...> const &other ) const {
 			return { daw::tuple2_cat( m_matchers, other.m_matchers ) };
 		}
+
+	private:
+		template<typename Tuple, typename Node, std::size_t... Is>
+		static constexpr bool
+		run( Tuple const &matchers, Node const &node, std::index_sequence<Is...> ) {
+			constexpr auto order = cost_details::cost_order_v<Matchers...>;
+			return (
+			  static_cast<bool>( std::get<order[Is]>( matchers )( node ) ) and ... );
+		}
 	};
 	template<typename... Matchers>
 	match_all( Matchers... ) -> match_all<Matchers...>;
 
-	// A combined predicate that returns true if any of the predicates return true
+	// A combined predicate that returns true if any of the predicates return
+	// true.  Like match_all, the predicates are run cheapest first
 	template<typename... Matchers>
 	struct match_any {
+		static constexpr matcher_cost cost =
+		  cost_details::max_cost<Matchers...>( );
+
 		daw::tuple2<Matchers...> m_matchers;
 
 		constexpr match_any( daw::tuple2<Matchers...> &&m )
@@ -77,8 +182,10 @@ namespace daw::gumbo {
 
 		template<typename Node>
 		constexpr bool operator( )( Node const &node ) const {
-			return daw::apply( m_matchers, [&]( auto &&...matchers ) -> bool {
-				return ( DAW_FWD( matchers )( node ) or ... );
+			return daw::apply( m_matchers, [&]( auto const &...matchers ) -> bool {
+				return run( std::tie( matchers... ),
+				            node,
+				            std::make_index_sequence<sizeof...( Matchers )>{ } );
 			} );
 		}
 
@@ -93,6 +200,15 @@ namespace daw::gumbo {
 		append( match_any<Ms...> const &other ) const {
 			return { daw::tuple2_cat( m_matchers, other.m_matchers ) };
 		}
+
+	private:
+		template<typename Tuple, typename Node, std::size_t... Is>
+		static constexpr bool
+		run( Tuple const &matchers, Node const &node, std::index_sequence<Is...> ) {
+			constexpr auto order = cost_details::cost_order_v<Matchers...>;
+			return (
+			  static_cast<bool>( std::get<order[Is]>( matchers )( node ) ) or ... );
+		}
 	};
 
 	template<typename... Matchers>
@@ -100,6 +216,9 @@ namespace daw::gumbo {
 
 	template<typename... Matchers>
 	struct match_one {
+		static constexpr matcher_cost cost =
+		  cost_details::max_cost<Matchers...>( );
+
 		daw::tuple2<Matchers...> m_matchers;
 
 		constexpr match_one( daw::tuple2<Matchers...> &&m )
@@ -137,6 +256,8 @@ namespace daw::gumbo {
 	class match_not : private Matcher {
 
 	public:
+		static constexpr matcher_cost cost = matcher_cost_v<Matcher>;
+
 		explicit constexpr match_not( Matcher &&matcher )
 		  : Matcher{ std::move( matcher ) } {}
 
@@ -147,10 +268,81 @@ namespace daw::gumbo {
 		constexpr bool operator( )( Node const &node ) const {
 			return not Matcher::operator( )( node );
 		}
+
+		/// The matcher that is negated
+		constexpr Matcher const &matcher( ) const noexcept {
+			return *this;
+		}
 	};
 	template<typename Matcher>
 	match_not( Matcher ) -> match_not<Matcher>;
 
+	/// Match any node that has an attribute where all the predicates return
+	/// true.  The predicates are called with the name and value of the
+	/// attribute.  It is a named type, unlike most matchers, so that
+	/// compile_matcher can find the attribute matchers of a combined matcher
+	/// and test them all in one scan of the attributes
+	template<typename... Predicates>
+	struct attribute_where {
+		static constexpr matcher_cost cost = matcher_cost::attribute;
+
+		daw::tuple2<Predicates...> m_predicates;
+
+		/// Does the attribute satisfy all the predicates
+		constexpr bool test( daw::string_view name,
+		                     daw::string_view value ) const {
+			return daw::apply( m_predicates, [&]( auto const &...preds ) -> bool {
+				return ( preds( name, value ) and ... );
+			} );
+		}
+
+		constexpr bool operator( )( GumboNode const &node ) const {
+			return details::find_attribute_if_impl(
+			         gumbo_node_iterator_t( &node ),
+			         [&]( GumboAttribute const &attr ) -> bool {
+				         return test( daw::string_view( attr.name ),
+				                      daw::string_view( attr.value ) );
+			         } )
+			  .found;
+		}
+
+		/// Test the attributes of a flat_document node in its flat arrays
+		bool operator( )( flat_node node ) const {
+			auto const &doc = node.document( );
+			auto const *last = doc.attributes_end( node.index( ) );
+			for( auto const *attr = doc.attributes_begin( node.index( ) );
+			     attr != last;
+			     ++attr ) {
+				if( test( doc.attribute_name( *attr ),
+				          doc.attribute_value( *attr ) ) ) {
+					return true;
+				}
+			}
+			return false;
+		}
+	};
+
+	/// Match any node whose content text satisfies all the predicates.  Like
+	/// attribute_where it is a named type so that compile_matcher can build the
+	/// content text once for all the text matchers of a combined matcher
+	template<typename... Predicates>
+	struct content_text_where {
+		static constexpr matcher_cost cost = matcher_cost::text;
+
+		daw::tuple2<Predicates...> m_predicates;
+
+		/// Does the text satisfy all the predicates
+		constexpr bool test( daw::string_view text ) const {
+			return daw::apply( m_predicates, [&]( auto const &...preds ) -> bool {
+				return ( preds( text ) and ... );
+			} );
+		}
+
+		template<typename Node>
+		constexpr bool operator( )( Node const &node ) const {
+			return test( text_details::content_text_scratch( node ) );
+		}
+	};
 } // namespace daw::gumbo
 namespace daw::gumbo::match_details {
 	namespace match_attribute {
@@ -158,17 +350,9 @@ namespace daw::gumbo::match_details {
 		/// true
 		template<typename Predicate, typename... Predicates>
 		constexpr auto where( Predicate &&pred, Predicates &&...preds ) noexcept {
-			return [=]( GumboNode const &node ) -> bool {
-				return details::find_attribute_if_impl(
-				         gumbo_node_iterator_t( &node ),
-				         [&]( GumboAttribute const &attr ) -> bool {
-					         auto name = daw::string_view( attr.name );
-					         auto value = daw::string_view( attr.value );
-					         return pred( name, value ) and
-					                ( preds( name, value ) and ... );
-				         } )
-				  .found;
-			};
+			return attribute_where<daw::remove_cvref_t<Predicate>,
+			                       daw::remove_cvref_t<Predicates>...>{
+			  { pred, preds... } };
 		}
 
 		/// Match any node that does not have any attributes
@@ -187,26 +371,20 @@ namespace daw::gumbo::match_details {
 		           daw::traits::is_container_like_v<daw::remove_cvref_t<Container>>,
 		           std::nullptr_t> = nullptr>
 		constexpr auto exists( Container &&c ) noexcept {
-			return [=]( auto const &node ) {
+			return where( [=]( daw::string_view name, daw::string_view ) noexcept {
 				auto first = std::begin( c );
 				auto last = std::end( c );
-				if( first == last ) {
-					return false;
-				}
-				return std::find_if( first, last, [&]( daw::string_view name ) {
-					       return attribute_exists( node, name );
-				       } ) != last;
-			};
+				return std::find( first, last, name ) != last;
+			} );
 		}
 
 		/// Match any node that has any of these attributes
 		template<typename... StringView>
-		constexpr auto exists( daw::string_view name,
-		                       StringView &&...names ) noexcept {
-			return [=]( auto const &node ) {
-				return attribute_exists( node, name ) or
-				       ( attribute_exists( node, names ) or ... );
-			};
+		constexpr auto exists( daw::string_view attribute_name,
+		                       StringView &&...attribute_names ) noexcept {
+			return where( [=]( daw::string_view name, daw::string_view ) noexcept {
+				return name == attribute_name or ( ( name == attribute_names ) or ... );
+			} );
 		}
 
 		namespace name {
@@ -298,6 +476,16 @@ namespace daw::gumbo::match_details {
 				  } );
 			}
 
+			/// Match any node with named attribute who's value contains any of the
+			/// keywords.  The value is searched for all of them in one pass
+			inline auto contains( daw::string_view attribute_name,
+			                      keyword_set const &keywords ) {
+				return where(
+				  [=]( daw::string_view name, daw::string_view value ) -> bool {
+					  return name == attribute_name and keywords.contains_any( value );
+				  } );
+			}
+
 			/// Match any node with named attribute who's value starts with one of the
 			/// specified values
 			template<typename Container,
@@ -474,6 +662,36 @@ namespace daw::gumbo::match_details {
 				           ( ( attribute_value == class_names ) or ... ) );
 			  } );
 		}
+
+		/// Match any node whose class list has a token equal to one of the names.
+		/// Unlike is, class="btn primary" matches has( "btn" )
+		template<typename... StringView>
+		constexpr auto has( daw::string_view class_name,
+		                    StringView &&...class_names ) noexcept {
+			return match_attribute::where(
+			  [=]( daw::string_view attribute_name,
+			       daw::string_view attribute_value ) noexcept -> bool {
+				  return attribute_name == "class" and
+				         ( class_list_contains( attribute_value, class_name ) or
+				           ( class_list_contains( attribute_value, class_names ) or
+				             ... ) );
+			  } );
+		}
+
+		/// Match any node whose class list has a token equal to each of the names,
+		/// like the CSS selector .a.b
+		template<typename... StringView>
+		constexpr auto has_all( daw::string_view class_name,
+		                        StringView &&...class_names ) noexcept {
+			return match_attribute::where(
+			  [=]( daw::string_view attribute_name,
+			       daw::string_view attribute_value ) noexcept -> bool {
+				  return attribute_name == "class" and
+				         class_list_contains( attribute_value, class_name ) and
+				         ( class_list_contains( attribute_value, class_names ) and
+				           ... );
+			  } );
+		}
 	} // namespace match_class
 
 	namespace match_id {
@@ -505,22 +723,22 @@ namespace daw::gumbo::match_details {
 	// For matching the content of tags like A
 	namespace match_content_text {
 		/// Match any node with a id that returns true for the predicates
-		template<typename Predicate, typename... Predicates>
+		template<typename Predicate,
+		         typename... Predicates,
+		         std::enable_if_t<not std::is_same_v<daw::remove_cvref_t<Predicate>,
+		                                             content_text_index>,
+		                          std::nullptr_t> = nullptr>
 		constexpr auto where( Predicate &&pred, Predicates &&...preds ) noexcept {
-			return [=]( auto const &node ) -> bool {
-				auto txt = node_content_text( node );
-				daw::string_view sv = txt;
-				return pred( sv ) and ( preds( sv ) and ... );
-			};
+			return content_text_where<daw::remove_cvref_t<Predicate>,
+			                          daw::remove_cvref_t<Predicates>...>{
+			  { pred, preds... } };
 		}
 
 		template<typename Map, typename Predicate>
 		constexpr auto map( Map &&map, Predicate &&pred ) noexcept {
-			return [=]( auto const &node ) -> bool {
-				auto txt = node_content_text( node );
-				daw::string_view sv = txt;
+			return where( [=]( daw::string_view sv ) -> bool {
 				return pred( map( sv ) );
-			};
+			} );
 		}
 
 		template<typename Container,
@@ -528,8 +746,7 @@ namespace daw::gumbo::match_details {
 		           daw::traits::is_container_like_v<daw::remove_cvref_t<Container>>,
 		           std::nullptr_t> = nullptr>
 		constexpr auto contains( Container &&c ) noexcept {
-			return [=]( auto const &node ) noexcept {
-				auto text = node_content_text( node );
+			return where( [=]( daw::string_view text ) noexcept {
 				if( text.empty( ) ) {
 					return false;
 				}
@@ -537,26 +754,35 @@ namespace daw::gumbo::match_details {
 				auto last = std::end( c );
 				auto const fpos =
 				  std::find_if( first, last, [&]( daw::string_view cur_text ) {
-					  return text.find( static_cast<std::string_view>( cur_text ) ) !=
-					         std::string::npos;
+					  return text.find( cur_text ) != daw::string_view::npos;
 				  } );
 				return fpos != last;
-			};
+			} );
 		}
 
 		template<typename... StringView>
 		constexpr auto contains( daw::string_view search_text,
 		                         StringView &&...search_texts ) noexcept {
-			return [=]( auto const &node ) noexcept -> bool {
-				auto text = node_content_text( node );
-				return ( text.find( search_text ) != std::string::npos ) or
-				       ( ( text.find( search_texts ) != std::string::npos ) or ... );
-			};
+			return where( [=]( daw::string_view text ) noexcept -> bool {
+				return ( text.find( search_text ) != daw::string_view::npos ) or
+				       ( ( text.find( search_texts ) != daw::string_view::npos ) or
+				         ... );
+			} );
 		}
 
-		inline constexpr auto is_empty = []( auto const &node ) noexcept -> bool {
-			return node_content_text( node ).empty( );
-		};
+		/// Match any node whose content text contains any of the keywords.  The
+		/// text is searched for all of them in one pass, which is much faster
+		/// than the container overload for long keyword lists
+		inline auto contains( keyword_set const &keywords ) {
+			return where( [=]( daw::string_view text ) -> bool {
+				return keywords.contains_any( text );
+			} );
+		}
+
+		inline constexpr auto is_empty = with_cost<matcher_cost::text>(
+		  []( auto const &node ) noexcept -> bool {
+			  return not has_content_text( node );
+		  } );
 
 		/// Match any node with outer text who's value starts with and of the
 		/// specified values
@@ -636,6 +862,59 @@ namespace daw::gumbo::match_details {
 				return ( text == match_text ) or ( ( text == match_texts ) or ... );
 			} );
 		}
+
+		/// Match any node whose content text returns true for the predicates.  The
+		/// text is looked up in a content_text_index of the document instead of
+		/// being built for each node tested
+		template<typename Predicate, typename... Predicates>
+		auto where( content_text_index const &idx,
+		            Predicate &&pred,
+		            Predicates &&...preds ) noexcept {
+			return [&idx, pred, preds...]( auto const &node ) -> bool {
+				daw::string_view sv = idx.text( node );
+				return pred( sv ) and ( preds( sv ) and ... );
+			};
+		}
+
+		template<typename... StringView>
+		auto contains( content_text_index const &idx,
+		               daw::string_view search_text,
+		               StringView &&...search_texts ) noexcept {
+			return where( idx, [=]( daw::string_view text ) noexcept -> bool {
+				return ( text.find( search_text ) != daw::string_view::npos ) or
+				       ( ( text.find( search_texts ) != daw::string_view::npos ) or
+				         ... );
+			} );
+		}
+
+		template<typename... StringView>
+		auto starts_with( content_text_index const &idx,
+		                  daw::string_view prefix_text,
+		                  StringView &&...prefix_texts ) noexcept {
+			return where( idx, [=]( daw::string_view text ) noexcept -> bool {
+				return text.starts_with( prefix_text ) or
+				       ( text.starts_with( prefix_texts ) or ... );
+			} );
+		}
+
+		template<typename... StringView>
+		auto ends_with( content_text_index const &idx,
+		                daw::string_view suffix_text,
+		                StringView &&...suffix_texts ) noexcept {
+			return where( idx, [=]( daw::string_view text ) noexcept -> bool {
+				return text.ends_with( suffix_text ) or
+				       ( text.ends_with( suffix_texts ) or ... );
+			} );
+		}
+
+		template<typename... StringView>
+		auto is( content_text_index const &idx,
+		         daw::string_view match_text,
+		         StringView &&...match_texts ) noexcept {
+			return where( idx, [=]( daw::string_view text ) noexcept -> bool {
+				return text == match_text or ( ( text == match_texts ) or ... );
+			} );
+		}
 	} // namespace match_content_text
 
 	namespace match_inner_text {
@@ -685,6 +964,15 @@ namespace daw::gumbo::match_details {
 			} );
 		}
 
+		/// Match any node with inner_text that contains any of the keywords,
+		/// searched for in one pass
+		inline auto contains( daw::string_view html_doc,
+		                      keyword_set const &keywords ) {
+			return where( html_doc, [=]( daw::string_view text ) -> bool {
+				return keywords.contains_any( text );
+			} );
+		}
+
 		/// Match any node with inner text who's value starts with the specified
 		/// values
 		template<typename Container,
@@ -903,25 +1191,55 @@ namespace daw::gumbo::match_details {
 		/// true
 		template<typename Predicate, typename... Predicates>
 		constexpr auto where( Predicate &&pred, Predicates &&...preds ) noexcept {
-			return [=]( auto const &node ) noexcept -> bool {
+			return with_cost<matcher_cost::tag>(
+			  [=]( auto const &node ) -> bool {
+				  if constexpr( std::is_same_v<daw::remove_cvref_t<decltype( node )>,
+				                               flat_node> ) {
+					  if( node.type( ) != GUMBO_NODE_ELEMENT ) {
+						  return false;
+					  }
+					  auto tag_value = node.tag( );
+					  return pred( tag_value ) and ( preds( tag_value ) and ... );
+				  } else {
+					  GumboNode const &gnode = node;
+					  if( gnode.type != GUMBO_NODE_ELEMENT ) {
+						  return false;
+					  }
+					  auto tag_value = gnode.v.element.tag;
+					  return pred( tag_value ) and ( preds( tag_value ) and ... );
+				  }
+			  } );
+		}
+
+		/// Match any node with where the tag type where the tag type matches on
+		/// of the specified types.  The tags are part of the type so that indexes
+		/// like tag_index can find the candidates without visiting every node
+		template<GumboTag... tags>
+		struct types_t {
+			static constexpr matcher_cost cost = matcher_cost::tag;
+
+			constexpr bool operator( )( GumboNode const &node ) const noexcept {
 				if( node.type != GUMBO_NODE_ELEMENT ) {
 					return false;
 				}
-				auto tag_value = node.v.element.tag;
-				return pred( tag_value ) and ( preds( tag_value ) and ... );
-			};
-		}
+				GumboTag const tag_value = node.v.element.tag;
+				return ( ( tag_value == tags ) | ... );
+			}
+
+			/// Read the type and tag of a flat_document node from its flat arrays
+			bool operator( )( flat_node node ) const {
+				if( node.type( ) != GUMBO_NODE_ELEMENT ) {
+					return false;
+				}
+				GumboTag const tag_value = node.tag( );
+				return ( ( tag_value == tags ) | ... );
+			}
+		};
 
 		/// Match any node with where the tag type where the tag type matches on
 		/// of the specified types
 		template<GumboTag... tags>
-		inline constexpr auto types = []( GumboNode const &node ) -> bool {
-			if( node.type != GUMBO_NODE_ELEMENT ) {
-				return false;
-			}
-			GumboTag const tag_value = node.v.element.tag;
-			return ( ( tag_value == tags ) | ... );
-		};
+		inline constexpr types_t<tags...> types{ };
 
 		inline constexpr auto HTML = types<GumboTag::GUMBO_TAG_HTML>;
 		inline constexpr auto HEAD = types<GumboTag::GUMBO_TAG_HEAD>;
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "details/gumbo_pp.h"
+#include "gumbo_arena.h"
+#include "gumbo_handle.h"
 #include "gumbo_util.h"
 
 #include <daw/daw_not_null.h>
@@ -17,6 +19,7 @@
 #include <cstddef>
 #include <gumbo.h>
 #include <iterator>
+#include <memory>
 
 namespace daw::gumbo {
 	struct gumbo_node_iterator_t {
@@ -214,16 +217,71 @@ namespace daw::gumbo {
 	};
 
 	class gumbo_range {
+		// Keeps the memory m_html refers to alive when the range owns it.  Must be
+		// destroyed after m_handle as the output refers to it too
+		std::shared_ptr<void const> m_source{ };
+		daw::string_view m_html{ };
 		GumboHandle m_handle;
 		gumbo_node_iterator_t m_first{ };
 		gumbo_node_iterator_t m_last{ };
 
+		explicit gumbo_range( std::shared_ptr<void const> source,
+		                      daw::string_view html_document,
+		                      GumboOptions options );
+
 	public:
 		explicit gumbo_range( GumboHandle &&handle );
+		explicit gumbo_range( GumboHandle &&handle,
+		                      daw::string_view html_document );
 		explicit gumbo_range( daw::string_view html_document,
 		                      GumboOptions options );
 		explicit gumbo_range( daw::string_view html_document );
 
+		/// Parse the document into arena.  The arena must outlive the range and
+		/// is reset once the last range parsed into it is destroyed
+		explicit gumbo_range( daw::string_view html_document,
+		                      gumbo_arena &arena,
+		                      GumboOptions options );
+		explicit gumbo_range( daw::string_view html_document,
+		                      gumbo_arena &arena );
+
+		/// Memory map the file and parse it in place.  The mapping lives as long
+		/// as the range, so html( ) and the text of the nodes can be used without
+		/// keeping a copy of the file around.  An empty file, which cannot be
+		/// mapped, is parsed as an empty document.  Throws std::runtime_error
+		/// when the file cannot be mapped otherwise, like when it does not exist
+		[[nodiscard]] static gumbo_range
+		from_file( daw::string_view path,
+		           GumboOptions options = kGumboDefaultOptions );
+
+		/// Parse only the head section of the document, as found by
+		/// head_section_prefix.  The tree has the full document structure with an
+		/// empty body, so all matchers work on it
+		[[nodiscard]] static gumbo_range
+		head_only( daw::string_view html_document,
+		           std::size_t max_prefix = default_max_head_prefix,
+		           GumboOptions options = kGumboDefaultOptions );
+
+		/// Parse a document in any encoding supported by to_utf8.  Valid UTF-8 is
+		/// parsed in place and the caller must keep raw_document alive.  Other
+		/// encodings are transcoded into a buffer owned by the range.  Throws
+		/// std::runtime_error when the document declares an unsupported
+		/// encoding, use sniff_encoding first to route those elsewhere
+		[[nodiscard]] static gumbo_range
+		from_bytes( daw::string_view raw_document,
+		            GumboOptions options = kGumboDefaultOptions );
+
+		/// The document that was parsed.  Empty when constructed from a handle
+		/// without it
+		[[nodiscard]] inline daw::string_view html( ) const {
+			return m_html;
+		}
+
+		/// The owner of the memory html( ) refers to, when the range owns it
+		[[nodiscard]] inline std::shared_ptr<void const> const &source( ) const {
+			return m_source;
+		}
+
 		[[nodiscard]] inline gumbo_node_iterator_t begin( ) const {
 			return m_first;
 		}
@@ -236,14 +294,26 @@ namespace daw::gumbo {
 			return m_handle.get( );
 		}
 
+		[[nodiscard]] inline GumboOutput const *get( ) const {
+			return m_handle.get( );
+		}
+
 		[[nodiscard]] inline GumboNode *document( ) {
 			return m_handle->document;
 		}
 
+		[[nodiscard]] inline GumboNode const *document( ) const {
+			return m_handle->document;
+		}
+
 		[[nodiscard]] inline GumboNode *root( ) {
 			return m_handle->root;
 		}
 
+		[[nodiscard]] inline GumboNode const *root( ) const {
+			return m_handle->root;
+		}
+
 		[[nodiscard]] inline GumboVector errors( ) {
 			return m_handle->errors;
 		}
@@ -265,6 +335,51 @@ namespace daw::gumbo {
 		}
 	};
 
+	/// The first node after node and all of its descendants in document order,
+	/// or the end iterator when there is none
+	[[nodiscard]] constexpr gumbo_node_iterator_t
+	subtree_end( GumboNode const &node ) noexcept {
+		GumboNode const *cur_node = &node;
+		while( cur_node->parent ) {
+			GumboNode const *parent = cur_node->parent;
+			auto const next_idx = cur_node->index_within_parent + 1U;
+			if( next_idx < get_children_count( *parent ) ) {
+				return gumbo_node_iterator_t( get_child_node_at( *parent, next_idx ) );
+			}
+			cur_node = parent;
+		}
+		return gumbo_node_iterator_t{ };
+	}
+
+	/// The descendants of a node in document order, not including the node.
+	/// Iteration stops at the end of the node's subtree instead of continuing
+	/// to the end of the document
+	class gumbo_descendant_range {
+		gumbo_node_iterator_t m_first{ };
+		gumbo_node_iterator_t m_last{ };
+
+	public:
+		explicit gumbo_descendant_range( GumboNode const &node );
+
+		[[nodiscard]] inline gumbo_node_iterator_t begin( ) const {
+			return m_first;
+		}
+
+		[[nodiscard]] inline gumbo_node_iterator_t end( ) const {
+			return m_last;
+		}
+	};
+
+	[[nodiscard]] inline gumbo_descendant_range
+	descendants( GumboNode const &node ) {
+		return gumbo_descendant_range( node );
+	}
+
+	[[nodiscard]] inline gumbo_descendant_range
+	descendants( gumbo_node_iterator_t const &it ) {
+		return gumbo_descendant_range( *it );
+	}
+
 	template<typename Predicate>
 	constexpr void advance_until( gumbo_node_iterator_t &first,
 	                              gumbo_node_iterator_t const &last,
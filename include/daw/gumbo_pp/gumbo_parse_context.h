@@ -0,0 +1,75 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_arena.h"
+#include "gumbo_node_iterator.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <gumbo.h>
+#include <string>
+
+namespace daw::gumbo {
+	/// State that is kept warm between parses on a single thread: the arena the
+	/// documents are parsed into, the options used and scratch buffers.  Once the
+	/// context has seen a document of a given size, parsing another of similar
+	/// size does not call the system allocator.  Ranges returned by parse must
+	/// not outlive the context and a context must only be used from one thread
+	/// at a time
+	class parse_context {
+		gumbo_arena m_arena;
+		GumboOptions m_options;
+		std::string m_scratch{ };
+
+	public:
+		static constexpr std::size_t default_max_retained = 16U * 1024U * 1024U;
+
+		explicit parse_context(
+		  std::size_t max_retained_bytes = default_max_retained,
+		  GumboOptions const &options = kGumboDefaultOptions );
+
+		/// Parse the document into the context's arena
+		[[nodiscard]] gumbo_range parse( daw::string_view html_document );
+
+		[[nodiscard]] inline GumboOptions const &options( ) const noexcept {
+			return m_options;
+		}
+
+		inline void set_options( GumboOptions const &options ) noexcept {
+			m_options = options;
+		}
+
+		/// Upper bound on the memory held between documents.  When the last
+		/// range parsed by the context is destroyed, anything above this is
+		/// returned to the system
+		[[nodiscard]] inline std::size_t max_retained_bytes( ) const noexcept {
+			return m_arena.max_retained( );
+		}
+
+		void set_max_retained_bytes( std::size_t max_retained_bytes ) noexcept;
+
+		/// Pre-allocate and touch memory for documents of about document_size
+		/// bytes
+		void reserve( std::size_t document_size );
+
+		/// A cleared buffer that keeps its capacity between uses, within the
+		/// retained memory limit
+		[[nodiscard]] std::string &scratch_buffer( );
+
+		[[nodiscard]] inline gumbo_arena &arena( ) noexcept {
+			return m_arena;
+		}
+
+		/// The context owned by the calling thread
+		[[nodiscard]] static parse_context &this_thread( );
+	};
+} // namespace daw::gumbo
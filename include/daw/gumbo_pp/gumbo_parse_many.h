@@ -0,0 +1,120 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_node_iterator.h"
+#include "gumbo_parse_context.h"
+
+#include <daw/daw_string_view.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace daw::gumbo {
+	/// A fixed pool of threads for running bulk jobs.  Rather than splitting the
+	/// work up front, each thread takes the next index from a shared counter as
+	/// it finishes the last.  Document sizes vary by orders of magnitude so this
+	/// keeps all threads busy until the batch is exhausted.  The calling thread
+	/// participates in the work, so a thread_count of 1 runs inline
+	class parse_executor {
+		std::vector<std::thread> m_threads{ };
+		std::mutex m_mutex{ };
+		std::condition_variable m_work_cv{ };
+		std::condition_variable m_done_cv{ };
+		std::function<void( std::size_t )> const *m_job = nullptr;
+		std::size_t m_count = 0;
+		std::size_t m_generation = 0;
+		std::size_t m_active = 0;
+		std::atomic<std::size_t> m_next{ 0 };
+		std::exception_ptr m_exception{ };
+		bool m_stop = false;
+
+		void worker( );
+		void run_items( std::function<void( std::size_t )> const &job,
+		                std::size_t count );
+
+	public:
+		explicit parse_executor(
+		  std::size_t thread_count = std::thread::hardware_concurrency( ) );
+		~parse_executor( );
+
+		parse_executor( parse_executor const & ) = delete;
+		parse_executor &operator=( parse_executor const & ) = delete;
+		parse_executor( parse_executor && ) = delete;
+		parse_executor &operator=( parse_executor && ) = delete;
+
+		/// Number of threads work is run on, including the calling thread
+		[[nodiscard]] inline std::size_t thread_count( ) const noexcept {
+			return m_threads.size( ) + 1U;
+		}
+
+		/// Call job( n ) for each n in [0, count) and wait for them to complete.
+		/// If a job throws, the first exception is rethrown here after the rest
+		/// of the batch has finished
+		void bulk( std::size_t count,
+		           std::function<void( std::size_t )> const &job );
+	};
+
+	namespace parse_many_details {
+		/// The documents as views, so the jobs index them in constant time
+		/// whatever the container's iterators are
+		template<typename Container>
+		[[nodiscard]] std::vector<daw::string_view>
+		to_views( Container const &documents ) {
+			std::vector<daw::string_view> result{ };
+			for( auto const &document : documents ) {
+				result.emplace_back( document );
+			}
+			return result;
+		}
+	} // namespace parse_many_details
+
+	/// Parse each document on the executor.  The result is in the same order as
+	/// documents.  The documents must outlive the returned ranges
+	template<typename Container>
+	[[nodiscard]] std::vector<gumbo_range>
+	parse_many( Container const &documents, parse_executor &executor ) {
+		auto const views = parse_many_details::to_views( documents );
+		auto const count = views.size( );
+		std::vector<std::optional<gumbo_range>> slots( count );
+		executor.bulk( count, [&]( std::size_t n ) {
+			slots[n].emplace( views[n] );
+		} );
+		std::vector<gumbo_range> result{ };
+		result.reserve( count );
+		for( auto &slot : slots ) {
+			result.push_back( std::move( *slot ) );
+		}
+		return result;
+	}
+
+	/// Parse each document on the executor and call on_parsed( index, range )
+	/// as each one finishes.  on_parsed is called concurrently from the
+	/// executor's threads and the range is destroyed once it returns, which lets
+	/// each document be parsed into the thread's parse_context
+	template<typename Container, typename Callback>
+	void parse_many( Container const &documents,
+	                 parse_executor &executor,
+	                 Callback &&on_parsed ) {
+		auto const views = parse_many_details::to_views( documents );
+		executor.bulk( views.size( ), [&]( std::size_t n ) {
+			gumbo_range rng = parse_context::this_thread( ).parse( views[n] );
+			on_parsed( n, rng );
+		} );
+	}
+} // namespace daw::gumbo
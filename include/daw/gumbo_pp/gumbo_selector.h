@@ -0,0 +1,168 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_node_iterator.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace daw::gumbo {
+	/// Thrown when a selector cannot be parsed
+	class css_selector_error : public std::runtime_error {
+		std::size_t m_position;
+
+	public:
+		css_selector_error( std::string const &message, std::size_t position );
+
+		/// Offset into the selector where parsing failed
+		[[nodiscard]] inline std::size_t position( ) const noexcept {
+			return m_position;
+		}
+	};
+
+	namespace selector_details {
+		enum class attribute_op : std::uint8_t {
+			exists,     // [name]
+			equals,     // [name=value]
+			includes,   // [name~=value]
+			dash_match, // [name|=value]
+			prefix,     // [name^=value]
+			suffix,     // [name$=value]
+			substring   // [name*=value]
+		};
+
+		struct attribute_test {
+			std::string name;
+			std::string value;
+			attribute_op op = attribute_op::exists;
+			bool ignore_case = false;
+		};
+
+		enum class pseudo_kind : std::uint8_t {
+			nth_child,
+			nth_last_child,
+			nth_of_type,
+			nth_last_of_type,
+			only_child,
+			only_of_type,
+			empty,
+			root,
+			is,
+			not_
+		};
+
+		struct compound;
+
+		struct pseudo_test {
+			pseudo_kind kind = pseudo_kind::root;
+			// an+b of the nth pseudo classes
+			std::int32_t a = 0;
+			std::int32_t b = 0;
+			// The compound selectors of :is( ) and :not( )
+			std::vector<compound> selectors{ };
+		};
+
+		/// How a compound relates to the compound on its right
+		enum class combinator : std::uint8_t {
+			descendant, // a b
+			child,      // a > b
+			adjacent,   // a + b
+			sibling     // a ~ b
+		};
+
+		/// A sequence of simple selectors like div#main.wide[title]
+		struct compound {
+			/// GUMBO_TAG_LAST matches any element.  GUMBO_TAG_UNKNOWN is compared
+			/// by tag_name
+			GumboTag tag = GUMBO_TAG_LAST;
+			std::string tag_name{ };
+			std::vector<attribute_test> attributes{ };
+			std::vector<pseudo_test> pseudos{ };
+			combinator next = combinator::descendant;
+		};
+
+		/// The compounds of a selector like div > p a, left to right
+		struct complex_selector {
+			std::vector<compound> compounds{ };
+		};
+	} // namespace selector_details
+
+	/// A CSS selector parsed once into a program that can be matched against
+	/// many nodes.  Supports type, universal, id, class and attribute
+	/// selectors, the descendant, child, adjacent and general sibling
+	/// combinators, selector lists, and the pseudo classes :root, :empty,
+	/// :first-child, :last-child, :only-child, :nth-child( ),
+	/// :nth-last-child( ), the -of-type forms of those, :is( ), :where( ) and
+	/// :not( ).  A node is matched right to left, from the node up its
+	/// ancestors and previous siblings, giving up on a candidate as soon as it
+	/// cannot match.  css_selector is a matcher, usable with the matchers of
+	/// gumbo_matchers.h
+	class css_selector {
+	public:
+		using selector_list = std::vector<selector_details::complex_selector>;
+
+	private:
+		std::string m_source{ };
+		selector_list m_selectors{ };
+
+	public:
+		/// Parse selector.  Throws css_selector_error when it is not valid
+		explicit css_selector( daw::string_view selector );
+
+		/// The selector text this was parsed from
+		[[nodiscard]] inline daw::string_view source( ) const noexcept {
+			return daw::string_view( m_source.data( ), m_source.size( ) );
+		}
+
+		/// The selectors of the selector list
+		[[nodiscard]] inline selector_list const &selectors( ) const noexcept {
+			return m_selectors;
+		}
+
+		[[nodiscard]] bool operator( )( GumboNode const &node ) const;
+	};
+
+	/// Parse selector, or reuse the program of an earlier call with the same
+	/// selector text.  The cache is shared by all threads and holds up to
+	/// max_cached_selectors programs, starting over when it is full
+	[[nodiscard]] std::shared_ptr<css_selector const>
+	cached_selector( daw::string_view selector );
+
+	inline constexpr std::size_t max_cached_selectors = 256U;
+
+	/// The elements of the document matching the selector, in document order.
+	/// The selector is parsed once and cached
+	[[nodiscard]] std::vector<GumboNode const *>
+	select( gumbo_range const &rng, daw::string_view selector );
+
+	[[nodiscard]] std::vector<GumboNode const *>
+	select( gumbo_range const &rng, css_selector const &selector );
+
+	/// The descendants of node matching the selector, in document order.  Like
+	/// querySelectorAll, the whole selector is matched in the document, so
+	/// ancestors of node can satisfy its leftmost parts
+	[[nodiscard]] std::vector<GumboNode const *>
+	select( GumboNode const &node, daw::string_view selector );
+
+	[[nodiscard]] std::vector<GumboNode const *>
+	select( GumboNode const &node, css_selector const &selector );
+
+	/// The first element of the document matching the selector, or nullptr
+	[[nodiscard]] GumboNode const *select_first( gumbo_range const &rng,
+	                                             daw::string_view selector );
+} // namespace daw::gumbo
@@ -0,0 +1,100 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_flat_document.h"
+#include "gumbo_node_iterator.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace daw::gumbo {
+	inline constexpr std::uint32_t snapshot_version = 1U;
+
+	/// Serialize a document to the snapshot format.  A snapshot is a header
+	/// followed by a node table, source spans, an attribute table, a string pool
+	/// and the html source.  Sections refer to each other by offset only, so the
+	/// bytes can be mapped anywhere.  Values are in the byte order of the
+	/// machine that wrote them and a snapshot from another byte order is
+	/// rejected when loaded
+	[[nodiscard]] std::string to_snapshot( flat_document const &doc );
+
+	/// Write the snapshot of doc to path.  Throws std::runtime_error when the
+	/// file cannot be written
+	void save_snapshot( flat_document const &doc, daw::string_view path );
+
+	/// A document loaded from a snapshot without parsing it again.  A gumbo
+	/// node tree is rebuilt whose strings point into the snapshot data, so the
+	/// matchers and algorithms for gumbo_range work unchanged.  The node tree
+	/// has no line/column positions and every element is in the html namespace
+	class snapshot_document {
+		// Keeps the snapshot data alive when the document owns it
+		std::shared_ptr<void const> m_source{ };
+		std::vector<GumboNode> m_nodes{ };
+		std::vector<GumboAttribute> m_attributes{ };
+		// Backing arrays of the GumboVector's of children and attributes
+		std::vector<void *> m_pointers{ };
+		daw::string_view m_html{ };
+		GumboNode const *m_root = nullptr;
+
+		explicit snapshot_document( std::shared_ptr<void const> source,
+		                            daw::string_view data );
+
+	public:
+		/// Load a snapshot that the caller keeps alive.  Throws
+		/// std::runtime_error when data is not a valid snapshot
+		[[nodiscard]] static snapshot_document
+		from_bytes( daw::string_view data );
+
+		/// Memory map the snapshot at path.  The mapping lives as long as the
+		/// document.  Throws std::runtime_error when the file cannot be mapped or
+		/// is not a valid snapshot
+		[[nodiscard]] static snapshot_document from_file( daw::string_view path );
+
+		// The node tree refers to itself
+		snapshot_document( snapshot_document const & ) = delete;
+		snapshot_document &operator=( snapshot_document const & ) = delete;
+		snapshot_document( snapshot_document && ) = default;
+		snapshot_document &operator=( snapshot_document && ) = default;
+		~snapshot_document( ) = default;
+
+		/// Number of nodes, including the document node
+		[[nodiscard]] inline std::size_t size( ) const noexcept {
+			return m_nodes.size( );
+		}
+
+		/// The html document the node's source positions refer to
+		[[nodiscard]] inline daw::string_view html( ) const noexcept {
+			return m_html;
+		}
+
+		[[nodiscard]] inline GumboNode const *document( ) const noexcept {
+			return m_nodes.data( );
+		}
+
+		[[nodiscard]] inline GumboNode const *root( ) const noexcept {
+			return m_root;
+		}
+
+		[[nodiscard]] inline gumbo_node_iterator_t begin( ) const noexcept {
+			return gumbo_node_iterator_t( m_root );
+		}
+
+		[[nodiscard]] inline gumbo_node_iterator_t end( ) const noexcept {
+			return gumbo_node_iterator_t( );
+		}
+	};
+} // namespace daw::gumbo
@@ -0,0 +1,98 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_node_iterator.h"
+#include "gumbo_util.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cassert>
+#include <cstddef>
+#include <gumbo.h>
+#include <unordered_map>
+
+namespace daw::gumbo {
+	/// The source spans of every node of a document, computed in one pass.
+	/// Unlike node_source_span, elements whose tags were implied by the parser
+	/// are widened to cover their children, so the outer span of every node
+	/// contains the spans of its descendants.  The spans are clamped to the
+	/// html document, and slicing it gives the raw source of a node without
+	/// serializing it.  The range indexed must outlive the map
+	class source_span_map {
+		struct node_spans {
+			source_span outer;
+			source_span inner;
+		};
+
+		daw::string_view m_html{ };
+		std::unordered_map<GumboNode const *, node_spans> m_spans{ };
+
+		[[nodiscard]] inline node_spans const &
+		spans( GumboNode const &node ) const {
+			auto pos = m_spans.find( &node );
+			assert( pos != m_spans.end( ) );
+			return pos->second;
+		}
+
+		[[nodiscard]] inline daw::string_view
+		slice( source_span span ) const noexcept {
+			return daw::string_view( m_html.data( ) + span.first, span.size( ) );
+		}
+
+	public:
+		/// Map the whole document, including the document node
+		explicit source_span_map( gumbo_range const &rng );
+
+		/// Map node and its descendants.  html_doc is the document node was
+		/// parsed from
+		source_span_map( GumboNode const &node, daw::string_view html_doc );
+
+		/// Is the node part of the map
+		[[nodiscard]] inline bool contains( GumboNode const &node ) const {
+			return m_spans.find( &node ) != m_spans.end( );
+		}
+
+		/// Byte offsets of the source of the node, including its tags
+		[[nodiscard]] inline source_span
+		outer_span( GumboNode const &node ) const {
+			return spans( node ).outer;
+		}
+
+		/// Byte offsets of the source between the node's tags.  For nodes
+		/// without tags it is the same as the outer span
+		[[nodiscard]] inline source_span
+		inner_span( GumboNode const &node ) const {
+			return spans( node ).inner;
+		}
+
+		/// The source of the node, including its tags
+		[[nodiscard]] inline daw::string_view
+		outer_text( GumboNode const &node ) const {
+			return slice( outer_span( node ) );
+		}
+
+		/// The source between the node's tags
+		[[nodiscard]] inline daw::string_view
+		inner_text( GumboNode const &node ) const {
+			return slice( inner_span( node ) );
+		}
+
+		/// The html document the spans refer to
+		[[nodiscard]] inline daw::string_view html( ) const noexcept {
+			return m_html;
+		}
+
+		/// Number of nodes mapped
+		[[nodiscard]] inline std::size_t size( ) const noexcept {
+			return m_spans.size( );
+		}
+	};
+} // namespace daw::gumbo
@@ -0,0 +1,169 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include "details/gumbo_pp.h"
+#include "gumbo_matchers.h"
+#include "gumbo_node_iterator.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+#include <iterator>
+#include <vector>
+
+namespace daw::gumbo {
+	struct tag_index_entry {
+		// Position of the node in document order
+		std::uint32_t position;
+		GumboNode const *node;
+	};
+
+	/// Iterates the nodes of one or more of a tag_index's or class_index's lists
+	/// in document order, merging them as it goes
+	template<std::size_t N>
+	class tag_index_iterator {
+		std::array<tag_index_entry const *, N> m_cur{ };
+		std::array<tag_index_entry const *, N> m_last{ };
+		std::size_t m_min = 0;
+
+		constexpr void find_min( ) noexcept {
+			m_min = N;
+			for( std::size_t n = 0; n < N; ++n ) {
+				if( m_cur[n] == m_last[n] ) {
+					continue;
+				}
+				if( m_min == N or m_cur[n]->position < m_cur[m_min]->position ) {
+					m_min = n;
+				}
+			}
+		}
+
+	public:
+		using difference_type = std::ptrdiff_t;
+		using value_type = GumboNode;
+		using pointer = GumboNode const *;
+		using reference = GumboNode const &;
+		using iterator_category = std::forward_iterator_tag;
+
+		constexpr tag_index_iterator( ) = default;
+
+		constexpr tag_index_iterator(
+		  std::array<tag_index_entry const *, N> const &cur,
+		  std::array<tag_index_entry const *, N> const &last ) noexcept
+		  : m_cur( cur )
+		  , m_last( last ) {
+			find_min( );
+		}
+
+		[[nodiscard]] constexpr reference operator*( ) const noexcept {
+			assert( m_min < N );
+			return *m_cur[m_min]->node;
+		}
+
+		[[nodiscard]] constexpr pointer operator->( ) const noexcept {
+			assert( m_min < N );
+			return m_cur[m_min]->node;
+		}
+
+		/// The node as a gumbo_node_iterator_t, to continue walking the tree from
+		[[nodiscard]] constexpr gumbo_node_iterator_t node( ) const noexcept {
+			return gumbo_node_iterator_t( operator->( ) );
+		}
+
+		constexpr tag_index_iterator &operator++( ) noexcept {
+			assert( m_min < N );
+			// A node in more than one list is only visited once
+			auto const position = m_cur[m_min]->position;
+			for( std::size_t n = 0; n < N; ++n ) {
+				if( m_cur[n] != m_last[n] and m_cur[n]->position == position ) {
+					++m_cur[n];
+				}
+			}
+			find_min( );
+			return *this;
+		}
+
+		constexpr tag_index_iterator operator++( int ) noexcept {
+			auto result = *this;
+			operator++( );
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr bool
+		operator==( tag_index_iterator const &lhs,
+		            tag_index_iterator const &rhs ) noexcept {
+			return lhs.m_cur == rhs.m_cur;
+		}
+
+		[[nodiscard]] friend constexpr bool
+		operator!=( tag_index_iterator const &lhs,
+		            tag_index_iterator const &rhs ) noexcept {
+			return lhs.m_cur != rhs.m_cur;
+		}
+	};
+
+	template<std::size_t N>
+	class tag_index_range {
+		tag_index_iterator<N> m_first;
+		tag_index_iterator<N> m_last;
+
+	public:
+		constexpr tag_index_range(
+		  std::array<tag_index_entry const *, N> const &first,
+		  std::array<tag_index_entry const *, N> const &last ) noexcept
+		  : m_first( first, last )
+		  , m_last( last, last ) {}
+
+		[[nodiscard]] constexpr tag_index_iterator<N> begin( ) const noexcept {
+			return m_first;
+		}
+
+		[[nodiscard]] constexpr tag_index_iterator<N> end( ) const noexcept {
+			return m_last;
+		}
+	};
+
+	/// For each tag, the elements of a document in document order.  Built in a
+	/// single pass, after which finding the elements of a tag costs the number of
+	/// matches rather than a walk of the whole document
+	class tag_index {
+		std::vector<std::vector<tag_index_entry>> m_entries;
+
+	public:
+		explicit tag_index( gumbo_range const &rng );
+		explicit tag_index( gumbo_node_iterator_t first,
+		                    gumbo_node_iterator_t last );
+
+		/// The elements with tag, in document order
+		[[nodiscard]] inline std::vector<tag_index_entry> const &
+		entries( GumboTag tag ) const {
+			return m_entries[static_cast<std::size_t>( tag )];
+		}
+
+		/// The elements matching a match::tag matcher, in document order
+		template<GumboTag... tags>
+		[[nodiscard]] tag_index_range<sizeof...( tags )>
+		find( match_details::match_tag::types_t<tags...> ) const {
+			static_assert( sizeof...( tags ) > 0, "At least one tag is required" );
+			return tag_index_range<sizeof...( tags )>(
+			  { entries( tags ).data( )... },
+			  { ( entries( tags ).data( ) + entries( tags ).size( ) )... } );
+		}
+
+		/// The number of elements matching a match::tag matcher
+		template<GumboTag... tags>
+		[[nodiscard]] std::size_t
+		count( match_details::match_tag::types_t<tags...> ) const {
+			return ( entries( tags ).size( ) + ... + 0U );
+		}
+	};
+} // namespace daw::gumbo
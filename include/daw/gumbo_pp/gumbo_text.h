@@ -15,52 +15,125 @@
 
 #include <daw/daw_string_view.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <gumbo.h>
+#include <iterator>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 namespace daw::gumbo {
-	inline std::string node_content_text( GumboNode const &node ) {
-		switch( node.type ) {
-		case GumboNodeType::GUMBO_NODE_ELEMENT: {
-			std::string result{ };
-			for( GumboNode *child : daw::gumbo::details::GumboVectorIterator(
-			       node.v.element.children ) ) {
-				if( not child ) {
-					continue;
-				}
-				if( child->type == GUMBO_NODE_TEXT ) {
-					result += std::string_view( child->v.text.text );
-				} else {
-					result += node_content_text( *child );
-				}
+	namespace text_details {
+		/// Pass text to sink, returning false when it asks to stop.  Sinks that
+		/// return void always continue
+		template<typename Sink>
+		constexpr bool call_sink( Sink &sink, daw::string_view text ) {
+			if constexpr( std::is_same_v<decltype( sink( text ) ), void> ) {
+				sink( text );
+				return true;
+			} else {
+				return static_cast<bool>( sink( text ) );
 			}
-			return result;
 		}
-		case GumboNodeType::GUMBO_NODE_DOCUMENT: {
-			std::string result{ };
-			for( GumboNode *child : daw::gumbo::details::GumboVectorIterator(
-			       node.v.document.children ) ) {
-				if( not child ) {
-					continue;
-				}
-				if( child->type == GUMBO_NODE_TEXT ) {
-					result += std::string_view( child->v.text.text );
-				} else {
-					result += node_content_text( *child );
+	} // namespace text_details
+
+	/// Call sink with each piece of the content text of node, the text of it
+	/// and its descendants in document order.  When sink returns bool, the walk
+	/// stops at the first piece it returns false for.  The tree is walked
+	/// through the parent links, so deep documents neither recurse nor allocate
+	template<typename Sink>
+	constexpr void for_each_content_text( GumboNode const &node, Sink &&sink ) {
+		switch( node.type ) {
+		case GumboNodeType::GUMBO_NODE_ELEMENT:
+		case GumboNodeType::GUMBO_NODE_TEMPLATE:
+		case GumboNodeType::GUMBO_NODE_DOCUMENT:
+			break;
+		default:
+			(void)text_details::call_sink( sink,
+			                               daw::string_view( node.v.text.text ) );
+			return;
+		}
+		auto const last = subtree_end( node );
+		for( auto it = std::next( gumbo_node_iterator_t( node ) ); it != last;
+		     ++it ) {
+			switch( it->type ) {
+			case GumboNodeType::GUMBO_NODE_ELEMENT:
+			case GumboNodeType::GUMBO_NODE_TEMPLATE:
+			case GumboNodeType::GUMBO_NODE_DOCUMENT:
+				break;
+			default:
+				if( not text_details::call_sink(
+				      sink, daw::string_view( it->v.text.text ) ) ) {
+					return;
 				}
+				break;
 			}
-			return result;
-		}
-		default:
-			return static_cast<std::string>( daw::string_view( node.v.text.text ) );
 		}
 	}
 
+	/// Append the content text of node to buffer
+	inline void node_content_text( GumboNode const &node, std::string &buffer ) {
+		for_each_content_text( node, [&]( daw::string_view text ) {
+			buffer.append( text.data( ), text.size( ) );
+		} );
+	}
+
+	/// Copy the content text of node to out
+	template<typename OutputIterator,
+	         std::enable_if_t<not std::is_same_v<OutputIterator, std::string>,
+	                          std::nullptr_t> = nullptr>
+	OutputIterator node_content_text( GumboNode const &node,
+	                                  OutputIterator out ) {
+		for_each_content_text( node, [&]( daw::string_view text ) {
+			out = std::copy( text.begin( ), text.end( ), out );
+		} );
+		return out;
+	}
+
+	inline std::string node_content_text( GumboNode const &node ) {
+		std::string result{ };
+		node_content_text( node, result );
+		return result;
+	}
+
+	/// Does node have any non-empty content text
+	[[nodiscard]] constexpr bool has_content_text( GumboNode const &node ) {
+		bool result = false;
+		for_each_content_text( node, [&]( daw::string_view text ) {
+			result = not text.empty( );
+			return not result;
+		} );
+		return result;
+	}
+
+	/// Append the text of node as a browser would render it, like innerText.
+	/// Runs of whitespace collapse to a single space except inside PRE and
+	/// similar elements, block level elements and BR start new lines, table
+	/// cells are separated by tabs and HEAD, SCRIPT, STYLE, NOSCRIPT, TEMPLATE
+	/// and comments are skipped.  The tree is walked once and buffer keeps its
+	/// capacity between calls
+	void node_rendered_text( GumboNode const &node, std::string &buffer );
+
+	[[nodiscard]] std::string node_rendered_text( GumboNode const &node );
+
+	namespace text_details {
+		/// The content text of node in a buffer reused by the calling thread.  The
+		/// view is valid until the next call on the same thread
+		[[nodiscard]] inline daw::string_view
+		content_text_scratch( GumboNode const &node ) {
+			thread_local std::string buffer{ };
+			buffer.clear( );
+			node_content_text( node, buffer );
+			return daw::string_view( buffer.data( ), buffer.size( ) );
+		}
+	} // namespace text_details
+
 	constexpr daw::string_view node_outer_text( GumboNode const &node,
 	                                            daw::string_view html_doc ) {
 		switch( node.type ) {
-		case GumboNodeType::GUMBO_NODE_ELEMENT: {
+		case GumboNodeType::GUMBO_NODE_ELEMENT:
+		case GumboNodeType::GUMBO_NODE_TEMPLATE: {
 			char const *start = node.v.element.original_tag.data;
 			auto len = static_cast<std::size_t>(
 			  node.v.element.original_end_tag.data +
@@ -78,7 +151,8 @@ namespace daw::gumbo {
 	constexpr daw::string_view node_inner_text( GumboNode const &node,
 	                                            daw::string_view html_doc ) {
 		switch( node.type ) {
-		case GumboNodeType::GUMBO_NODE_ELEMENT: {
+		case GumboNodeType::GUMBO_NODE_ELEMENT:
+		case GumboNodeType::GUMBO_NODE_TEMPLATE: {
 			char const *start =
 			  node.v.element.original_tag.data + node.v.element.original_tag.length;
 			auto len = static_cast<std::size_t>(
@@ -91,9 +165,14 @@ namespace daw::gumbo {
 				return { };
 			}
 			GumboNode const &first_child = *get_child_node_at( node, 0 );
-			GumboNode const &last_child = *get_child_node_at( node, child_count - 1 );
-			auto start_pos = node_start_offset( first_child );
-			auto end_pos = node_end_offset( last_child );
+			std::size_t const start_pos = node_start_offset( first_child );
+			std::size_t end_pos = node_end_offset( node );
+			if( end_pos > html_doc.size( ) ) {
+				end_pos = html_doc.size( );
+			}
+			if( start_pos >= end_pos ) {
+				return { };
+			}
 			return daw::string_view( html_doc.data( ) + start_pos,
 			                         end_pos - start_pos );
 		}
@@ -101,9 +180,18 @@ namespace daw::gumbo {
 		case GumboNodeType::GUMBO_NODE_CDATA:
 		case GumboNodeType::GUMBO_NODE_COMMENT:
 		case GumboNodeType::GUMBO_NODE_WHITESPACE:
-		case GumboNodeType::GUMBO_NODE_TEMPLATE:
 		default:
 			return { node.v.text.text };
 		}
 	}
+
+	inline daw::string_view node_outer_text( GumboNode const &node,
+	                                         gumbo_range const &rng ) {
+		return node_outer_text( node, rng.html( ) );
+	}
+
+	inline daw::string_view node_inner_text( GumboNode const &node,
+	                                         gumbo_range const &rng ) {
+		return node_inner_text( node, rng.html( ) );
+	}
 } // namespace daw::gumbo
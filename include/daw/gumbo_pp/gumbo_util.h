@@ -13,6 +13,7 @@
 
 #include <daw/daw_string_view.h>
 
+#include <cstdint>
 #include <gumbo.h>
 #include <string>
 
@@ -118,9 +119,20 @@ namespace daw::gumbo {
 		return false;
 	}
 
+	/// A [first, last) range of byte offsets into the html document
+	struct source_span {
+		std::uint32_t first = 0;
+		std::uint32_t last = 0;
+
+		[[nodiscard]] constexpr std::uint32_t size( ) const noexcept {
+			return last - first;
+		}
+	};
+
 	constexpr unsigned node_start_offset( GumboNode const &node ) {
 		switch( node.type ) {
-		case GumboNodeType::GUMBO_NODE_ELEMENT: {
+		case GumboNodeType::GUMBO_NODE_ELEMENT:
+		case GumboNodeType::GUMBO_NODE_TEMPLATE: {
 			return node.v.element.start_pos.offset;
 		}
 		case GumboNodeType::GUMBO_NODE_DOCUMENT: {
@@ -131,17 +143,64 @@ namespace daw::gumbo {
 		}
 	}
 
+	/// The byte offset one past the end of the node's source.  For elements
+	/// this is after the end tag, or where the element was closed when the end
+	/// tag was implied.  For text nodes it is the end of the original text, not
+	/// of the decoded text.  For the document it is the end of its last child
 	constexpr unsigned node_end_offset( GumboNode const &node ) {
 		switch( node.type ) {
-		case GumboNodeType::GUMBO_NODE_ELEMENT: {
-			return node.v.element.end_pos.offset;
+		case GumboNodeType::GUMBO_NODE_ELEMENT:
+		case GumboNodeType::GUMBO_NODE_TEMPLATE: {
+			return node.v.element.end_pos.offset +
+			       static_cast<unsigned>( node.v.element.original_end_tag.length );
 		}
 		case GumboNodeType::GUMBO_NODE_DOCUMENT: {
-			return 0U;
+			auto const child_count = node.v.document.children.length;
+			if( child_count == 0 ) {
+				return 0U;
+			}
+			auto const *last_child = static_cast<GumboNode const *>(
+			  node.v.document.children.data[child_count - 1U] );
+			return node_end_offset( *last_child );
 		}
 		default:
-			return static_cast<unsigned>(
-			  std::char_traits<char>::length( node.v.text.text ) );
+			return node.v.text.start_pos.offset +
+			       static_cast<unsigned>( node.v.text.original_text.length );
+		}
+	}
+
+	/// Byte offsets of the source of the node, including its tags.  Elements
+	/// whose start tag was implied by the parser begin where the parser
+	/// inserted them and do not cover their children, source_span_map handles
+	/// those
+	[[nodiscard]] constexpr source_span
+	node_source_span( GumboNode const &node ) {
+		auto const first = node_start_offset( node );
+		auto const last = node_end_offset( node );
+		return source_span{ static_cast<std::uint32_t>( first ),
+		                    static_cast<std::uint32_t>( last < first ? first
+		                                                             : last ) };
+	}
+
+	/// Byte offsets of the source between the node's tags.  For nodes without
+	/// tags it is the same as node_source_span
+	[[nodiscard]] constexpr source_span
+	node_inner_source_span( GumboNode const &node ) {
+		auto result = node_source_span( node );
+		switch( node.type ) {
+		case GumboNodeType::GUMBO_NODE_ELEMENT:
+		case GumboNodeType::GUMBO_NODE_TEMPLATE: {
+			auto const &element = node.v.element;
+			auto const tag_size =
+			  static_cast<std::uint32_t>( element.original_tag.length );
+			auto const first = result.first + tag_size;
+			auto const last = static_cast<std::uint32_t>( element.end_pos.offset );
+			result.first = first < result.last ? first : result.last;
+			result.last = last < result.first ? result.first : last;
+			return result;
+		}
+		default:
+			return result;
 		}
 	}
 
@@ -158,6 +217,186 @@ namespace daw::gumbo {
 		return { href->value };
 	}
 
+	namespace util_details {
+		[[nodiscard]] constexpr char ascii_lower( char c ) noexcept {
+			if( c >= 'A' and c <= 'Z' ) {
+				return static_cast<char>( c - 'A' + 'a' );
+			}
+			return c;
+		}
+
+		/// Does str start with the lower case ascii name, case insensitively, and
+		/// is it followed by something that ends a tag name
+		[[nodiscard]] constexpr bool starts_with_tag( daw::string_view str,
+		                                              daw::string_view name ) {
+			if( str.size( ) <= name.size( ) ) {
+				return false;
+			}
+			for( std::size_t n = 0; n < name.size( ); ++n ) {
+				if( ascii_lower( str[n] ) != name[n] ) {
+					return false;
+				}
+			}
+			switch( str[name.size( )] ) {
+			case '>':
+			case '/':
+			case ' ':
+			case '\t':
+			case '\n':
+			case '\r':
+			case '\f':
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		/// Position of the first occurrence of the lower case ascii needle in
+		/// str at or after pos, case insensitively
+		[[nodiscard]] constexpr std::size_t ifind( daw::string_view str,
+		                                           daw::string_view needle,
+		                                           std::size_t pos ) {
+			while( pos + needle.size( ) <= str.size( ) ) {
+				pos = str.find( '<', pos );
+				if( pos == daw::string_view::npos or
+				    pos + needle.size( ) > str.size( ) ) {
+					return daw::string_view::npos;
+				}
+				bool found = true;
+				for( std::size_t n = 1; n < needle.size( ); ++n ) {
+					if( ascii_lower( str[pos + n] ) != needle[n] ) {
+						found = false;
+						break;
+					}
+				}
+				if( found ) {
+					return pos;
+				}
+				++pos;
+			}
+			return daw::string_view::npos;
+		}
+	} // namespace util_details
+
+	inline constexpr std::size_t default_max_head_prefix = 64U * 1024U;
+
+	/// Find the part of the document up to the end of the head section using a
+	/// byte scan.  The prefix ends after </head> or before <body, whichever comes
+	/// first.  Comments, script and style contents are skipped.  When neither is
+	/// found in the first max_prefix bytes, the prefix ends after the last tag
+	/// closed before max_prefix
+	[[nodiscard]] constexpr daw::string_view
+	head_section_prefix( daw::string_view html_doc,
+	                     std::size_t max_prefix = default_max_head_prefix ) {
+		using util_details::ifind;
+		using util_details::starts_with_tag;
+		auto const limit =
+		  max_prefix < html_doc.size( ) ? max_prefix : html_doc.size( );
+		std::size_t pos = 0;
+		while( pos < limit ) {
+			pos = html_doc.find( '<', pos );
+			if( pos == daw::string_view::npos or pos >= limit ) {
+				break;
+			}
+			auto const rest = html_doc.substr( pos );
+			if( rest.starts_with( "<!--" ) ) {
+				auto const end_pos = html_doc.find( "-->", pos + 4U );
+				if( end_pos == daw::string_view::npos ) {
+					break;
+				}
+				pos = end_pos + 3U;
+				continue;
+			}
+			bool const is_script = starts_with_tag( rest.substr( 1 ), "script" );
+			if( is_script or starts_with_tag( rest.substr( 1 ), "style" ) ) {
+				auto const end_pos =
+				  ifind( html_doc, is_script ? "</script" : "</style", pos + 1U );
+				if( end_pos == daw::string_view::npos ) {
+					break;
+				}
+				pos = end_pos + 1U;
+				continue;
+			}
+			if( starts_with_tag( rest.substr( 1 ), "body" ) ) {
+				return html_doc.substr( 0, pos );
+			}
+			if( starts_with_tag( rest.substr( 1 ), "/head" ) ) {
+				auto const end_pos = html_doc.find( '>', pos );
+				if( end_pos == daw::string_view::npos ) {
+					return html_doc;
+				}
+				return html_doc.substr( 0, end_pos + 1U );
+			}
+			++pos;
+		}
+		if( limit == html_doc.size( ) ) {
+			return html_doc;
+		}
+		// No end of head found, do not hand gumbo a partial tag
+		auto const last_close = html_doc.substr( 0, limit ).rfind( '>' );
+		if( last_close == daw::string_view::npos ) {
+			return html_doc.substr( 0, limit );
+		}
+		return html_doc.substr( 0, last_close + 1U );
+	}
+
+	/// Is c one of the ASCII whitespace characters that separate the tokens of
+	/// attributes like class
+	[[nodiscard]] constexpr bool is_html_space( char c ) noexcept {
+		switch( c ) {
+		case ' ':
+		case '\t':
+		case '\n':
+		case '\r':
+		case '\f':
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	/// Call func with each whitespace separated token of a class list
+	template<typename Function>
+	constexpr void for_each_class_token( daw::string_view class_list,
+	                                     Function &&func ) {
+		std::size_t pos = 0;
+		while( pos < class_list.size( ) ) {
+			while( pos < class_list.size( ) and is_html_space( class_list[pos] ) ) {
+				++pos;
+			}
+			auto const first = pos;
+			while( pos < class_list.size( ) and
+			       not is_html_space( class_list[pos] ) ) {
+				++pos;
+			}
+			if( pos > first ) {
+				func( class_list.substr( first, pos - first ) );
+			}
+		}
+	}
+
+	/// Is token one of the whitespace separated tokens of class_list.  Searches
+	/// for the token and checks the characters around it, so the list is not
+	/// split up front
+	[[nodiscard]] constexpr bool
+	class_list_contains( daw::string_view class_list,
+	                     daw::string_view token ) noexcept {
+		if( token.empty( ) ) {
+			return false;
+		}
+		std::size_t pos = 0;
+		while( ( pos = class_list.find( token, pos ) ) != daw::string_view::npos ) {
+			auto const last = pos + token.size( );
+			if( ( pos == 0 or is_html_space( class_list[pos - 1U] ) ) and
+			    ( last == class_list.size( ) or
+			      is_html_space( class_list[last] ) ) ) {
+				return true;
+			}
+			pos = last;
+		}
+		return false;
+	}
+
 	constexpr daw::string_view to_string( GumboNodeType type ) {
 		switch( type ) {
 		case GUMBO_NODE_DOCUMENT:
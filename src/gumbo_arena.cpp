@@ -0,0 +1,188 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_arena.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <gumbo.h>
+#include <new>
+
+namespace daw::gumbo {
+	struct alignas( std::max_align_t ) gumbo_arena::block_t {
+		block_t *next;
+		std::size_t capacity;
+		std::size_t used;
+
+		[[nodiscard]] inline char *data( ) noexcept {
+			return reinterpret_cast<char *>( this ) + sizeof( block_t );
+		}
+	};
+
+	namespace {
+		constexpr std::size_t round_to_alignment( std::size_t size ) noexcept {
+			constexpr std::size_t align = alignof( std::max_align_t );
+			return ( size + ( align - 1U ) ) & ~( align - 1U );
+		}
+
+		void *arena_allocate( void *userdata, std::size_t size ) {
+			return static_cast<gumbo_arena *>( userdata )->allocate( size );
+		}
+
+		void arena_deallocate( void *, void * ) {
+			// Memory is reclaimed when the arena is reset
+		}
+	} // namespace
+
+	gumbo_arena::gumbo_arena( std::size_t block_size ) noexcept
+	  : m_block_size( round_to_alignment( block_size ) ) {}
+
+	gumbo_arena::~gumbo_arena( ) {
+		release( );
+	}
+
+	gumbo_arena::block_t *
+	gumbo_arena::add_block( std::size_t min_capacity ) noexcept {
+		auto const capacity = std::max( m_block_size, min_capacity );
+		void *mem = std::malloc( sizeof( block_t ) + capacity );
+		if( not mem ) {
+			return nullptr;
+		}
+		auto *blk = new( mem ) block_t{ nullptr, capacity, 0 };
+		if( m_current ) {
+			// Keep the remaining retained blocks after the new one
+			blk->next = m_current->next;
+			m_current->next = blk;
+		} else {
+			blk->next = m_first;
+			m_first = blk;
+		}
+		return blk;
+	}
+
+	void *gumbo_arena::allocate( std::size_t size ) noexcept {
+		size = round_to_alignment( size );
+		while( m_current ) {
+			if( m_current->capacity - m_current->used >= size ) {
+				char *result = m_current->data( ) + m_current->used;
+				m_current->used += size;
+				return result;
+			}
+			if( not m_current->next ) {
+				break;
+			}
+			m_current = m_current->next;
+		}
+		block_t *blk = add_block( size );
+		if( not blk ) {
+			return nullptr;
+		}
+		m_current = blk;
+		m_current->used = size;
+		return m_current->data( );
+	}
+
+	void gumbo_arena::reset( ) noexcept {
+		for( block_t *blk = m_first; blk; blk = blk->next ) {
+			blk->used = 0;
+		}
+		m_current = m_first;
+	}
+
+	void gumbo_arena::release( ) noexcept {
+		block_t *blk = m_first;
+		while( blk ) {
+			block_t *next = blk->next;
+			std::free( blk );
+			blk = next;
+		}
+		m_first = nullptr;
+		m_current = nullptr;
+	}
+
+	void gumbo_arena::reserve( std::size_t capacity ) noexcept {
+		std::size_t current = 0;
+		block_t *last = nullptr;
+		for( block_t *blk = m_first; blk; blk = blk->next ) {
+			current += blk->capacity;
+			last = blk;
+		}
+		if( current >= capacity ) {
+			return;
+		}
+		// New blocks go after the current one, append to the end of the chain
+		block_t *const old_current = m_current;
+		m_current = last;
+		block_t *blk = add_block( round_to_alignment( capacity - current ) );
+		m_current = old_current ? old_current : m_first;
+		if( not blk ) {
+			return;
+		}
+		std::memset( blk->data( ), 0, blk->capacity );
+	}
+
+	void gumbo_arena::shrink_to( std::size_t max_capacity ) noexcept {
+		assert( m_live_outputs == 0 );
+		std::size_t retained = 0;
+		block_t **link = &m_first;
+		while( *link ) {
+			block_t *blk = *link;
+			if( retained + blk->capacity <= max_capacity ) {
+				retained += blk->capacity;
+				link = &blk->next;
+				continue;
+			}
+			*link = blk->next;
+			std::free( blk );
+		}
+		reset( );
+	}
+
+	std::size_t gumbo_arena::capacity( ) const noexcept {
+		std::size_t result = 0;
+		for( block_t const *blk = m_first; blk; blk = blk->next ) {
+			result += blk->capacity;
+		}
+		return result;
+	}
+
+	std::size_t gumbo_arena::size( ) const noexcept {
+		std::size_t result = 0;
+		for( block_t const *blk = m_first; blk; blk = blk->next ) {
+			result += blk->used;
+		}
+		return result;
+	}
+
+	GumboOptions gumbo_arena::options( GumboOptions opts ) noexcept {
+		opts.allocator = &arena_allocate;
+		opts.deallocator = &arena_deallocate;
+		opts.userdata = this;
+		return opts;
+	}
+
+	void gumbo_arena::add_output( ) noexcept {
+		++m_live_outputs;
+	}
+
+	void gumbo_arena::remove_output( ) noexcept {
+		if( m_live_outputs == 0 ) {
+			return;
+		}
+		if( --m_live_outputs == 0 ) {
+			if( capacity( ) > m_max_retained ) {
+				shrink_to( m_max_retained );
+			} else {
+				reset( );
+			}
+		}
+	}
+} // namespace daw::gumbo
@@ -0,0 +1,60 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_class_index.h>
+#include <daw/gumbo_pp/gumbo_util.h>
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <gumbo.h>
+#include <string_view>
+#include <vector>
+
+namespace daw::gumbo {
+	class_index::class_index( gumbo_range const &rng )
+	  : class_index( rng.begin( ), rng.end( ) ) {}
+
+	class_index::class_index( gumbo_node_iterator_t first,
+	                          gumbo_node_iterator_t last ) {
+		std::uint32_t position = 0;
+		for( ; first != last; ++first, ++position ) {
+			auto const attr_count = get_attribute_count( *first );
+			for( std::size_t n = 0; n < attr_count; ++n ) {
+				auto const *attr = get_attribute_node_at( *first, n );
+				if( std::strcmp( attr->name, "class" ) != 0 ) {
+					continue;
+				}
+				auto const entry = tag_index_entry{ position, first.get( ) };
+				for_each_class_token(
+				  daw::string_view( attr->value ), [&]( daw::string_view token ) {
+					  auto &nodes =
+					    m_classes[std::string_view( token.data( ), token.size( ) )];
+					  // class="a a" lists the element once
+					  if( nodes.empty( ) or nodes.back( ).node != entry.node ) {
+						  nodes.push_back( entry );
+					  }
+				  } );
+				break;
+			}
+		}
+	}
+
+	std::vector<tag_index_entry> const &
+	class_index::entries( daw::string_view class_name ) const {
+		static std::vector<tag_index_entry> const empty{ };
+		auto pos = m_classes.find(
+		  std::string_view( class_name.data( ), class_name.size( ) ) );
+		if( pos == m_classes.end( ) ) {
+			return empty;
+		}
+		return pos->second;
+	}
+} // namespace daw::gumbo
@@ -0,0 +1,60 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_content_text_index.h>
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace daw::gumbo {
+	content_text_index::content_text_index( gumbo_range const &rng )
+	  : content_text_index( *rng.document( ) ) {}
+
+	content_text_index::content_text_index( GumboNode const &node ) {
+		// Elements whose subtree is still being visited.  The text of an element
+		// ends where the text of its last descendant ends
+		std::vector<std::pair<GumboNode const *, std::uint32_t>> open{ };
+		auto const close_until = [&]( GumboNode const *parent ) {
+			auto const last = static_cast<std::uint32_t>( m_text.size( ) );
+			while( not open.empty( ) and open.back( ).first != parent ) {
+				m_spans.emplace( open.back( ).first,
+				                 span_t{ open.back( ).second, last } );
+				open.pop_back( );
+			}
+		};
+		auto const last = subtree_end( node );
+		for( auto it = gumbo_node_iterator_t( node ); it != last; ++it ) {
+			GumboNode const *cur = it.get( );
+			if( cur != &node ) {
+				close_until( cur->parent );
+			}
+			auto const first = static_cast<std::uint32_t>( m_text.size( ) );
+			switch( cur->type ) {
+			case GumboNodeType::GUMBO_NODE_ELEMENT:
+			case GumboNodeType::GUMBO_NODE_TEMPLATE:
+			case GumboNodeType::GUMBO_NODE_DOCUMENT:
+				open.emplace_back( cur, first );
+				break;
+			default: {
+				auto const text = daw::string_view( cur->v.text.text );
+				m_text.append( text.data( ), text.size( ) );
+				m_spans.emplace(
+				  cur, span_t{ first, static_cast<std::uint32_t>( m_text.size( ) ) } );
+				break;
+			}
+			}
+		}
+		close_until( nullptr );
+	}
+} // namespace daw::gumbo
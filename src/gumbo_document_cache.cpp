@@ -0,0 +1,164 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_arena.h>
+#include <daw/gumbo_pp/gumbo_document_cache.h>
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <gumbo.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace daw::gumbo {
+	namespace {
+		constexpr std::uint64_t hash_multiplier = 0x9E37'79B9'7F4A'7C15ULL;
+
+		[[nodiscard]] constexpr std::uint64_t mix( std::uint64_t h,
+		                                           std::uint64_t word ) noexcept {
+			h ^= word;
+			h *= hash_multiplier;
+			return h ^ ( h >> 32U );
+		}
+	} // namespace
+
+	std::uint64_t document_hash( daw::string_view bytes ) noexcept {
+		auto h = static_cast<std::uint64_t>( bytes.size( ) ) * hash_multiplier;
+		char const *first = bytes.data( );
+		std::size_t size = bytes.size( );
+		while( size >= sizeof( std::uint64_t ) ) {
+			std::uint64_t word;
+			std::memcpy( &word, first, sizeof( word ) );
+			h = mix( h, word );
+			first += sizeof( word );
+			size -= sizeof( word );
+		}
+		if( size > 0 ) {
+			std::uint64_t word = 0;
+			std::memcpy( &word, first, size );
+			h = mix( h, word );
+		}
+		// Final avalanche so that the low bits used by the table depend on all of
+		// the input
+		h ^= h >> 29U;
+		h *= 0xBF58'476D'1CE4'E5B9ULL;
+		return h ^ ( h >> 32U );
+	}
+
+	struct document_cache::entry_t {
+		// Destroyed in reverse order, the range before the arena and the html
+		std::string html;
+		gumbo_arena arena{ };
+		gumbo_range range;
+		std::uint64_t hash;
+
+		entry_t( daw::string_view html_document,
+		         std::uint64_t h,
+		         GumboOptions const &options )
+		  : html( html_document.data( ), html_document.size( ) )
+		  , range( daw::string_view( html ), arena, options )
+		  , hash( h ) {}
+
+		[[nodiscard]] std::size_t memory_used( ) const noexcept {
+			return sizeof( entry_t ) + html.capacity( ) + arena.capacity( );
+		}
+	};
+
+	document_cache::document_cache( std::size_t memory_budget,
+	                                GumboOptions const &options )
+	  : m_memory_budget( memory_budget )
+	  , m_options( options ) {}
+
+	document_cache::~document_cache( ) = default;
+
+	void document_cache::evict_to( std::size_t memory_limit ) {
+		while( m_memory_used > memory_limit and not m_lru.empty( ) ) {
+			auto const &victim = m_lru.back( );
+			m_memory_used -= victim->memory_used( );
+			m_entries.erase( victim->hash );
+			m_lru.pop_back( );
+			++m_evictions;
+		}
+	}
+
+	std::shared_ptr<gumbo_range const>
+	document_cache::get( daw::string_view html_document ) {
+		auto const hash = document_hash( html_document );
+		std::shared_ptr<entry_t const> found{ };
+		{
+			auto const lck = std::lock_guard( m_mutex );
+			if( auto pos = m_entries.find( hash ); pos != m_entries.end( ) ) {
+				m_lru.splice( m_lru.begin( ), m_lru, pos->second );
+				found = *pos->second;
+			}
+		}
+		// Comparing the documents does not need the lock
+		if( found and daw::string_view( found->html ) == html_document ) {
+			++m_hits;
+			return std::shared_ptr<gumbo_range const>( found, &found->range );
+		}
+		++m_misses;
+
+		// Parse without holding the lock, other threads can use the cache
+		// Not created const, destroying the range resets the entry's arena
+		std::shared_ptr<entry_t const> entry =
+		  std::make_shared<entry_t>( html_document, hash, m_options );
+		auto const size = entry->memory_used( );
+		auto result = std::shared_ptr<gumbo_range const>( entry, &entry->range );
+		auto const lck = std::lock_guard( m_mutex );
+		if( size > m_memory_budget ) {
+			return result;
+		}
+		if( auto pos = m_entries.find( hash ); pos != m_entries.end( ) ) {
+			// Another thread parsed it first, or the hash collides with another
+			// document.  Either way the newest parse replaces it
+			m_memory_used -= ( *pos->second )->memory_used( );
+			m_lru.erase( pos->second );
+			m_entries.erase( pos );
+		}
+		evict_to( m_memory_budget - size );
+		m_lru.push_front( std::move( entry ) );
+		m_entries.emplace( hash, m_lru.begin( ) );
+		m_memory_used += size;
+		return result;
+	}
+
+	void document_cache::clear( ) {
+		auto const lck = std::lock_guard( m_mutex );
+		m_entries.clear( );
+		m_lru.clear( );
+		m_memory_used = 0;
+	}
+
+	std::size_t document_cache::memory_budget( ) const {
+		auto const lck = std::lock_guard( m_mutex );
+		return m_memory_budget;
+	}
+
+	void document_cache::set_memory_budget( std::size_t memory_budget ) {
+		auto const lck = std::lock_guard( m_mutex );
+		m_memory_budget = memory_budget;
+		evict_to( m_memory_budget );
+	}
+
+	document_cache_stats document_cache::stats( ) const {
+		auto result = document_cache_stats{ };
+		result.hits = m_hits.load( std::memory_order_relaxed );
+		result.misses = m_misses.load( std::memory_order_relaxed );
+		result.evictions = m_evictions.load( std::memory_order_relaxed );
+		auto const lck = std::lock_guard( m_mutex );
+		result.entries = m_lru.size( );
+		result.memory_used = m_memory_used;
+		return result;
+	}
+} // namespace daw::gumbo
@@ -0,0 +1,510 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_encoding.h>
+#include <daw/gumbo_pp/gumbo_util.h>
+
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace daw::gumbo {
+	namespace {
+		constexpr std::size_t prescan_size = 1024U;
+
+		[[nodiscard]] constexpr bool is_space( char c ) noexcept {
+			return c == ' ' or c == '\t' or c == '\n' or c == '\r' or c == '\f';
+		}
+
+		[[nodiscard]] constexpr daw::string_view trim( daw::string_view str ) {
+			while( not str.empty( ) and is_space( str.front( ) ) ) {
+				str.remove_prefix( 1 );
+			}
+			while( not str.empty( ) and is_space( str.back( ) ) ) {
+				str.remove_suffix( 1 );
+			}
+			return str;
+		}
+
+		[[nodiscard]] constexpr bool iequal( daw::string_view lhs,
+		                                     daw::string_view rhs ) {
+			if( lhs.size( ) != rhs.size( ) ) {
+				return false;
+			}
+			for( std::size_t n = 0; n < lhs.size( ); ++n ) {
+				if( util_details::ascii_lower( lhs[n] ) !=
+				    util_details::ascii_lower( rhs[n] ) ) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		[[nodiscard]] inline std::uint64_t load_word( char const *ptr ) noexcept {
+			std::uint64_t result;
+			std::memcpy( &result, ptr, sizeof( result ) );
+			return result;
+		}
+
+		constexpr std::uint64_t high_bits = 0x8080'8080'8080'8080ULL;
+
+		/// Length of the well formed UTF-8 sequence starting at ptr, or 0
+		[[nodiscard]] constexpr std::size_t
+		utf8_sequence_size( unsigned char const *ptr,
+		                    std::size_t remaining ) noexcept {
+			auto const b0 = ptr[0];
+			if( b0 < 0x80U ) {
+				return 1;
+			}
+			auto const is_cont = [&]( std::size_t n ) {
+				return n < remaining and ( ptr[n] & 0xC0U ) == 0x80U;
+			};
+			if( b0 >= 0xC2U and b0 <= 0xDFU ) {
+				return is_cont( 1 ) ? 2 : 0;
+			}
+			if( b0 >= 0xE0U and b0 <= 0xEFU ) {
+				if( not is_cont( 1 ) or not is_cont( 2 ) ) {
+					return 0;
+				}
+				// Overlong encodings and surrogates
+				if( b0 == 0xE0U and ptr[1] < 0xA0U ) {
+					return 0;
+				}
+				if( b0 == 0xEDU and ptr[1] > 0x9FU ) {
+					return 0;
+				}
+				return 3;
+			}
+			if( b0 >= 0xF0U and b0 <= 0xF4U ) {
+				if( not is_cont( 1 ) or not is_cont( 2 ) or not is_cont( 3 ) ) {
+					return 0;
+				}
+				// Overlong encodings and code points above U+10FFFF
+				if( b0 == 0xF0U and ptr[1] < 0x90U ) {
+					return 0;
+				}
+				if( b0 == 0xF4U and ptr[1] > 0x8FU ) {
+					return 0;
+				}
+				return 4;
+			}
+			return 0;
+		}
+
+		void append_utf8( std::string &out, std::uint32_t cp ) {
+			if( cp < 0x80U ) {
+				out += static_cast<char>( cp );
+			} else if( cp < 0x800U ) {
+				out += static_cast<char>( 0xC0U | ( cp >> 6U ) );
+				out += static_cast<char>( 0x80U | ( cp & 0x3FU ) );
+			} else if( cp < 0x10000U ) {
+				out += static_cast<char>( 0xE0U | ( cp >> 12U ) );
+				out += static_cast<char>( 0x80U | ( ( cp >> 6U ) & 0x3FU ) );
+				out += static_cast<char>( 0x80U | ( cp & 0x3FU ) );
+			} else {
+				out += static_cast<char>( 0xF0U | ( cp >> 18U ) );
+				out += static_cast<char>( 0x80U | ( ( cp >> 12U ) & 0x3FU ) );
+				out += static_cast<char>( 0x80U | ( ( cp >> 6U ) & 0x3FU ) );
+				out += static_cast<char>( 0x80U | ( cp & 0x3FU ) );
+			}
+		}
+
+		constexpr std::uint32_t replacement_character = 0xFFFDU;
+
+		// windows-1252 code points for bytes 0x80-0x9F, the rest match latin1
+		constexpr std::array<std::uint16_t, 32> windows_1252_high = {
+		  0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+		  0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+		  0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+		  0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178 };
+
+		[[nodiscard]] constexpr std::uint32_t
+		iso_8859_15_code_point( unsigned char b ) noexcept {
+			switch( b ) {
+			case 0xA4U:
+				return 0x20ACU;
+			case 0xA6U:
+				return 0x0160U;
+			case 0xA8U:
+				return 0x0161U;
+			case 0xB4U:
+				return 0x017DU;
+			case 0xB8U:
+				return 0x017EU;
+			case 0xBCU:
+				return 0x0152U;
+			case 0xBDU:
+				return 0x0153U;
+			case 0xBEU:
+				return 0x0178U;
+			default:
+				return b;
+			}
+		}
+
+		/// Copy the leading run of ASCII to out, returning how much was copied
+		std::size_t copy_ascii( daw::string_view in, std::string &out ) {
+			std::size_t pos = 0;
+			while( pos + 8U <= in.size( ) and
+			       ( load_word( in.data( ) + pos ) & high_bits ) == 0 ) {
+				pos += 8U;
+			}
+			while( pos < in.size( ) and
+			       static_cast<unsigned char>( in[pos] ) < 0x80U ) {
+				++pos;
+			}
+			out.append( in.data( ), pos );
+			return pos;
+		}
+
+		void transcode_single_byte( daw::string_view in,
+		                            std::string &out,
+		                            html_encoding encoding ) {
+			std::size_t pos = 0;
+			while( pos < in.size( ) ) {
+				pos += copy_ascii( in.substr( pos ), out );
+				if( pos >= in.size( ) ) {
+					break;
+				}
+				auto const b = static_cast<unsigned char>( in[pos] );
+				if( encoding == html_encoding::iso_8859_15 ) {
+					append_utf8( out, iso_8859_15_code_point( b ) );
+				} else if( b < 0xA0U ) {
+					append_utf8( out, windows_1252_high[b - 0x80U] );
+				} else {
+					append_utf8( out, b );
+				}
+				++pos;
+			}
+		}
+
+		void repair_utf8( daw::string_view in, std::string &out ) {
+			auto const *ptr =
+			  reinterpret_cast<unsigned char const *>( in.data( ) );
+			std::size_t pos = 0;
+			while( pos < in.size( ) ) {
+				pos += copy_ascii( in.substr( pos ), out );
+				if( pos >= in.size( ) ) {
+					break;
+				}
+				auto const sz = utf8_sequence_size( ptr + pos, in.size( ) - pos );
+				if( sz == 0 ) {
+					append_utf8( out, replacement_character );
+					++pos;
+					continue;
+				}
+				out.append( in.data( ) + pos, sz );
+				pos += sz;
+			}
+		}
+
+		void transcode_utf16( daw::string_view in,
+		                      std::string &out,
+		                      bool little_endian ) {
+			auto const *ptr =
+			  reinterpret_cast<unsigned char const *>( in.data( ) );
+			auto const unit_at = [&]( std::size_t n ) -> std::uint32_t {
+				auto const lo = ptr[n + ( little_endian ? 0U : 1U )];
+				auto const hi = ptr[n + ( little_endian ? 1U : 0U )];
+				return static_cast<std::uint32_t>( lo ) |
+				       ( static_cast<std::uint32_t>( hi ) << 8U );
+			};
+			std::size_t pos = 0;
+			while( pos + 1U < in.size( ) ) {
+				auto const unit = unit_at( pos );
+				pos += 2U;
+				if( unit < 0xD800U or unit > 0xDFFFU ) {
+					append_utf8( out, unit );
+					continue;
+				}
+				if( unit <= 0xDBFFU and pos + 1U < in.size( ) ) {
+					auto const low = unit_at( pos );
+					if( low >= 0xDC00U and low <= 0xDFFFU ) {
+						pos += 2U;
+						append_utf8( out,
+						             0x10000U + ( ( unit - 0xD800U ) << 10U ) +
+						               ( low - 0xDC00U ) );
+						continue;
+					}
+				}
+				append_utf8( out, replacement_character );
+			}
+			if( pos < in.size( ) ) {
+				append_utf8( out, replacement_character );
+			}
+		}
+
+		[[nodiscard]] bool is_ascii( daw::string_view str ) noexcept {
+			std::size_t pos = 0;
+			while( pos + 8U <= str.size( ) ) {
+				if( ( load_word( str.data( ) + pos ) & high_bits ) != 0 ) {
+					return false;
+				}
+				pos += 8U;
+			}
+			for( ; pos < str.size( ); ++pos ) {
+				if( static_cast<unsigned char>( str[pos] ) >= 0x80U ) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// The value of an attribute in a tag, str starts after the tag name
+		[[nodiscard]] daw::string_view attribute_value( daw::string_view tag,
+		                                                daw::string_view name ) {
+			std::size_t pos = 0;
+			while( pos < tag.size( ) ) {
+				while( pos < tag.size( ) and
+				       ( is_space( tag[pos] ) or tag[pos] == '/' ) ) {
+					++pos;
+				}
+				auto const name_start = pos;
+				while( pos < tag.size( ) and not is_space( tag[pos] ) and
+				       tag[pos] != '=' and tag[pos] != '/' ) {
+					++pos;
+				}
+				auto const attr_name = tag.substr( name_start, pos - name_start );
+				while( pos < tag.size( ) and is_space( tag[pos] ) ) {
+					++pos;
+				}
+				daw::string_view value{ };
+				if( pos < tag.size( ) and tag[pos] == '=' ) {
+					++pos;
+					while( pos < tag.size( ) and is_space( tag[pos] ) ) {
+						++pos;
+					}
+					if( pos < tag.size( ) and
+					    ( tag[pos] == '"' or tag[pos] == '\'' ) ) {
+						auto const quote = tag[pos++];
+						auto const end_pos = tag.find( quote, pos );
+						auto const value_end =
+						  end_pos == daw::string_view::npos ? tag.size( ) : end_pos;
+						value = tag.substr( pos, value_end - pos );
+						pos = value_end + 1U;
+					} else {
+						auto const value_start = pos;
+						while( pos < tag.size( ) and not is_space( tag[pos] ) ) {
+							++pos;
+						}
+						value = tag.substr( value_start, pos - value_start );
+					}
+				}
+				if( attr_name.empty( ) ) {
+					if( pos < tag.size( ) ) {
+						++pos;
+					}
+					continue;
+				}
+				if( iequal( attr_name, name ) ) {
+					return value;
+				}
+			}
+			return { };
+		}
+
+		/// The charset in a content attribute like "text/html; charset=utf-8"
+		[[nodiscard]] daw::string_view
+		charset_from_content( daw::string_view content ) {
+			for( std::size_t pos = 0; pos + 7U <= content.size( ); ++pos ) {
+				if( not iequal( content.substr( pos, 7 ), "charset" ) ) {
+					continue;
+				}
+				auto value = trim( content.substr( pos + 7U ) );
+				if( value.empty( ) or value.front( ) != '=' ) {
+					continue;
+				}
+				value = trim( value.substr( 1 ) );
+				if( not value.empty( ) and
+				    ( value.front( ) == '"' or value.front( ) == '\'' ) ) {
+					auto const quote = value.front( );
+					value.remove_prefix( 1 );
+					return value.substr( 0, value.find( quote ) );
+				}
+				std::size_t end_pos = 0;
+				while( end_pos < value.size( ) and not is_space( value[end_pos] ) and
+				       value[end_pos] != ';' ) {
+					++end_pos;
+				}
+				return value.substr( 0, end_pos );
+			}
+			return { };
+		}
+
+		/// A simplified version of the HTML prescan for a character encoding
+		[[nodiscard]] html_encoding prescan_meta( daw::string_view head ) {
+			std::size_t pos = 0;
+			while( ( pos = head.find( '<', pos ) ) != daw::string_view::npos ) {
+				auto const rest = head.substr( pos );
+				if( rest.starts_with( "<!--" ) ) {
+					auto const end_pos = head.find( "-->", pos + 4U );
+					if( end_pos == daw::string_view::npos ) {
+						break;
+					}
+					pos = end_pos + 3U;
+					continue;
+				}
+				if( not util_details::starts_with_tag( rest.substr( 1 ), "meta" ) ) {
+					++pos;
+					continue;
+				}
+				auto const tag_end = head.find( '>', pos );
+				auto const tag = head.substr(
+				  pos + 5U,
+				  ( tag_end == daw::string_view::npos ? head.size( ) : tag_end ) -
+				    ( pos + 5U ) );
+				auto label = attribute_value( tag, "charset" );
+				if( label.empty( ) and
+				    iequal( trim( attribute_value( tag, "http-equiv" ) ),
+				            "content-type" ) ) {
+					label = charset_from_content( attribute_value( tag, "content" ) );
+				}
+				if( not label.empty( ) ) {
+					auto const result = encoding_from_label( label );
+					// A document that can be prescanned is not UTF-16
+					if( result == html_encoding::utf16le or
+					    result == html_encoding::utf16be ) {
+						return html_encoding::utf8;
+					}
+					return result;
+				}
+				if( tag_end == daw::string_view::npos ) {
+					break;
+				}
+				pos = tag_end + 1U;
+			}
+			return html_encoding::unknown;
+		}
+	} // namespace
+
+	html_encoding encoding_from_label( daw::string_view label ) {
+		label = trim( label );
+		for( auto l : { "utf-8", "utf8", "unicode-1-1-utf-8" } ) {
+			if( iequal( label, l ) ) {
+				return html_encoding::utf8;
+			}
+		}
+		for( auto l : { "utf-16", "utf-16le", "unicode", "ucs-2" } ) {
+			if( iequal( label, l ) ) {
+				return html_encoding::utf16le;
+			}
+		}
+		if( iequal( label, "utf-16be" ) ) {
+			return html_encoding::utf16be;
+		}
+		// Per the encoding standard, latin1 and ascii labels are windows-1252
+		for( auto l : { "windows-1252",
+		                "cp1252",
+		                "x-cp1252",
+		                "iso-8859-1",
+		                "iso8859-1",
+		                "iso_8859-1",
+		                "latin1",
+		                "l1",
+		                "us-ascii",
+		                "ascii",
+		                "ansi_x3.4-1968" } ) {
+			if( iequal( label, l ) ) {
+				return html_encoding::windows_1252;
+			}
+		}
+		for( auto l :
+		     { "iso-8859-15", "iso8859-15", "iso_8859-15", "latin9", "l9" } ) {
+			if( iequal( label, l ) ) {
+				return html_encoding::iso_8859_15;
+			}
+		}
+		if( label.empty( ) ) {
+			return html_encoding::unknown;
+		}
+		return html_encoding::unsupported;
+	}
+
+	encoding_sniff_result sniff_encoding( daw::string_view raw ) {
+		if( raw.starts_with( "\xEF\xBB\xBF" ) ) {
+			return { html_encoding::utf8, 3 };
+		}
+		if( raw.starts_with( "\xFF\xFE" ) ) {
+			return { html_encoding::utf16le, 2 };
+		}
+		if( raw.starts_with( "\xFE\xFF" ) ) {
+			return { html_encoding::utf16be, 2 };
+		}
+		return { prescan_meta( raw.substr( 0, prescan_size ) ), 0 };
+	}
+
+	bool is_valid_utf8( daw::string_view str ) noexcept {
+		auto const *ptr = reinterpret_cast<unsigned char const *>( str.data( ) );
+		std::size_t pos = 0;
+		while( pos < str.size( ) ) {
+			if( pos + 8U <= str.size( ) and
+			    ( load_word( str.data( ) + pos ) & high_bits ) == 0 ) {
+				pos += 8U;
+				continue;
+			}
+			auto const sz = utf8_sequence_size( ptr + pos, str.size( ) - pos );
+			if( sz == 0 ) {
+				return false;
+			}
+			pos += sz;
+		}
+		return true;
+	}
+
+	decoded_html to_utf8( daw::string_view raw, std::string &buffer ) {
+		auto const sniffed = sniff_encoding( raw );
+		auto const body = raw.substr( sniffed.bom_size );
+		auto encoding = sniffed.encoding;
+		switch( encoding ) {
+		case html_encoding::utf8:
+		case html_encoding::unknown:
+			if( is_valid_utf8( body ) ) {
+				return { body, html_encoding::utf8, false };
+			}
+			break;
+		case html_encoding::windows_1252:
+		case html_encoding::iso_8859_15:
+			if( is_ascii( body ) ) {
+				return { body, encoding, false };
+			}
+			break;
+		case html_encoding::utf16le:
+		case html_encoding::utf16be:
+			break;
+		case html_encoding::unsupported:
+			return { body, encoding, false };
+		}
+		buffer.clear( );
+		buffer.reserve( body.size( ) + body.size( ) / 2U );
+		switch( encoding ) {
+		case html_encoding::utf16le:
+		case html_encoding::utf16be:
+			transcode_utf16( body, buffer, encoding == html_encoding::utf16le );
+			break;
+		case html_encoding::utf8:
+			repair_utf8( body, buffer );
+			break;
+		case html_encoding::unknown:
+			// Undeclared and not UTF-8, the most common legacy encoding on the web
+			encoding = html_encoding::windows_1252;
+			transcode_single_byte( body, buffer, encoding );
+			break;
+		case html_encoding::windows_1252:
+		case html_encoding::iso_8859_15:
+			transcode_single_byte( body, buffer, encoding );
+			break;
+		case html_encoding::unsupported:
+			break;
+		}
+		return {
+		  daw::string_view( buffer.data( ), buffer.size( ) ), encoding, true };
+	}
+} // namespace daw::gumbo
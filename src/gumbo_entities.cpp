@@ -0,0 +1,289 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/details/html_entities.h>
+#include <daw/gumbo_pp/gumbo_entities.h>
+
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace daw::gumbo {
+	namespace {
+		// A reference longer than this at the end of a chunk is not held back.
+		// Only numeric references with many leading zeros can be longer
+		constexpr std::size_t max_pending_size = 64U;
+		constexpr char32_t replacement_character = 0xFFFDU;
+
+		struct decoded_reference {
+			// Source bytes the reference used, at least the &
+			std::size_t consumed;
+			std::size_t size;
+			char bytes[8];
+		};
+
+		[[nodiscard]] constexpr bool is_alnum( char c ) noexcept {
+			return ( c >= 'a' and c <= 'z' ) or ( c >= 'A' and c <= 'Z' ) or
+			       ( c >= '0' and c <= '9' );
+		}
+
+		[[nodiscard]] constexpr int digit_value( char c, bool hex ) noexcept {
+			if( c >= '0' and c <= '9' ) {
+				return c - '0';
+			}
+			if( hex ) {
+				if( c >= 'a' and c <= 'f' ) {
+					return c - 'a' + 10;
+				}
+				if( c >= 'A' and c <= 'F' ) {
+					return c - 'A' + 10;
+				}
+			}
+			return -1;
+		}
+
+		/// Numeric references to the C1 controls mean the windows-1252
+		/// characters, as in the HTML standard
+		[[nodiscard]] constexpr char32_t fix_code_point( std::uint32_t cp ) {
+			constexpr char32_t c1_replacements[32] = {
+			  0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+			  0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+			  0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+			  0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178 };
+			if( cp == 0 or cp > 0x10FFFFU or ( cp >= 0xD800U and cp <= 0xDFFFU ) ) {
+				return replacement_character;
+			}
+			if( cp >= 0x80U and cp <= 0x9FU ) {
+				return c1_replacements[cp - 0x80U];
+			}
+			return static_cast<char32_t>( cp );
+		}
+
+		[[nodiscard]] std::size_t encode_utf8( char32_t cp, char *out ) noexcept {
+			if( cp < 0x80U ) {
+				out[0] = static_cast<char>( cp );
+				return 1;
+			}
+			if( cp < 0x800U ) {
+				out[0] = static_cast<char>( 0xC0U | ( cp >> 6U ) );
+				out[1] = static_cast<char>( 0x80U | ( cp & 0x3FU ) );
+				return 2;
+			}
+			if( cp < 0x10000U ) {
+				out[0] = static_cast<char>( 0xE0U | ( cp >> 12U ) );
+				out[1] = static_cast<char>( 0x80U | ( ( cp >> 6U ) & 0x3FU ) );
+				out[2] = static_cast<char>( 0x80U | ( cp & 0x3FU ) );
+				return 3;
+			}
+			out[0] = static_cast<char>( 0xF0U | ( cp >> 18U ) );
+			out[1] = static_cast<char>( 0x80U | ( ( cp >> 12U ) & 0x3FU ) );
+			out[2] = static_cast<char>( 0x80U | ( ( cp >> 6U ) & 0x3FU ) );
+			out[3] = static_cast<char>( 0x80U | ( cp & 0x3FU ) );
+			return 4;
+		}
+
+		[[nodiscard]] decoded_reference literal_ampersand( ) noexcept {
+			auto result = decoded_reference{ 1, 1, { } };
+			result.bytes[0] = '&';
+			return result;
+		}
+
+		[[nodiscard]] decoded_reference
+		decode_numeric( daw::string_view str ) noexcept {
+			std::size_t pos = 2;
+			bool const hex = pos < str.size( ) and ( str[pos] | 0x20 ) == 'x';
+			if( hex ) {
+				++pos;
+			}
+			auto const first_digit = pos;
+			std::uint32_t value = 0;
+			for( ; pos < str.size( ); ++pos ) {
+				auto const digit = digit_value( str[pos], hex );
+				if( digit < 0 ) {
+					break;
+				}
+				// Saturate, anything past the last code point is replaced anyway
+				value = std::min( value * ( hex ? 16U : 10U ) +
+				                    static_cast<std::uint32_t>( digit ),
+				                  0x110000U );
+			}
+			if( pos == first_digit ) {
+				return literal_ampersand( );
+			}
+			if( pos < str.size( ) and str[pos] == ';' ) {
+				++pos;
+			}
+			auto result = decoded_reference{ pos, 0, { } };
+			result.size = encode_utf8( fix_code_point( value ), result.bytes );
+			return result;
+		}
+
+		[[nodiscard]] decoded_reference
+		from_entity( entity_details::html_entity const &entity,
+		             std::size_t consumed ) noexcept {
+			auto result = decoded_reference{ consumed, entity.utf8_size, { } };
+			std::memcpy( result.bytes, entity.utf8, entity.utf8_size );
+			return result;
+		}
+
+		/// Decode the reference at the start of str, which starts with &.  When
+		/// it is not a reference the & is kept
+		[[nodiscard]] decoded_reference
+		decode_reference( daw::string_view str ) noexcept {
+			if( str.size( ) < 2 ) {
+				return literal_ampersand( );
+			}
+			if( str[1] == '#' ) {
+				return decode_numeric( str );
+			}
+			std::size_t name_size = 0;
+			auto const max_name_size =
+			  std::min( str.size( ) - 1U, entity_details::max_entity_name_size + 1U );
+			while( name_size < max_name_size and is_alnum( str[1U + name_size] ) ) {
+				++name_size;
+			}
+			auto const name = str.substr( 1, name_size );
+			if( 1U + name_size < str.size( ) and str[1U + name_size] == ';' ) {
+				if( auto const *entity = entity_details::find_html_entity( name );
+				    entity ) {
+					return from_entity( *entity, name_size + 2U );
+				}
+			}
+			// The legacy references match the longest prefix without a ;
+			for( auto size = name_size; size > 1; --size ) {
+				auto const *entity =
+				  entity_details::find_html_entity( name.substr( 0, size ) );
+				if( entity and entity->legacy ) {
+					return from_entity( *entity, size + 1U );
+				}
+			}
+			return literal_ampersand( );
+		}
+
+		/// Could tail, which starts with &, be the start of a reference that the
+		/// next chunk completes
+		[[nodiscard]] bool maybe_incomplete( daw::string_view tail ) noexcept {
+			if( tail.size( ) >= max_pending_size ) {
+				return false;
+			}
+			for( std::size_t n = 1; n < tail.size( ); ++n ) {
+				if( not is_alnum( tail[n] ) and not( n == 1 and tail[n] == '#' ) ) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		[[nodiscard]] char const *find_ampersand( char const *first,
+		                                          char const *last ) noexcept {
+			// memchr is vectorized by the C library
+			auto const *pos = static_cast<char const *>(
+			  std::memchr( first, '&', static_cast<std::size_t>( last - first ) ) );
+			return pos ? pos : last;
+		}
+	} // namespace
+
+	void decode_entities( daw::string_view text, std::string &out ) {
+		char const *first = text.data( );
+		char const *const last = text.data( ) + text.size( );
+		while( first != last ) {
+			char const *amp = find_ampersand( first, last );
+			out.append( first, amp );
+			if( amp == last ) {
+				return;
+			}
+			auto const ref = decode_reference(
+			  daw::string_view( amp, static_cast<std::size_t>( last - amp ) ) );
+			out.append( ref.bytes, ref.size );
+			first = amp + ref.consumed;
+		}
+	}
+
+	std::string decode_entities( daw::string_view text ) {
+		std::string result{ };
+		result.reserve( text.size( ) );
+		decode_entities( text, result );
+		return result;
+	}
+
+	void decode_entities_in_place( std::string &text ) {
+		char *const data = text.data( );
+		std::size_t const size = text.size( );
+		std::size_t read_pos = 0;
+		std::size_t write_pos = 0;
+		while( read_pos < size ) {
+			char const *amp = find_ampersand( data + read_pos, data + size );
+			auto const next = static_cast<std::size_t>( amp - data );
+			if( write_pos != read_pos ) {
+				std::memmove( data + write_pos, data + read_pos, next - read_pos );
+			}
+			write_pos += next - read_pos;
+			read_pos = next;
+			if( read_pos == size ) {
+				break;
+			}
+			auto const ref = decode_reference(
+			  daw::string_view( data + read_pos, size - read_pos ) );
+			if( write_pos + ref.size > read_pos + ref.consumed ) {
+				// The output would overwrite source not read yet
+				auto rest = std::string( );
+				decode_entities(
+				  daw::string_view( data + read_pos, size - read_pos ), rest );
+				text.resize( write_pos );
+				text += rest;
+				return;
+			}
+			std::memcpy( data + write_pos, ref.bytes, ref.size );
+			write_pos += ref.size;
+			read_pos += ref.consumed;
+		}
+		text.resize( write_pos );
+	}
+
+	void entity_decoder::decode( daw::string_view chunk, std::string &out ) {
+		std::size_t pos = 0;
+		if( not m_pending.empty( ) ) {
+			auto const held = m_pending.size( );
+			auto const take = std::min( chunk.size( ), max_pending_size );
+			m_pending.append( chunk.data( ), take );
+			if( take == chunk.size( ) and maybe_incomplete( m_pending ) ) {
+				return;
+			}
+			auto const ref = decode_reference( m_pending );
+			out.append( ref.bytes, ref.size );
+			if( ref.consumed >= held ) {
+				pos = ref.consumed - held;
+			} else {
+				// The rest of what was held is name characters, not references
+				out.append( m_pending.data( ) + ref.consumed, held - ref.consumed );
+			}
+			m_pending.clear( );
+		}
+		auto const rest = chunk.substr( pos );
+		auto const tail_size = std::min( rest.size( ), max_pending_size );
+		auto const amp = rest.substr( rest.size( ) - tail_size ).rfind( '&' );
+		if( amp != daw::string_view::npos ) {
+			auto const split = rest.size( ) - tail_size + amp;
+			if( maybe_incomplete( rest.substr( split ) ) ) {
+				decode_entities( rest.substr( 0, split ), out );
+				m_pending.assign( rest.data( ) + split, rest.size( ) - split );
+				return;
+			}
+		}
+		decode_entities( rest, out );
+	}
+
+	void entity_decoder::finish( std::string &out ) {
+		decode_entities( m_pending, out );
+		m_pending.clear( );
+	}
+} // namespace daw::gumbo
@@ -0,0 +1,186 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_flat_document.h>
+#include <daw/gumbo_pp/gumbo_util.h>
+
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace daw::gumbo {
+	namespace {
+		/// Offset of ptr in html_doc, or fallback when it does not point into it
+		[[nodiscard]] std::uint32_t offset_in( daw::string_view html_doc,
+		                                       char const *ptr,
+		                                       unsigned fallback ) {
+			if( not ptr or ptr < html_doc.data( ) or
+			    ptr > html_doc.data( ) + html_doc.size( ) ) {
+				return static_cast<std::uint32_t>( fallback );
+			}
+			return static_cast<std::uint32_t>( ptr - html_doc.data( ) );
+		}
+
+		void element_spans( GumboElement const &element,
+		                    daw::string_view html_doc,
+		                    source_span &outer,
+		                    source_span &inner ) {
+			outer.first = offset_in(
+			  html_doc, element.original_tag.data, element.start_pos.offset );
+			inner.first =
+			  outer.first + static_cast<std::uint32_t>( element.original_tag.length );
+			inner.last = offset_in(
+			  html_doc, element.original_end_tag.data, element.end_pos.offset );
+			outer.last = inner.last + static_cast<std::uint32_t>(
+			                            element.original_end_tag.length );
+			inner.last = std::max( inner.first, inner.last );
+			outer.last = std::max( outer.first, outer.last );
+		}
+	} // namespace
+
+	flat_document::flat_document( gumbo_range const &rng,
+	                              std::shared_ptr<string_interner> interner )
+	  : m_interner( interner ? std::move( interner )
+	                         : std::make_shared<string_interner>( ) ) {
+		build( rng );
+	}
+
+	flat_document::flat_document( gumbo_range &&rng,
+	                              gumbo_tree_retention retention,
+	                              std::shared_ptr<string_interner> interner )
+	  : m_interner( interner ? std::move( interner )
+	                         : std::make_shared<string_interner>( ) ) {
+		build( rng );
+		m_source = rng.source( );
+		if( retention == gumbo_tree_retention::keep ) {
+			m_range.emplace( std::move( rng ) );
+			return;
+		}
+		m_nodes.clear( );
+		m_nodes.shrink_to_fit( );
+		// Destroy the tree now, not when the caller's moved from range goes away
+		auto released = std::move( rng );
+		(void)released;
+	}
+
+	flat_document::flat_document( gumbo_range &&rng,
+	                              std::shared_ptr<string_interner> interner )
+	  : flat_document( std::move( rng ),
+	                   gumbo_tree_retention::keep,
+	                   std::move( interner ) ) {}
+
+	flat_document::index_t flat_document::add_string( char const *str ) {
+		auto const result = static_cast<index_t>( m_strings.size( ) );
+		if( str ) {
+			m_strings.append( str );
+		}
+		m_strings.push_back( '\0' );
+		return result;
+	}
+
+	void flat_document::build( gumbo_range const &rng ) {
+		m_html = rng.html( );
+		GumboNode const *const doc_node = rng.document( );
+		GumboNode const *const root_node = rng.root( );
+		auto const html_size = static_cast<std::uint32_t>( m_html.size( ) );
+
+		m_attribute_first.push_back( 0 );
+		std::vector<std::pair<GumboNode const *, index_t>> stack{ };
+		stack.emplace_back( doc_node, npos );
+		while( not stack.empty( ) ) {
+			auto const [node, parent] = stack.back( );
+			stack.pop_back( );
+			auto const idx = size( );
+			if( node == root_node ) {
+				m_root = idx;
+			}
+			m_types.push_back( static_cast<std::uint8_t>( node->type ) );
+			m_parents.push_back( parent );
+			m_subtree_ends.push_back( idx + 1U );
+			m_nodes.push_back( node );
+
+			source_span outer{ };
+			source_span inner{ };
+			switch( node->type ) {
+			case GumboNodeType::GUMBO_NODE_ELEMENT:
+			case GumboNodeType::GUMBO_NODE_TEMPLATE: {
+				auto const &element = node->v.element;
+				m_tags.push_back( static_cast<std::uint16_t>( element.tag ) );
+				m_text.push_back( npos );
+				auto const attr_count = get_attribute_count( *node );
+				for( std::size_t n = 0; n < attr_count; ++n ) {
+					auto const *attr = get_attribute_node_at( *node, n );
+					auto const name =
+					  m_interner->intern( daw::string_view( attr->name ) );
+					auto const value = daw::string_view( attr->value );
+					if( m_interner->interns_value( value ) ) {
+						m_attributes.push_back(
+						  flat_attribute{ name, m_interner->intern( value ), 0 } );
+					} else {
+						m_attributes.push_back(
+						  flat_attribute{ name, no_atom, add_string( attr->value ) } );
+					}
+				}
+				element_spans( element, m_html, outer, inner );
+				break;
+			}
+			case GumboNodeType::GUMBO_NODE_DOCUMENT:
+				m_tags.push_back( static_cast<std::uint16_t>( GUMBO_TAG_UNKNOWN ) );
+				m_text.push_back( npos );
+				outer = source_span{ 0, html_size };
+				inner = outer;
+				break;
+			default: {
+				auto const &text = node->v.text;
+				m_tags.push_back( static_cast<std::uint16_t>( GUMBO_TAG_UNKNOWN ) );
+				m_text.push_back( add_string( text.text ) );
+				outer.first =
+				  offset_in( m_html, text.original_text.data, text.start_pos.offset );
+				outer.last =
+				  outer.first + static_cast<std::uint32_t>( text.original_text.length );
+				inner = outer;
+				break;
+			}
+			}
+			m_outer_spans.push_back( outer );
+			m_inner_spans.push_back( inner );
+			m_attribute_first.push_back(
+			  static_cast<index_t>( m_attributes.size( ) ) );
+
+			// Children are pushed in reverse so they are popped in document order
+			for( auto n = get_children_count( *node ); n > 0; --n ) {
+				stack.emplace_back( get_child_node_at( *node, n - 1U ), idx );
+			}
+		}
+		// Descendants always follow their parent, so walking backwards finishes
+		// each subtree before its parent is reached
+		for( auto idx = size( ); idx-- > 1U; ) {
+			auto const p = m_parents[idx];
+			m_subtree_ends[p] = std::max( m_subtree_ends[p], m_subtree_ends[idx] );
+		}
+	}
+
+	daw::string_view
+	flat_document::attribute_value( index_t idx, daw::string_view name ) const {
+		auto const name_atom = m_interner->find( name );
+		if( name_atom == no_atom ) {
+			return { };
+		}
+		if( auto const *attr = find_attribute( idx, name_atom ); attr ) {
+			return attribute_value( *attr );
+		}
+		return { };
+	}
+} // namespace daw::gumbo
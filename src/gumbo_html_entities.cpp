@@ -0,0 +1,2975 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+// The named character references of the WHATWG HTML standard and a perfect
+// hash of their names.  The hash is checked when this file is compiled.
+// Generated by tools/generate_html_entities.py from tools/entities.json, do
+// not edit by hand
+
+#include <daw/gumbo_pp/details/html_entities.h>
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace daw::gumbo::entity_details {
+	namespace {
+		constexpr char entity_names[] =
+		  "AEligAMPAacuteAbreveAcircAcyAfrAgraveAlphaAmacrAndAogonAopfApply"
+		  "FunctionAringAscrAssignAtildeAumlBackslashBarvBarwedBcyBecauseBe"
+		  "rnoullisBetaBfrBopfBreveBscrBumpeqCHcyCOPYCacuteCapCapitalDiffer"
+		  "entialDCayleysCcaronCcedilCcircCconintCdotCedillaCenterDotCfrChi"
+		  "CircleDotCircleMinusCirclePlusCircleTimesClockwiseContourIntegra"
+		  "lCloseCurlyDoubleQuoteCloseCurlyQuoteColonColoneCongruentConintC"
+		  "ontourIntegralCopfCoproductCounterClockwiseContourIntegralCrossC"
+		  "scrCupCupCapDDDDotrahdDJcyDScyDZcyDaggerDarrDashvDcaronDcyDelDel"
+		  "taDfrDiacriticalAcuteDiacriticalDotDiacriticalDoubleAcuteDiacrit"
+		  "icalGraveDiacriticalTildeDiamondDifferentialDDopfDotDotDotDotEqu"
+		  "alDoubleContourIntegralDoubleDotDoubleDownArrowDoubleLeftArrowDo"
+		  "ubleLeftRightArrowDoubleLeftTeeDoubleLongLeftArrowDoubleLongLeft"
+		  "RightArrowDoubleLongRightArrowDoubleRightArrowDoubleRightTeeDoub"
+		  "leUpArrowDoubleUpDownArrowDoubleVerticalBarDownArrowDownArrowBar"
+		  "DownArrowUpArrowDownBreveDownLeftRightVectorDownLeftTeeVectorDow"
+		  "nLeftVectorDownLeftVectorBarDownRightTeeVectorDownRightVectorDow"
+		  "nRightVectorBarDownTeeDownTeeArrowDownarrowDscrDstrokENGETHEacut"
+		  "eEcaronEcircEcyEdotEfrEgraveElementEmacrEmptySmallSquareEmptyVer"
+		  "ySmallSquareEogonEopfEpsilonEqualEqualTildeEquilibriumEscrEsimEt"
+		  "aEumlExistsExponentialEFcyFfrFilledSmallSquareFilledVerySmallSqu"
+		  "areFopfForAllFouriertrfFscrGJcyGTGammaGammadGbreveGcedilGcircGcy"
+		  "GdotGfrGgGopfGreaterEqualGreaterEqualLessGreaterFullEqualGreater"
+		  "GreaterGreaterLessGreaterSlantEqualGreaterTildeGscrGtHARDcyHacek"
+		  "HatHcircHfrHilbertSpaceHopfHorizontalLineHscrHstrokHumpDownHumpH"
+		  "umpEqualIEcyIJligIOcyIacuteIcircIcyIdotIfrIgraveImImacrImaginary"
+		  "IImpliesIntIntegralIntersectionInvisibleCommaInvisibleTimesIogon"
+		  "IopfIotaIscrItildeIukcyIumlJcircJcyJfrJopfJscrJsercyJukcyKHcyKJc"
+		  "yKappaKcedilKcyKfrKopfKscrLJcyLTLacuteLambdaLangLaplacetrfLarrLc"
+		  "aronLcedilLcyLeftAngleBracketLeftArrowLeftArrowBarLeftArrowRight"
+		  "ArrowLeftCeilingLeftDoubleBracketLeftDownTeeVectorLeftDownVector"
+		  "LeftDownVectorBarLeftFloorLeftRightArrowLeftRightVectorLeftTeeLe"
+		  "ftTeeArrowLeftTeeVectorLeftTriangleLeftTriangleBarLeftTriangleEq"
+		  "ualLeftUpDownVectorLeftUpTeeVectorLeftUpVectorLeftUpVectorBarLef"
+		  "tVectorLeftVectorBarLeftarrowLeftrightarrowLessEqualGreaterLessF"
+		  "ullEqualLessGreaterLessLessLessSlantEqualLessTildeLfrLlLleftarro"
+		  "wLmidotLongLeftArrowLongLeftRightArrowLongRightArrowLongleftarro"
+		  "wLongleftrightarrowLongrightarrowLopfLowerLeftArrowLowerRightArr"
+		  "owLscrLshLstrokLtMapMcyMediumSpaceMellintrfMfrMinusPlusMopfMscrM"
+		  "uNJcyNacuteNcaronNcedilNcyNegativeMediumSpaceNegativeThickSpaceN"
+		  "egativeThinSpaceNegativeVeryThinSpaceNestedGreaterGreaterNestedL"
+		  "essLessNewLineNfrNoBreakNonBreakingSpaceNopfNotNotCongruentNotCu"
+		  "pCapNotDoubleVerticalBarNotElementNotEqualNotEqualTildeNotExists"
+		  "NotGreaterNotGreaterEqualNotGreaterFullEqualNotGreaterGreaterNot"
+		  "GreaterLessNotGreaterSlantEqualNotGreaterTildeNotHumpDownHumpNot"
+		  "HumpEqualNotLeftTriangleNotLeftTriangleBarNotLeftTriangleEqualNo"
+		  "tLessNotLessEqualNotLessGreaterNotLessLessNotLessSlantEqualNotLe"
+		  "ssTildeNotNestedGreaterGreaterNotNestedLessLessNotPrecedesNotPre"
+		  "cedesEqualNotPrecedesSlantEqualNotReverseElementNotRightTriangle"
+		  "NotRightTriangleBarNotRightTriangleEqualNotSquareSubsetNotSquare"
+		  "SubsetEqualNotSquareSupersetNotSquareSupersetEqualNotSubsetNotSu"
+		  "bsetEqualNotSucceedsNotSucceedsEqualNotSucceedsSlantEqualNotSucc"
+		  "eedsTildeNotSupersetNotSupersetEqualNotTildeNotTildeEqualNotTild"
+		  "eFullEqualNotTildeTildeNotVerticalBarNscrNtildeNuOEligOacuteOcir"
+		  "cOcyOdblacOfrOgraveOmacrOmegaOmicronOopfOpenCurlyDoubleQuoteOpen"
+		  "CurlyQuoteOrOscrOslashOtildeOtimesOumlOverBarOverBraceOverBracke"
+		  "tOverParenthesisPartialDPcyPfrPhiPiPlusMinusPoincareplanePopfPrP"
+		  "recedesPrecedesEqualPrecedesSlantEqualPrecedesTildePrimeProductP"
+		  "roportionProportionalPscrPsiQUOTQfrQopfQscrRBarrREGRacuteRangRar"
+		  "rRarrtlRcaronRcedilRcyReReverseElementReverseEquilibriumReverseU"
+		  "pEquilibriumRfrRhoRightAngleBracketRightArrowRightArrowBarRightA"
+		  "rrowLeftArrowRightCeilingRightDoubleBracketRightDownTeeVectorRig"
+		  "htDownVectorRightDownVectorBarRightFloorRightTeeRightTeeArrowRig"
+		  "htTeeVectorRightTriangleRightTriangleBarRightTriangleEqualRightU"
+		  "pDownVectorRightUpTeeVectorRightUpVectorRightUpVectorBarRightVec"
+		  "torRightVectorBarRightarrowRopfRoundImpliesRrightarrowRscrRshRul"
+		  "eDelayedSHCHcySHcySOFTcySacuteScScaronScedilScircScySfrShortDown"
+		  "ArrowShortLeftArrowShortRightArrowShortUpArrowSigmaSmallCircleSo"
+		  "pfSqrtSquareSquareIntersectionSquareSubsetSquareSubsetEqualSquar"
+		  "eSupersetSquareSupersetEqualSquareUnionSscrStarSubSubsetSubsetEq"
+		  "ualSucceedsSucceedsEqualSucceedsSlantEqualSucceedsTildeSuchThatS"
+		  "umSupSupersetSupersetEqualSupsetTHORNTRADETSHcyTScyTabTauTcaronT"
+		  "cedilTcyTfrThereforeThetaThickSpaceThinSpaceTildeTildeEqualTilde"
+		  "FullEqualTildeTildeTopfTripleDotTscrTstrokUacuteUarrUarrocirUbrc"
+		  "yUbreveUcircUcyUdblacUfrUgraveUmacrUnderBarUnderBraceUnderBracke"
+		  "tUnderParenthesisUnionUnionPlusUogonUopfUpArrowUpArrowBarUpArrow"
+		  "DownArrowUpDownArrowUpEquilibriumUpTeeUpTeeArrowUparrowUpdownarr"
+		  "owUpperLeftArrowUpperRightArrowUpsiUpsilonUringUscrUtildeUumlVDa"
+		  "shVbarVcyVdashVdashlVeeVerbarVertVerticalBarVerticalLineVertical"
+		  "SeparatorVerticalTildeVeryThinSpaceVfrVopfVscrVvdashWcircWedgeWf"
+		  "rWopfWscrXfrXiXopfXscrYAcyYIcyYUcyYacuteYcircYcyYfrYopfYscrYumlZ"
+		  "HcyZacuteZcaronZcyZdotZeroWidthSpaceZetaZfrZopfZscraacuteabrevea"
+		  "cacEacdacircacuteacyaeligafafragravealefsymalephalphaamacramalga"
+		  "mpandandandanddandslopeandvangangeangleangmsdangmsdaaangmsdabang"
+		  "msdacangmsdadangmsdaeangmsdafangmsdagangmsdahangrtangrtvbangrtvb"
+		  "dangsphangstangzarraogonaopfapapEapacirapeapidaposapproxapproxeq"
+		  "aringascrastasympasympeqatildeaumlawconintawintbNotbackcongbacke"
+		  "psilonbackprimebacksimbacksimeqbarveebarwedbarwedgebbrkbbrktbrkb"
+		  "congbcybdquobecausbecausebemptyvbepsibernoubetabethbetweenbfrbig"
+		  "capbigcircbigcupbigodotbigoplusbigotimesbigsqcupbigstarbigtriang"
+		  "ledownbigtriangleupbiguplusbigveebigwedgebkarowblacklozengeblack"
+		  "squareblacktriangleblacktriangledownblacktriangleleftblacktriang"
+		  "lerightblankblk12blk14blk34blockbnebnequivbnotbopfbotbottombowti"
+		  "eboxDLboxDRboxDlboxDrboxHboxHDboxHUboxHdboxHuboxULboxURboxUlboxU"
+		  "rboxVboxVHboxVLboxVRboxVhboxVlboxVrboxboxboxdLboxdRboxdlboxdrbox"
+		  "hboxhDboxhUboxhdboxhuboxminusboxplusboxtimesboxuLboxuRboxulboxur"
+		  "boxvboxvHboxvLboxvRboxvhboxvlboxvrbprimebrevebrvbarbscrbsemibsim"
+		  "bsimebsolbsolbbsolhsubbullbulletbumpbumpEbumpebumpeqcacutecapcap"
+		  "andcapbrcupcapcapcapcupcapdotcapscaretcaronccapsccaronccedilccir"
+		  "cccupsccupssmcdotcedilcemptyvcentcenterdotcfrchcycheckcheckmarkc"
+		  "hicircirEcirccirceqcirclearrowleftcirclearrowrightcircledRcircle"
+		  "dScircledastcircledcirccircleddashcirecirfnintcirmidcirscirclubs"
+		  "clubsuitcoloncolonecoloneqcommacommatcompcompfncomplementcomplex"
+		  "escongcongdotconintcopfcoprodcopycopysrcrarrcrosscscrcsubcsubecs"
+		  "upcsupectdotcudarrlcudarrrcueprcuesccularrcularrpcupcupbrcapcupc"
+		  "apcupcupcupdotcuporcupscurarrcurarrmcurlyeqpreccurlyeqsucccurlyv"
+		  "eecurlywedgecurrencurvearrowleftcurvearrowrightcuveecuwedcwconin"
+		  "tcwintcylctydArrdHardaggerdalethdarrdashdashvdbkarowdblacdcarond"
+		  "cyddddaggerddarrddotseqdegdeltademptyvdfishtdfrdharldharrdiamdia"
+		  "monddiamondsuitdiamsdiedigammadisindivdividedivideontimesdivonxd"
+		  "jcydlcorndlcropdollardopfdotdoteqdoteqdotdotminusdotplusdotsquar"
+		  "edoublebarwedgedownarrowdowndownarrowsdownharpoonleftdownharpoon"
+		  "rightdrbkarowdrcorndrcropdscrdscydsoldstrokdtdotdtridtrifduarrdu"
+		  "hardwangledzcydzigrarreDDoteDoteacuteeasterecaronecirecircecolon"
+		  "ecyedoteeefDotefregegraveegsegsdotelelintersellelselsdotemacremp"
+		  "tyemptysetemptyvemspemsp13emsp14engenspeogoneopfepareparslepluse"
+		  "psiepsilonepsiveqcirceqcoloneqsimeqslantgtreqslantlessequalseque"
+		  "stequivequivDDeqvparslerDoterarrescresdotesimetaetheumleuroexcle"
+		  "xistexpectationexponentialefallingdotseqfcyfemaleffiligffligffll"
+		  "igffrfiligfjligflatflligfltnsfnoffopfforallforkforkvfpartintfrac"
+		  "12frac13frac14frac15frac16frac18frac23frac25frac34frac35frac38fr"
+		  "ac45frac56frac58frac78fraslfrownfscrgEgElgacutegammagammadgapgbr"
+		  "evegcircgcygdotgegelgeqgeqqgeqslantgesgesccgesdotgesdotogesdotol"
+		  "geslgeslesgfrggggggimelgjcyglglEglagljgnEgnapgnapproxgnegneqgneq"
+		  "qgnsimgopfgravegscrgsimgsimegsimlgtgtccgtcirgtdotgtlPargtquestgt"
+		  "rapproxgtrarrgtrdotgtreqlessgtreqqlessgtrlessgtrsimgvertneqqgvnE"
+		  "hArrhairsphalfhamilthardcyharrharrcirharrwhbarhcircheartsheartsu"
+		  "ithellipherconhfrhksearowhkswarowhoarrhomththookleftarrowhookrig"
+		  "htarrowhopfhorbarhscrhslashhstrokhybullhypheniacuteicicircicyiec"
+		  "yiexcliffifrigraveiiiiiintiiintiinfiniiotaijligimacrimageimaglin"
+		  "eimagpartimathimofimpedinincareinfininfintieinodotintintcalinteg"
+		  "ersintercalintlarhkintprodiocyiogoniopfiotaiprodiquestiscrisinis"
+		  "inEisindotisinsisinsvisinvititildeiukcyiumljcircjcyjfrjmathjopfj"
+		  "scrjsercyjukcykappakappavkcedilkcykfrkgreenkhcykjcykopfkscrlAarr"
+		  "lArrlAtaillBarrlElEglHarlacutelaemptyvlagranlambdalanglangdlangl"
+		  "elaplaquolarrlarrblarrbfslarrfslarrhklarrlplarrpllarrsimlarrtlla"
+		  "tlataillatelateslbarrlbbrklbracelbracklbrkelbrksldlbrkslulcaronl"
+		  "cedillceillcublcyldcaldquoldquorldrdharldrusharldshleleftarrowle"
+		  "ftarrowtailleftharpoondownleftharpoonupleftleftarrowsleftrightar"
+		  "rowleftrightarrowsleftrightharpoonsleftrightsquigarrowleftthreet"
+		  "imeslegleqleqqleqslantleslescclesdotlesdotolesdotorlesglesgesles"
+		  "sapproxlessdotlesseqgtrlesseqqgtrlessgtrlesssimlfishtlfloorlfrlg"
+		  "lgElhardlharulharullhblkljcyllllarrllcornerllhardlltrilmidotlmou"
+		  "stlmoustachelnElnaplnapproxlnelneqlneqqlnsimloangloarrlobrklongl"
+		  "eftarrowlongleftrightarrowlongmapstolongrightarrowlooparrowleftl"
+		  "ooparrowrightloparlopflopluslotimeslowastlowbarlozlozengelozflpa"
+		  "rlparltlrarrlrcornerlrharlrhardlrmlrtrilsaquolscrlshlsimlsimelsi"
+		  "mglsqblsquolsquorlstrokltltccltcirltdotlthreeltimesltlarrltquest"
+		  "ltrParltriltrieltriflurdsharluruharlvertneqqlvnEmDDotmacrmalemal"
+		  "tmaltesemapmapstomapstodownmapstoleftmapstoupmarkermcommamcymdas"
+		  "hmeasuredanglemfrmhomicromidmidastmidcirmiddotminusminusbminusdm"
+		  "inusdumlcpmldrmnplusmodelsmopfmpmscrmstposmumultimapmumapnGgnGtn"
+		  "GtvnLeftarrownLeftrightarrownLlnLtnLtvnRightarrownVDashnVdashnab"
+		  "lanacutenangnapnapEnapidnaposnapproxnaturnaturalnaturalsnbspnbum"
+		  "pnbumpencapncaronncedilncongncongdotncupncyndashneneArrnearhknea"
+		  "rrnearrownedotnequivnesearnesimnexistnexistsnfrngEngengeqngeqqng"
+		  "eqslantngesngsimngtngtrnhArrnharrnhparninisnisdnivnjcynlArrnlEnl"
+		  "arrnldrnlenleftarrownleftrightarrownleqnleqqnleqslantnlesnlessnl"
+		  "simnltnltrinltrienmidnopfnotnotinnotinEnotindotnotinvanotinvbnot"
+		  "invcnotninotnivanotnivbnotnivcnparnparallelnparslnpartnpolintnpr"
+		  "nprcuenprenprecnpreceqnrArrnrarrnrarrcnrarrwnrightarrownrtrinrtr"
+		  "ienscnsccuenscenscrnshortmidnshortparallelnsimnsimensimeqnsmidns"
+		  "parnsqsubensqsupensubnsubEnsubensubsetnsubseteqnsubseteqqnsuccns"
+		  "ucceqnsupnsupEnsupensupsetnsupseteqnsupseteqqntglntildentlgntria"
+		  "ngleleftntrianglelefteqntrianglerightntrianglerighteqnunumnumero"
+		  "numspnvDashnvHarrnvapnvdashnvgenvgtnvinfinnvlArrnvlenvltnvltrien"
+		  "vrArrnvrtrienvsimnwArrnwarhknwarrnwarrownwnearoSoacuteoastociroc"
+		  "ircocyodashodblacodivodotodsoldoeligofcirofrogonograveogtohbaroh"
+		  "mointolarrolcirolcrossolineoltomacromegaomicronomidominusoopfopa"
+		  "roperpoplusororarrordorderorderofordfordmorigoforororslopeorvosc"
+		  "roslashosolotildeotimesotimesasoumlovbarparparaparallelparsimpar"
+		  "slpartpcypercntperiodpermilperppertenkpfrphiphivphmmatphonepipit"
+		  "chforkpivplanckplanckhplankvplusplusacirplusbpluscirplusdoplusdu"
+		  "pluseplusmnplussimplustwopmpointintpopfpoundprprEprapprcueprepre"
+		  "cprecapproxpreccurlyeqpreceqprecnapproxprecneqqprecnsimprecsimpr"
+		  "imeprimesprnEprnapprnsimprodprofalarproflineprofsurfpropproptopr"
+		  "simprurelpscrpsipuncspqfrqintqopfqprimeqscrquaternionsquatintque"
+		  "stquesteqquotrAarrrArrrAtailrBarrrHarraceracuteradicraemptyvrang"
+		  "rangdrangerangleraquorarrrarraprarrbrarrbfsrarrcrarrfsrarrhkrarr"
+		  "lprarrplrarrsimrarrtlrarrwratailratiorationalsrbarrrbbrkrbracerb"
+		  "rackrbrkerbrksldrbrkslurcaronrcedilrceilrcubrcyrdcardldharrdquor"
+		  "dquorrdshrealrealinerealpartrealsrectregrfishtrfloorrfrrhardrhar"
+		  "urharulrhorhovrightarrowrightarrowtailrightharpoondownrightharpo"
+		  "onuprightleftarrowsrightleftharpoonsrightrightarrowsrightsquigar"
+		  "rowrightthreetimesringrisingdotseqrlarrrlharrlmrmoustrmoustacher"
+		  "nmidroangroarrrobrkroparropfroplusrotimesrparrpargtrppolintrrarr"
+		  "rsaquorscrrshrsqbrsquorsquorrthreertimesrtrirtriertrifrtriltriru"
+		  "luharrxsacutesbquoscscEscapscaronsccuescescedilscircscnEscnapscn"
+		  "simscpolintscsimscysdotsdotbsdoteseArrsearhksearrsearrowsectsemi"
+		  "seswarsetminussetmnsextsfrsfrownsharpshchcyshcyshortmidshortpara"
+		  "llelshysigmasigmafsigmavsimsimdotsimesimeqsimgsimgEsimlsimlEsimn"
+		  "esimplussimrarrslarrsmallsetminussmashpsmeparslsmidsmilesmtsmtes"
+		  "mtessoftcysolsolbsolbarsopfspadesspadesuitsparsqcapsqcapssqcupsq"
+		  "cupssqsubsqsubesqsubsetsqsubseteqsqsupsqsupesqsupsetsqsupseteqsq"
+		  "usquaresquarfsqufsrarrsscrssetmnssmilesstarfstarstarfstraighteps"
+		  "ilonstraightphistrnssubsubEsubdotsubesubedotsubmultsubnEsubnesub"
+		  "plussubrarrsubsetsubseteqsubseteqqsubsetneqsubsetneqqsubsimsubsu"
+		  "bsubsupsuccsuccapproxsucccurlyeqsucceqsuccnapproxsuccneqqsuccnsi"
+		  "msuccsimsumsungsupsup1sup2sup3supEsupdotsupdsubsupesupedotsuphso"
+		  "lsuphsubsuplarrsupmultsupnEsupnesupplussupsetsupseteqsupseteqqsu"
+		  "psetneqsupsetneqqsupsimsupsubsupsupswArrswarhkswarrswarrowswnwar"
+		  "szligtargettautbrktcarontcediltcytdottelrectfrthere4thereforethe"
+		  "tathetasymthetavthickapproxthicksimthinspthkapthksimthorntildeti"
+		  "mestimesbtimesbartimesdtinttoeatoptopbottopcirtopftopforktosatpr"
+		  "imetradetriangletriangledowntrianglelefttrianglelefteqtriangleqt"
+		  "rianglerighttrianglerighteqtridottrietriminustriplustrisbtritime"
+		  "trpeziumtscrtscytshcytstroktwixttwoheadleftarrowtwoheadrightarro"
+		  "wuArruHaruacuteuarrubrcyubreveucircucyudarrudblacudharufishtufru"
+		  "graveuharluharruhblkulcornulcornerulcropultriumacrumluogonuopfup"
+		  "arrowupdownarrowupharpoonleftupharpoonrightuplusupsiupsihupsilon"
+		  "upuparrowsurcornurcornerurcropuringurtriuscrutdotutildeutriutrif"
+		  "uuarruumluwanglevArrvBarvBarvvDashvangrtvarepsilonvarkappavarnot"
+		  "hingvarphivarpivarproptovarrvarrhovarsigmavarsubsetneqvarsubsetn"
+		  "eqqvarsupsetneqvarsupsetneqqvarthetavartriangleleftvartriangleri"
+		  "ghtvcyvdashveeveebarveeeqvellipverbarvertvfrvltrivnsubvnsupvopfv"
+		  "propvrtrivscrvsubnEvsubnevsupnEvsupnevzigzagwcircwedbarwedgewedg"
+		  "eqweierpwfrwopfwpwrwreathwscrxcapxcircxcupxdtrixfrxhArrxharrxixl"
+		  "ArrxlarrxmapxnisxodotxopfxoplusxotimexrArrxrarrxscrxsqcupxuplusx"
+		  "utrixveexwedgeyacuteyacyycircycyyenyfryicyyopfyscryucyyumlzacute"
+		  "zcaronzcyzdotzeetrfzetazfrzhcyzigrarrzopfzscrzwjzwnj";
+
+		constexpr html_entity entities[] = {
+		  { 0, 5, 2, true, "\xc3\x86" },
+		  { 5, 3, 1, true, "\x26" },
+		  { 8, 6, 2, true, "\xc3\x81" },
+		  { 14, 6, 2, false, "\xc4\x82" },
+		  { 20, 5, 2, true, "\xc3\x82" },
+		  { 25, 3, 2, false, "\xd0\x90" },
+		  { 28, 3, 4, false, "\xf0\x9d\x94\x84" },
+		  { 31, 6, 2, true, "\xc3\x80" },
+		  { 37, 5, 2, false, "\xce\x91" },
+		  { 42, 5, 2, false, "\xc4\x80" },
+		  { 47, 3, 3, false, "\xe2\xa9\x93" },
+		  { 50, 5, 2, false, "\xc4\x84" },
+		  { 55, 4, 4, false, "\xf0\x9d\x94\xb8" },
+		  { 59, 13, 3, false, "\xe2\x81\xa1" },
+		  { 72, 5, 2, true, "\xc3\x85" },
+		  { 77, 4, 4, false, "\xf0\x9d\x92\x9c" },
+		  { 81, 6, 3, false, "\xe2\x89\x94" },
+		  { 87, 6, 2, true, "\xc3\x83" },
+		  { 93, 4, 2, true, "\xc3\x84" },
+		  { 97, 9, 3, false, "\xe2\x88\x96" },
+		  { 106, 4, 3, false, "\xe2\xab\xa7" },
+		  { 110, 6, 3, false, "\xe2\x8c\x86" },
+		  { 116, 3, 2, false, "\xd0\x91" },
+		  { 119, 7, 3, false, "\xe2\x88\xb5" },
+		  { 126, 10, 3, false, "\xe2\x84\xac" },
+		  { 136, 4, 2, false, "\xce\x92" },
+		  { 140, 3, 4, false, "\xf0\x9d\x94\x85" },
+		  { 143, 4, 4, false, "\xf0\x9d\x94\xb9" },
+		  { 147, 5, 2, false, "\xcb\x98" },
+		  { 152, 4, 3, false, "\xe2\x84\xac" },
+		  { 156, 6, 3, false, "\xe2\x89\x8e" },
+		  { 162, 4, 2, false, "\xd0\xa7" },
+		  { 166, 4, 2, true, "\xc2\xa9" },
+		  { 170, 6, 2, false, "\xc4\x86" },
+		  { 176, 3, 3, false, "\xe2\x8b\x92" },
+		  { 179, 20, 3, false, "\xe2\x85\x85" },
+		  { 199, 7, 3, false, "\xe2\x84\xad" },
+		  { 206, 6, 2, false, "\xc4\x8c" },
+		  { 212, 6, 2, true, "\xc3\x87" },
+		  { 218, 5, 2, false, "\xc4\x88" },
+		  { 223, 7, 3, false, "\xe2\x88\xb0" },
+		  { 230, 4, 2, false, "\xc4\x8a" },
+		  { 234, 7, 2, false, "\xc2\xb8" },
+		  { 241, 9, 2, false, "\xc2\xb7" },
+		  { 250, 3, 3, false, "\xe2\x84\xad" },
+		  { 253, 3, 2, false, "\xce\xa7" },
+		  { 256, 9, 3, false, "\xe2\x8a\x99" },
+		  { 265, 11, 3, false, "\xe2\x8a\x96" },
+		  { 276, 10, 3, false, "\xe2\x8a\x95" },
+		  { 286, 11, 3, false, "\xe2\x8a\x97" },
+		  { 297, 24, 3, false, "\xe2\x88\xb2" },
+		  { 321, 21, 3, false, "\xe2\x80\x9d" },
+		  { 342, 15, 3, false, "\xe2\x80\x99" },
+		  { 357, 5, 3, false, "\xe2\x88\xb7" },
+		  { 362, 6, 3, false, "\xe2\xa9\xb4" },
+		  { 368, 9, 3, false, "\xe2\x89\xa1" },
+		  { 377, 6, 3, false, "\xe2\x88\xaf" },
+		  { 383, 15, 3, false, "\xe2\x88\xae" },
+		  { 398, 4, 3, false, "\xe2\x84\x82" },
+		  { 402, 9, 3, false, "\xe2\x88\x90" },
+		  { 411, 31, 3, false, "\xe2\x88\xb3" },
+		  { 442, 5, 3, false, "\xe2\xa8\xaf" },
+		  { 447, 4, 4, false, "\xf0\x9d\x92\x9e" },
+		  { 451, 3, 3, false, "\xe2\x8b\x93" },
+		  { 454, 6, 3, false, "\xe2\x89\x8d" },
+		  { 460, 2, 3, false, "\xe2\x85\x85" },
+		  { 462, 8, 3, false, "\xe2\xa4\x91" },
+		  { 470, 4, 2, false, "\xd0\x82" },
+		  { 474, 4, 2, false, "\xd0\x85" },
+		  { 478, 4, 2, false, "\xd0\x8f" },
+		  { 482, 6, 3, false, "\xe2\x80\xa1" },
+		  { 488, 4, 3, false, "\xe2\x86\xa1" },
+		  { 492, 5, 3, false, "\xe2\xab\xa4" },
+		  { 497, 6, 2, false, "\xc4\x8e" },
+		  { 503, 3, 2, false, "\xd0\x94" },
+		  { 506, 3, 3, false, "\xe2\x88\x87" },
+		  { 509, 5, 2, false, "\xce\x94" },
+		  { 514, 3, 4, false, "\xf0\x9d\x94\x87" },
+		  { 517, 16, 2, false, "\xc2\xb4" },
+		  { 533, 14, 2, false, "\xcb\x99" },
+		  { 547, 22, 2, false, "\xcb\x9d" },
+		  { 569, 16, 1, false, "\x60" },
+		  { 585, 16, 2, false, "\xcb\x9c" },
+		  { 601, 7, 3, false, "\xe2\x8b\x84" },
+		  { 608, 13, 3, false, "\xe2\x85\x86" },
+		  { 621, 4, 4, false, "\xf0\x9d\x94\xbb" },
+		  { 625, 3, 2, false, "\xc2\xa8" },
+		  { 628, 6, 3, false, "\xe2\x83\x9c" },
+		  { 634, 8, 3, false, "\xe2\x89\x90" },
+		  { 642, 21, 3, false, "\xe2\x88\xaf" },
+		  { 663, 9, 2, false, "\xc2\xa8" },
+		  { 672, 15, 3, false, "\xe2\x87\x93" },
+		  { 687, 15, 3, false, "\xe2\x87\x90" },
+		  { 702, 20, 3, false, "\xe2\x87\x94" },
+		  { 722, 13, 3, false, "\xe2\xab\xa4" },
+		  { 735, 19, 3, false, "\xe2\x9f\xb8" },
+		  { 754, 24, 3, false, "\xe2\x9f\xba" },
+		  { 778, 20, 3, false, "\xe2\x9f\xb9" },
+		  { 798, 16, 3, false, "\xe2\x87\x92" },
+		  { 814, 14, 3, false, "\xe2\x8a\xa8" },
+		  { 828, 13, 3, false, "\xe2\x87\x91" },
+		  { 841, 17, 3, false, "\xe2\x87\x95" },
+		  { 858, 17, 3, false, "\xe2\x88\xa5" },
+		  { 875, 9, 3, false, "\xe2\x86\x93" },
+		  { 884, 12, 3, false, "\xe2\xa4\x93" },
+		  { 896, 16, 3, false, "\xe2\x87\xb5" },
+		  { 912, 9, 2, false, "\xcc\x91" },
+		  { 921, 19, 3, false, "\xe2\xa5\x90" },
+		  { 940, 17, 3, false, "\xe2\xa5\x9e" },
+		  { 957, 14, 3, false, "\xe2\x86\xbd" },
+		  { 971, 17, 3, false, "\xe2\xa5\x96" },
+		  { 988, 18, 3, false, "\xe2\xa5\x9f" },
+		  { 1006, 15, 3, false, "\xe2\x87\x81" },
+		  { 1021, 18, 3, false, "\xe2\xa5\x97" },
+		  { 1039, 7, 3, false, "\xe2\x8a\xa4" },
+		  { 1046, 12, 3, false, "\xe2\x86\xa7" },
+		  { 1058, 9, 3, false, "\xe2\x87\x93" },
+		  { 1067, 4, 4, false, "\xf0\x9d\x92\x9f" },
+		  { 1071, 6, 2, false, "\xc4\x90" },
+		  { 1077, 3, 2, false, "\xc5\x8a" },
+		  { 1080, 3, 2, true, "\xc3\x90" },
+		  { 1083, 6, 2, true, "\xc3\x89" },
+		  { 1089, 6, 2, false, "\xc4\x9a" },
+		  { 1095, 5, 2, true, "\xc3\x8a" },
+		  { 1100, 3, 2, false, "\xd0\xad" },
+		  { 1103, 4, 2, false, "\xc4\x96" },
+		  { 1107, 3, 4, false, "\xf0\x9d\x94\x88" },
+		  { 1110, 6, 2, true, "\xc3\x88" },
+		  { 1116, 7, 3, false, "\xe2\x88\x88" },
+		  { 1123, 5, 2, false, "\xc4\x92" },
+		  { 1128, 16, 3, false, "\xe2\x97\xbb" },
+		  { 1144, 20, 3, false, "\xe2\x96\xab" },
+		  { 1164, 5, 2, false, "\xc4\x98" },
+		  { 1169, 4, 4, false, "\xf0\x9d\x94\xbc" },
+		  { 1173, 7, 2, false, "\xce\x95" },
+		  { 1180, 5, 3, false, "\xe2\xa9\xb5" },
+		  { 1185, 10, 3, false, "\xe2\x89\x82" },
+		  { 1195, 11, 3, false, "\xe2\x87\x8c" },
+		  { 1206, 4, 3, false, "\xe2\x84\xb0" },
+		  { 1210, 4, 3, false, "\xe2\xa9\xb3" },
+		  { 1214, 3, 2, false, "\xce\x97" },
+		  { 1217, 4, 2, true, "\xc3\x8b" },
+		  { 1221, 6, 3, false, "\xe2\x88\x83" },
+		  { 1227, 12, 3, false, "\xe2\x85\x87" },
+		  { 1239, 3, 2, false, "\xd0\xa4" },
+		  { 1242, 3, 4, false, "\xf0\x9d\x94\x89" },
+		  { 1245, 17, 3, false, "\xe2\x97\xbc" },
+		  { 1262, 21, 3, false, "\xe2\x96\xaa" },
+		  { 1283, 4, 4, false, "\xf0\x9d\x94\xbd" },
+		  { 1287, 6, 3, false, "\xe2\x88\x80" },
+		  { 1293, 10, 3, false, "\xe2\x84\xb1" },
+		  { 1303, 4, 3, false, "\xe2\x84\xb1" },
+		  { 1307, 4, 2, false, "\xd0\x83" },
+		  { 1311, 2, 1, true, "\x3e" },
+		  { 1313, 5, 2, false, "\xce\x93" },
+		  { 1318, 6, 2, false, "\xcf\x9c" },
+		  { 1324, 6, 2, false, "\xc4\x9e" },
+		  { 1330, 6, 2, false, "\xc4\xa2" },
+		  { 1336, 5, 2, false, "\xc4\x9c" },
+		  { 1341, 3, 2, false, "\xd0\x93" },
+		  { 1344, 4, 2, false, "\xc4\xa0" },
+		  { 1348, 3, 4, false, "\xf0\x9d\x94\x8a" },
+		  { 1351, 2, 3, false, "\xe2\x8b\x99" },
+		  { 1353, 4, 4, false, "\xf0\x9d\x94\xbe" },
+		  { 1357, 12, 3, false, "\xe2\x89\xa5" },
+		  { 1369, 16, 3, false, "\xe2\x8b\x9b" },
+		  { 1385, 16, 3, false, "\xe2\x89\xa7" },
+		  { 1401, 14, 3, false, "\xe2\xaa\xa2" },
+		  { 1415, 11, 3, false, "\xe2\x89\xb7" },
+		  { 1426, 17, 3, false, "\xe2\xa9\xbe" },
+		  { 1443, 12, 3, false, "\xe2\x89\xb3" },
+		  { 1455, 4, 4, false, "\xf0\x9d\x92\xa2" },
+		  { 1459, 2, 3, false, "\xe2\x89\xab" },
+		  { 1461, 6, 2, false, "\xd0\xaa" },
+		  { 1467, 5, 2, false, "\xcb\x87" },
+		  { 1472, 3, 1, false, "\x5e" },
+		  { 1475, 5, 2, false, "\xc4\xa4" },
+		  { 1480, 3, 3, false, "\xe2\x84\x8c" },
+		  { 1483, 12, 3, false, "\xe2\x84\x8b" },
+		  { 1495, 4, 3, false, "\xe2\x84\x8d" },
+		  { 1499, 14, 3, false, "\xe2\x94\x80" },
+		  { 1513, 4, 3, false, "\xe2\x84\x8b" },
+		  { 1517, 6, 2, false, "\xc4\xa6" },
+		  { 1523, 12, 3, false, "\xe2\x89\x8e" },
+		  { 1535, 9, 3, false, "\xe2\x89\x8f" },
+		  { 1544, 4, 2, false, "\xd0\x95" },
+		  { 1548, 5, 2, false, "\xc4\xb2" },
+		  { 1553, 4, 2, false, "\xd0\x81" },
+		  { 1557, 6, 2, true, "\xc3\x8d" },
+		  { 1563, 5, 2, true, "\xc3\x8e" },
+		  { 1568, 3, 2, false, "\xd0\x98" },
+		  { 1571, 4, 2, false, "\xc4\xb0" },
+		  { 1575, 3, 3, false, "\xe2\x84\x91" },
+		  { 1578, 6, 2, true, "\xc3\x8c" },
+		  { 1584, 2, 3, false, "\xe2\x84\x91" },
+		  { 1586, 5, 2, false, "\xc4\xaa" },
+		  { 1591, 10, 3, false, "\xe2\x85\x88" },
+		  { 1601, 7, 3, false, "\xe2\x87\x92" },
+		  { 1608, 3, 3, false, "\xe2\x88\xac" },
+		  { 1611, 8, 3, false, "\xe2\x88\xab" },
+		  { 1619, 12, 3, false, "\xe2\x8b\x82" },
+		  { 1631, 14, 3, false, "\xe2\x81\xa3" },
+		  { 1645, 14, 3, false, "\xe2\x81\xa2" },
+		  { 1659, 5, 2, false, "\xc4\xae" },
+		  { 1664, 4, 4, false, "\xf0\x9d\x95\x80" },
+		  { 1668, 4, 2, false, "\xce\x99" },
+		  { 1672, 4, 3, false, "\xe2\x84\x90" },
+		  { 1676, 6, 2, false, "\xc4\xa8" },
+		  { 1682, 5, 2, false, "\xd0\x86" },
+		  { 1687, 4, 2, true, "\xc3\x8f" },
+		  { 1691, 5, 2, false, "\xc4\xb4" },
+		  { 1696, 3, 2, false, "\xd0\x99" },
+		  { 1699, 3, 4, false, "\xf0\x9d\x94\x8d" },
+		  { 1702, 4, 4, false, "\xf0\x9d\x95\x81" },
+		  { 1706, 4, 4, false, "\xf0\x9d\x92\xa5" },
+		  { 1710, 6, 2, false, "\xd0\x88" },
+		  { 1716, 5, 2, false, "\xd0\x84" },
+		  { 1721, 4, 2, false, "\xd0\xa5" },
+		  { 1725, 4, 2, false, "\xd0\x8c" },
+		  { 1729, 5, 2, false, "\xce\x9a" },
+		  { 1734, 6, 2, false, "\xc4\xb6" },
+		  { 1740, 3, 2, false, "\xd0\x9a" },
+		  { 1743, 3, 4, false, "\xf0\x9d\x94\x8e" },
+		  { 1746, 4, 4, false, "\xf0\x9d\x95\x82" },
+		  { 1750, 4, 4, false, "\xf0\x9d\x92\xa6" },
+		  { 1754, 4, 2, false, "\xd0\x89" },
+		  { 1758, 2, 1, true, "\x3c" },
+		  { 1760, 6, 2, false, "\xc4\xb9" },
+		  { 1766, 6, 2, false, "\xce\x9b" },
+		  { 1772, 4, 3, false, "\xe2\x9f\xaa" },
+		  { 1776, 10, 3, false, "\xe2\x84\x92" },
+		  { 1786, 4, 3, false, "\xe2\x86\x9e" },
+		  { 1790, 6, 2, false, "\xc4\xbd" },
+		  { 1796, 6, 2, false, "\xc4\xbb" },
+		  { 1802, 3, 2, false, "\xd0\x9b" },
+		  { 1805, 16, 3, false, "\xe2\x9f\xa8" },
+		  { 1821, 9, 3, false, "\xe2\x86\x90" },
+		  { 1830, 12, 3, false, "\xe2\x87\xa4" },
+		  { 1842, 19, 3, false, "\xe2\x87\x86" },
+		  { 1861, 11, 3, false, "\xe2\x8c\x88" },
+		  { 1872, 17, 3, false, "\xe2\x9f\xa6" },
+		  { 1889, 17, 3, false, "\xe2\xa5\xa1" },
+		  { 1906, 14, 3, false, "\xe2\x87\x83" },
+		  { 1920, 17, 3, false, "\xe2\xa5\x99" },
+		  { 1937, 9, 3, false, "\xe2\x8c\x8a" },
+		  { 1946, 14, 3, false, "\xe2\x86\x94" },
+		  { 1960, 15, 3, false, "\xe2\xa5\x8e" },
+		  { 1975, 7, 3, false, "\xe2\x8a\xa3" },
+		  { 1982, 12, 3, false, "\xe2\x86\xa4" },
+		  { 1994, 13, 3, false, "\xe2\xa5\x9a" },
+		  { 2007, 12, 3, false, "\xe2\x8a\xb2" },
+		  { 2019, 15, 3, false, "\xe2\xa7\x8f" },
+		  { 2034, 17, 3, false, "\xe2\x8a\xb4" },
+		  { 2051, 16, 3, false, "\xe2\xa5\x91" },
+		  { 2067, 15, 3, false, "\xe2\xa5\xa0" },
+		  { 2082, 12, 3, false, "\xe2\x86\xbf" },
+		  { 2094, 15, 3, false, "\xe2\xa5\x98" },
+		  { 2109, 10, 3, false, "\xe2\x86\xbc" },
+		  { 2119, 13, 3, false, "\xe2\xa5\x92" },
+		  { 2132, 9, 3, false, "\xe2\x87\x90" },
+		  { 2141, 14, 3, false, "\xe2\x87\x94" },
+		  { 2155, 16, 3, false, "\xe2\x8b\x9a" },
+		  { 2171, 13, 3, false, "\xe2\x89\xa6" },
+		  { 2184, 11, 3, false, "\xe2\x89\xb6" },
+		  { 2195, 8, 3, false, "\xe2\xaa\xa1" },
+		  { 2203, 14, 3, false, "\xe2\xa9\xbd" },
+		  { 2217, 9, 3, false, "\xe2\x89\xb2" },
+		  { 2226, 3, 4, false, "\xf0\x9d\x94\x8f" },
+		  { 2229, 2, 3, false, "\xe2\x8b\x98" },
+		  { 2231, 10, 3, false, "\xe2\x87\x9a" },
+		  { 2241, 6, 2, false, "\xc4\xbf" },
+		  { 2247, 13, 3, false, "\xe2\x9f\xb5" },
+		  { 2260, 18, 3, false, "\xe2\x9f\xb7" },
+		  { 2278, 14, 3, false, "\xe2\x9f\xb6" },
+		  { 2292, 13, 3, false, "\xe2\x9f\xb8" },
+		  { 2305, 18, 3, false, "\xe2\x9f\xba" },
+		  { 2323, 14, 3, false, "\xe2\x9f\xb9" },
+		  { 2337, 4, 4, false, "\xf0\x9d\x95\x83" },
+		  { 2341, 14, 3, false, "\xe2\x86\x99" },
+		  { 2355, 15, 3, false, "\xe2\x86\x98" },
+		  { 2370, 4, 3, false, "\xe2\x84\x92" },
+		  { 2374, 3, 3, false, "\xe2\x86\xb0" },
+		  { 2377, 6, 2, false, "\xc5\x81" },
+		  { 2383, 2, 3, false, "\xe2\x89\xaa" },
+		  { 2385, 3, 3, false, "\xe2\xa4\x85" },
+		  { 2388, 3, 2, false, "\xd0\x9c" },
+		  { 2391, 11, 3, false, "\xe2\x81\x9f" },
+		  { 2402, 9, 3, false, "\xe2\x84\xb3" },
+		  { 2411, 3, 4, false, "\xf0\x9d\x94\x90" },
+		  { 2414, 9, 3, false, "\xe2\x88\x93" },
+		  { 2423, 4, 4, false, "\xf0\x9d\x95\x84" },
+		  { 2427, 4, 3, false, "\xe2\x84\xb3" },
+		  { 2431, 2, 2, false, "\xce\x9c" },
+		  { 2433, 4, 2, false, "\xd0\x8a" },
+		  { 2437, 6, 2, false, "\xc5\x83" },
+		  { 2443, 6, 2, false, "\xc5\x87" },
+		  { 2449, 6, 2, false, "\xc5\x85" },
+		  { 2455, 3, 2, false, "\xd0\x9d" },
+		  { 2458, 19, 3, false, "\xe2\x80\x8b" },
+		  { 2477, 18, 3, false, "\xe2\x80\x8b" },
+		  { 2495, 17, 3, false, "\xe2\x80\x8b" },
+		  { 2512, 21, 3, false, "\xe2\x80\x8b" },
+		  { 2533, 20, 3, false, "\xe2\x89\xab" },
+		  { 2553, 14, 3, false, "\xe2\x89\xaa" },
+		  { 2567, 7, 1, false, "\x0a" },
+		  { 2574, 3, 4, false, "\xf0\x9d\x94\x91" },
+		  { 2577, 7, 3, false, "\xe2\x81\xa0" },
+		  { 2584, 16, 2, false, "\xc2\xa0" },
+		  { 2600, 4, 3, false, "\xe2\x84\x95" },
+		  { 2604, 3, 3, false, "\xe2\xab\xac" },
+		  { 2607, 12, 3, false, "\xe2\x89\xa2" },
+		  { 2619, 9, 3, false, "\xe2\x89\xad" },
+		  { 2628, 20, 3, false, "\xe2\x88\xa6" },
+		  { 2648, 10, 3, false, "\xe2\x88\x89" },
+		  { 2658, 8, 3, false, "\xe2\x89\xa0" },
+		  { 2666, 13, 5, false, "\xe2\x89\x82\xcc\xb8" },
+		  { 2679, 9, 3, false, "\xe2\x88\x84" },
+		  { 2688, 10, 3, false, "\xe2\x89\xaf" },
+		  { 2698, 15, 3, false, "\xe2\x89\xb1" },
+		  { 2713, 19, 5, false, "\xe2\x89\xa7\xcc\xb8" },
+		  { 2732, 17, 5, false, "\xe2\x89\xab\xcc\xb8" },
+		  { 2749, 14, 3, false, "\xe2\x89\xb9" },
+		  { 2763, 20, 5, false, "\xe2\xa9\xbe\xcc\xb8" },
+		  { 2783, 15, 3, false, "\xe2\x89\xb5" },
+		  { 2798, 15, 5, false, "\xe2\x89\x8e\xcc\xb8" },
+		  { 2813, 12, 5, false, "\xe2\x89\x8f\xcc\xb8" },
+		  { 2825, 15, 3, false, "\xe2\x8b\xaa" },
+		  { 2840, 18, 5, false, "\xe2\xa7\x8f\xcc\xb8" },
+		  { 2858, 20, 3, false, "\xe2\x8b\xac" },
+		  { 2878, 7, 3, false, "\xe2\x89\xae" },
+		  { 2885, 12, 3, false, "\xe2\x89\xb0" },
+		  { 2897, 14, 3, false, "\xe2\x89\xb8" },
+		  { 2911, 11, 5, false, "\xe2\x89\xaa\xcc\xb8" },
+		  { 2922, 17, 5, false, "\xe2\xa9\xbd\xcc\xb8" },
+		  { 2939, 12, 3, false, "\xe2\x89\xb4" },
+		  { 2951, 23, 5, false, "\xe2\xaa\xa2\xcc\xb8" },
+		  { 2974, 17, 5, false, "\xe2\xaa\xa1\xcc\xb8" },
+		  { 2991, 11, 3, false, "\xe2\x8a\x80" },
+		  { 3002, 16, 5, false, "\xe2\xaa\xaf\xcc\xb8" },
+		  { 3018, 21, 3, false, "\xe2\x8b\xa0" },
+		  { 3039, 17, 3, false, "\xe2\x88\x8c" },
+		  { 3056, 16, 3, false, "\xe2\x8b\xab" },
+		  { 3072, 19, 5, false, "\xe2\xa7\x90\xcc\xb8" },
+		  { 3091, 21, 3, false, "\xe2\x8b\xad" },
+		  { 3112, 15, 5, false, "\xe2\x8a\x8f\xcc\xb8" },
+		  { 3127, 20, 3, false, "\xe2\x8b\xa2" },
+		  { 3147, 17, 5, false, "\xe2\x8a\x90\xcc\xb8" },
+		  { 3164, 22, 3, false, "\xe2\x8b\xa3" },
+		  { 3186, 9, 6, false, "\xe2\x8a\x82\xe2\x83\x92" },
+		  { 3195, 14, 3, false, "\xe2\x8a\x88" },
+		  { 3209, 11, 3, false, "\xe2\x8a\x81" },
+		  { 3220, 16, 5, false, "\xe2\xaa\xb0\xcc\xb8" },
+		  { 3236, 21, 3, false, "\xe2\x8b\xa1" },
+		  { 3257, 16, 5, false, "\xe2\x89\xbf\xcc\xb8" },
+		  { 3273, 11, 6, false, "\xe2\x8a\x83\xe2\x83\x92" },
+		  { 3284, 16, 3, false, "\xe2\x8a\x89" },
+		  { 3300, 8, 3, false, "\xe2\x89\x81" },
+		  { 3308, 13, 3, false, "\xe2\x89\x84" },
+		  { 3321, 17, 3, false, "\xe2\x89\x87" },
+		  { 3338, 13, 3, false, "\xe2\x89\x89" },
+		  { 3351, 14, 3, false, "\xe2\x88\xa4" },
+		  { 3365, 4, 4, false, "\xf0\x9d\x92\xa9" },
+		  { 3369, 6, 2, true, "\xc3\x91" },
+		  { 3375, 2, 2, false, "\xce\x9d" },
+		  { 3377, 5, 2, false, "\xc5\x92" },
+		  { 3382, 6, 2, true, "\xc3\x93" },
+		  { 3388, 5, 2, true, "\xc3\x94" },
+		  { 3393, 3, 2, false, "\xd0\x9e" },
+		  { 3396, 6, 2, false, "\xc5\x90" },
+		  { 3402, 3, 4, false, "\xf0\x9d\x94\x92" },
+		  { 3405, 6, 2, true, "\xc3\x92" },
+		  { 3411, 5, 2, false, "\xc5\x8c" },
+		  { 3416, 5, 2, false, "\xce\xa9" },
+		  { 3421, 7, 2, false, "\xce\x9f" },
+		  { 3428, 4, 4, false, "\xf0\x9d\x95\x86" },
+		  { 3432, 20, 3, false, "\xe2\x80\x9c" },
+		  { 3452, 14, 3, false, "\xe2\x80\x98" },
+		  { 3466, 2, 3, false, "\xe2\xa9\x94" },
+		  { 3468, 4, 4, false, "\xf0\x9d\x92\xaa" },
+		  { 3472, 6, 2, true, "\xc3\x98" },
+		  { 3478, 6, 2, true, "\xc3\x95" },
+		  { 3484, 6, 3, false, "\xe2\xa8\xb7" },
+		  { 3490, 4, 2, true, "\xc3\x96" },
+		  { 3494, 7, 3, false, "\xe2\x80\xbe" },
+		  { 3501, 9, 3, false, "\xe2\x8f\x9e" },
+		  { 3510, 11, 3, false, "\xe2\x8e\xb4" },
+		  { 3521, 15, 3, false, "\xe2\x8f\x9c" },
+		  { 3536, 8, 3, false, "\xe2\x88\x82" },
+		  { 3544, 3, 2, false, "\xd0\x9f" },
+		  { 3547, 3, 4, false, "\xf0\x9d\x94\x93" },
+		  { 3550, 3, 2, false, "\xce\xa6" },
+		  { 3553, 2, 2, false, "\xce\xa0" },
+		  { 3555, 9, 2, false, "\xc2\xb1" },
+		  { 3564, 13, 3, false, "\xe2\x84\x8c" },
+		  { 3577, 4, 3, false, "\xe2\x84\x99" },
+		  { 3581, 2, 3, false, "\xe2\xaa\xbb" },
+		  { 3583, 8, 3, false, "\xe2\x89\xba" },
+		  { 3591, 13, 3, false, "\xe2\xaa\xaf" },
+		  { 3604, 18, 3, false, "\xe2\x89\xbc" },
+		  { 3622, 13, 3, false, "\xe2\x89\xbe" },
+		  { 3635, 5, 3, false, "\xe2\x80\xb3" },
+		  { 3640, 7, 3, false, "\xe2\x88\x8f" },
+		  { 3647, 10, 3, false, "\xe2\x88\xb7" },
+		  { 3657, 12, 3, false, "\xe2\x88\x9d" },
+		  { 3669, 4, 4, false, "\xf0\x9d\x92\xab" },
+		  { 3673, 3, 2, false, "\xce\xa8" },
+		  { 3676, 4, 1, true, "\x22" },
+		  { 3680, 3, 4, false, "\xf0\x9d\x94\x94" },
+		  { 3683, 4, 3, false, "\xe2\x84\x9a" },
+		  { 3687, 4, 4, false, "\xf0\x9d\x92\xac" },
+		  { 3691, 5, 3, false, "\xe2\xa4\x90" },
+		  { 3696, 3, 2, true, "\xc2\xae" },
+		  { 3699, 6, 2, false, "\xc5\x94" },
+		  { 3705, 4, 3, false, "\xe2\x9f\xab" },
+		  { 3709, 4, 3, false, "\xe2\x86\xa0" },
+		  { 3713, 6, 3, false, "\xe2\xa4\x96" },
+		  { 3719, 6, 2, false, "\xc5\x98" },
+		  { 3725, 6, 2, false, "\xc5\x96" },
+		  { 3731, 3, 2, false, "\xd0\xa0" },
+		  { 3734, 2, 3, false, "\xe2\x84\x9c" },
+		  { 3736, 14, 3, false, "\xe2\x88\x8b" },
+		  { 3750, 18, 3, false, "\xe2\x87\x8b" },
+		  { 3768, 20, 3, false, "\xe2\xa5\xaf" },
+		  { 3788, 3, 3, false, "\xe2\x84\x9c" },
+		  { 3791, 3, 2, false, "\xce\xa1" },
+		  { 3794, 17, 3, false, "\xe2\x9f\xa9" },
+		  { 3811, 10, 3, false, "\xe2\x86\x92" },
+		  { 3821, 13, 3, false, "\xe2\x87\xa5" },
+		  { 3834, 19, 3, false, "\xe2\x87\x84" },
+		  { 3853, 12, 3, false, "\xe2\x8c\x89" },
+		  { 3865, 18, 3, false, "\xe2\x9f\xa7" },
+		  { 3883, 18, 3, false, "\xe2\xa5\x9d" },
+		  { 3901, 15, 3, false, "\xe2\x87\x82" },
+		  { 3916, 18, 3, false, "\xe2\xa5\x95" },
+		  { 3934, 10, 3, false, "\xe2\x8c\x8b" },
+		  { 3944, 8, 3, false, "\xe2\x8a\xa2" },
+		  { 3952, 13, 3, false, "\xe2\x86\xa6" },
+		  { 3965, 14, 3, false, "\xe2\xa5\x9b" },
+		  { 3979, 13, 3, false, "\xe2\x8a\xb3" },
+		  { 3992, 16, 3, false, "\xe2\xa7\x90" },
+		  { 4008, 18, 3, false, "\xe2\x8a\xb5" },
+		  { 4026, 17, 3, false, "\xe2\xa5\x8f" },
+		  { 4043, 16, 3, false, "\xe2\xa5\x9c" },
+		  { 4059, 13, 3, false, "\xe2\x86\xbe" },
+		  { 4072, 16, 3, false, "\xe2\xa5\x94" },
+		  { 4088, 11, 3, false, "\xe2\x87\x80" },
+		  { 4099, 14, 3, false, "\xe2\xa5\x93" },
+		  { 4113, 10, 3, false, "\xe2\x87\x92" },
+		  { 4123, 4, 3, false, "\xe2\x84\x9d" },
+		  { 4127, 12, 3, false, "\xe2\xa5\xb0" },
+		  { 4139, 11, 3, false, "\xe2\x87\x9b" },
+		  { 4150, 4, 3, false, "\xe2\x84\x9b" },
+		  { 4154, 3, 3, false, "\xe2\x86\xb1" },
+		  { 4157, 11, 3, false, "\xe2\xa7\xb4" },
+		  { 4168, 6, 2, false, "\xd0\xa9" },
+		  { 4174, 4, 2, false, "\xd0\xa8" },
+		  { 4178, 6, 2, false, "\xd0\xac" },
+		  { 4184, 6, 2, false, "\xc5\x9a" },
+		  { 4190, 2, 3, false, "\xe2\xaa\xbc" },
+		  { 4192, 6, 2, false, "\xc5\xa0" },
+		  { 4198, 6, 2, false, "\xc5\x9e" },
+		  { 4204, 5, 2, false, "\xc5\x9c" },
+		  { 4209, 3, 2, false, "\xd0\xa1" },
+		  { 4212, 3, 4, false, "\xf0\x9d\x94\x96" },
+		  { 4215, 14, 3, false, "\xe2\x86\x93" },
+		  { 4229, 14, 3, false, "\xe2\x86\x90" },
+		  { 4243, 15, 3, false, "\xe2\x86\x92" },
+		  { 4258, 12, 3, false, "\xe2\x86\x91" },
+		  { 4270, 5, 2, false, "\xce\xa3" },
+		  { 4275, 11, 3, false, "\xe2\x88\x98" },
+		  { 4286, 4, 4, false, "\xf0\x9d\x95\x8a" },
+		  { 4290, 4, 3, false, "\xe2\x88\x9a" },
+		  { 4294, 6, 3, false, "\xe2\x96\xa1" },
+		  { 4300, 18, 3, false, "\xe2\x8a\x93" },
+		  { 4318, 12, 3, false, "\xe2\x8a\x8f" },
+		  { 4330, 17, 3, false, "\xe2\x8a\x91" },
+		  { 4347, 14, 3, false, "\xe2\x8a\x90" },
+		  { 4361, 19, 3, false, "\xe2\x8a\x92" },
+		  { 4380, 11, 3, false, "\xe2\x8a\x94" },
+		  { 4391, 4, 4, false, "\xf0\x9d\x92\xae" },
+		  { 4395, 4, 3, false, "\xe2\x8b\x86" },
+		  { 4399, 3, 3, false, "\xe2\x8b\x90" },
+		  { 4402, 6, 3, false, "\xe2\x8b\x90" },
+		  { 4408, 11, 3, false, "\xe2\x8a\x86" },
+		  { 4419, 8, 3, false, "\xe2\x89\xbb" },
+		  { 4427, 13, 3, false, "\xe2\xaa\xb0" },
+		  { 4440, 18, 3, false, "\xe2\x89\xbd" },
+		  { 4458, 13, 3, false, "\xe2\x89\xbf" },
+		  { 4471, 8, 3, false, "\xe2\x88\x8b" },
+		  { 4479, 3, 3, false, "\xe2\x88\x91" },
+		  { 4482, 3, 3, false, "\xe2\x8b\x91" },
+		  { 4485, 8, 3, false, "\xe2\x8a\x83" },
+		  { 4493, 13, 3, false, "\xe2\x8a\x87" },
+		  { 4506, 6, 3, false, "\xe2\x8b\x91" },
+		  { 4512, 5, 2, true, "\xc3\x9e" },
+		  { 4517, 5, 3, false, "\xe2\x84\xa2" },
+		  { 4522, 5, 2, false, "\xd0\x8b" },
+		  { 4527, 4, 2, false, "\xd0\xa6" },
+		  { 4531, 3, 1, false, "\x09" },
+		  { 4534, 3, 2, false, "\xce\xa4" },
+		  { 4537, 6, 2, false, "\xc5\xa4" },
+		  { 4543, 6, 2, false, "\xc5\xa2" },
+		  { 4549, 3, 2, false, "\xd0\xa2" },
+		  { 4552, 3, 4, false, "\xf0\x9d\x94\x97" },
+		  { 4555, 9, 3, false, "\xe2\x88\xb4" },
+		  { 4564, 5, 2, false, "\xce\x98" },
+		  { 4569, 10, 6, false, "\xe2\x81\x9f\xe2\x80\x8a" },
+		  { 4579, 9, 3, false, "\xe2\x80\x89" },
+		  { 4588, 5, 3, false, "\xe2\x88\xbc" },
+		  { 4593, 10, 3, false, "\xe2\x89\x83" },
+		  { 4603, 14, 3, false, "\xe2\x89\x85" },
+		  { 4617, 10, 3, false, "\xe2\x89\x88" },
+		  { 4627, 4, 4, false, "\xf0\x9d\x95\x8b" },
+		  { 4631, 9, 3, false, "\xe2\x83\x9b" },
+		  { 4640, 4, 4, false, "\xf0\x9d\x92\xaf" },
+		  { 4644, 6, 2, false, "\xc5\xa6" },
+		  { 4650, 6, 2, true, "\xc3\x9a" },
+		  { 4656, 4, 3, false, "\xe2\x86\x9f" },
+		  { 4660, 8, 3, false, "\xe2\xa5\x89" },
+		  { 4668, 5, 2, false, "\xd0\x8e" },
+		  { 4673, 6, 2, false, "\xc5\xac" },
+		  { 4679, 5, 2, true, "\xc3\x9b" },
+		  { 4684, 3, 2, false, "\xd0\xa3" },
+		  { 4687, 6, 2, false, "\xc5\xb0" },
+		  { 4693, 3, 4, false, "\xf0\x9d\x94\x98" },
+		  { 4696, 6, 2, true, "\xc3\x99" },
+		  { 4702, 5, 2, false, "\xc5\xaa" },
+		  { 4707, 8, 1, false, "\x5f" },
+		  { 4715, 10, 3, false, "\xe2\x8f\x9f" },
+		  { 4725, 12, 3, false, "\xe2\x8e\xb5" },
+		  { 4737, 16, 3, false, "\xe2\x8f\x9d" },
+		  { 4753, 5, 3, false, "\xe2\x8b\x83" },
+		  { 4758, 9, 3, false, "\xe2\x8a\x8e" },
+		  { 4767, 5, 2, false, "\xc5\xb2" },
+		  { 4772, 4, 4, false, "\xf0\x9d\x95\x8c" },
+		  { 4776, 7, 3, false, "\xe2\x86\x91" },
+		  { 4783, 10, 3, false, "\xe2\xa4\x92" },
+		  { 4793, 16, 3, false, "\xe2\x87\x85" },
+		  { 4809, 11, 3, false, "\xe2\x86\x95" },
+		  { 4820, 13, 3, false, "\xe2\xa5\xae" },
+		  { 4833, 5, 3, false, "\xe2\x8a\xa5" },
+		  { 4838, 10, 3, false, "\xe2\x86\xa5" },
+		  { 4848, 7, 3, false, "\xe2\x87\x91" },
+		  { 4855, 11, 3, false, "\xe2\x87\x95" },
+		  { 4866, 14, 3, false, "\xe2\x86\x96" },
+		  { 4880, 15, 3, false, "\xe2\x86\x97" },
+		  { 4895, 4, 2, false, "\xcf\x92" },
+		  { 4899, 7, 2, false, "\xce\xa5" },
+		  { 4906, 5, 2, false, "\xc5\xae" },
+		  { 4911, 4, 4, false, "\xf0\x9d\x92\xb0" },
+		  { 4915, 6, 2, false, "\xc5\xa8" },
+		  { 4921, 4, 2, true, "\xc3\x9c" },
+		  { 4925, 5, 3, false, "\xe2\x8a\xab" },
+		  { 4930, 4, 3, false, "\xe2\xab\xab" },
+		  { 4934, 3, 2, false, "\xd0\x92" },
+		  { 4937, 5, 3, false, "\xe2\x8a\xa9" },
+		  { 4942, 6, 3, false, "\xe2\xab\xa6" },
+		  { 4948, 3, 3, false, "\xe2\x8b\x81" },
+		  { 4951, 6, 3, false, "\xe2\x80\x96" },
+		  { 4957, 4, 3, false, "\xe2\x80\x96" },
+		  { 4961, 11, 3, false, "\xe2\x88\xa3" },
+		  { 4972, 12, 1, false, "\x7c" },
+		  { 4984, 17, 3, false, "\xe2\x9d\x98" },
+		  { 5001, 13, 3, false, "\xe2\x89\x80" },
+		  { 5014, 13, 3, false, "\xe2\x80\x8a" },
+		  { 5027, 3, 4, false, "\xf0\x9d\x94\x99" },
+		  { 5030, 4, 4, false, "\xf0\x9d\x95\x8d" },
+		  { 5034, 4, 4, false, "\xf0\x9d\x92\xb1" },
+		  { 5038, 6, 3, false, "\xe2\x8a\xaa" },
+		  { 5044, 5, 2, false, "\xc5\xb4" },
+		  { 5049, 5, 3, false, "\xe2\x8b\x80" },
+		  { 5054, 3, 4, false, "\xf0\x9d\x94\x9a" },
+		  { 5057, 4, 4, false, "\xf0\x9d\x95\x8e" },
+		  { 5061, 4, 4, false, "\xf0\x9d\x92\xb2" },
+		  { 5065, 3, 4, false, "\xf0\x9d\x94\x9b" },
+		  { 5068, 2, 2, false, "\xce\x9e" },
+		  { 5070, 4, 4, false, "\xf0\x9d\x95\x8f" },
+		  { 5074, 4, 4, false, "\xf0\x9d\x92\xb3" },
+		  { 5078, 4, 2, false, "\xd0\xaf" },
+		  { 5082, 4, 2, false, "\xd0\x87" },
+		  { 5086, 4, 2, false, "\xd0\xae" },
+		  { 5090, 6, 2, true, "\xc3\x9d" },
+		  { 5096, 5, 2, false, "\xc5\xb6" },
+		  { 5101, 3, 2, false, "\xd0\xab" },
+		  { 5104, 3, 4, false, "\xf0\x9d\x94\x9c" },
+		  { 5107, 4, 4, false, "\xf0\x9d\x95\x90" },
+		  { 5111, 4, 4, false, "\xf0\x9d\x92\xb4" },
+		  { 5115, 4, 2, false, "\xc5\xb8" },
+		  { 5119, 4, 2, false, "\xd0\x96" },
+		  { 5123, 6, 2, false, "\xc5\xb9" },
+		  { 5129, 6, 2, false, "\xc5\xbd" },
+		  { 5135, 3, 2, false, "\xd0\x97" },
+		  { 5138, 4, 2, false, "\xc5\xbb" },
+		  { 5142, 14, 3, false, "\xe2\x80\x8b" },
+		  { 5156, 4, 2, false, "\xce\x96" },
+		  { 5160, 3, 3, false, "\xe2\x84\xa8" },
+		  { 5163, 4, 3, false, "\xe2\x84\xa4" },
+		  { 5167, 4, 4, false, "\xf0\x9d\x92\xb5" },
+		  { 5171, 6, 2, true, "\xc3\xa1" },
+		  { 5177, 6, 2, false, "\xc4\x83" },
+		  { 5183, 2, 3, false, "\xe2\x88\xbe" },
+		  { 5185, 3, 5, false, "\xe2\x88\xbe\xcc\xb3" },
+		  { 5188, 3, 3, false, "\xe2\x88\xbf" },
+		  { 5191, 5, 2, true, "\xc3\xa2" },
+		  { 5196, 5, 2, true, "\xc2\xb4" },
+		  { 5201, 3, 2, false, "\xd0\xb0" },
+		  { 5204, 5, 2, true, "\xc3\xa6" },
+		  { 5209, 2, 3, false, "\xe2\x81\xa1" },
+		  { 5211, 3, 4, false, "\xf0\x9d\x94\x9e" },
+		  { 5214, 6, 2, true, "\xc3\xa0" },
+		  { 5220, 7, 3, false, "\xe2\x84\xb5" },
+		  { 5227, 5, 3, false, "\xe2\x84\xb5" },
+		  { 5232, 5, 2, false, "\xce\xb1" },
+		  { 5237, 5, 2, false, "\xc4\x81" },
+		  { 5242, 5, 3, false, "\xe2\xa8\xbf" },
+		  { 5247, 3, 1, true, "\x26" },
+		  { 5250, 3, 3, false, "\xe2\x88\xa7" },
+		  { 5253, 6, 3, false, "\xe2\xa9\x95" },
+		  { 5259, 4, 3, false, "\xe2\xa9\x9c" },
+		  { 5263, 8, 3, false, "\xe2\xa9\x98" },
+		  { 5271, 4, 3, false, "\xe2\xa9\x9a" },
+		  { 5275, 3, 3, false, "\xe2\x88\xa0" },
+		  { 5278, 4, 3, false, "\xe2\xa6\xa4" },
+		  { 5282, 5, 3, false, "\xe2\x88\xa0" },
+		  { 5287, 6, 3, false, "\xe2\x88\xa1" },
+		  { 5293, 8, 3, false, "\xe2\xa6\xa8" },
+		  { 5301, 8, 3, false, "\xe2\xa6\xa9" },
+		  { 5309, 8, 3, false, "\xe2\xa6\xaa" },
+		  { 5317, 8, 3, false, "\xe2\xa6\xab" },
+		  { 5325, 8, 3, false, "\xe2\xa6\xac" },
+		  { 5333, 8, 3, false, "\xe2\xa6\xad" },
+		  { 5341, 8, 3, false, "\xe2\xa6\xae" },
+		  { 5349, 8, 3, false, "\xe2\xa6\xaf" },
+		  { 5357, 5, 3, false, "\xe2\x88\x9f" },
+		  { 5362, 7, 3, false, "\xe2\x8a\xbe" },
+		  { 5369, 8, 3, false, "\xe2\xa6\x9d" },
+		  { 5377, 6, 3, false, "\xe2\x88\xa2" },
+		  { 5383, 5, 2, false, "\xc3\x85" },
+		  { 5388, 7, 3, false, "\xe2\x8d\xbc" },
+		  { 5395, 5, 2, false, "\xc4\x85" },
+		  { 5400, 4, 4, false, "\xf0\x9d\x95\x92" },
+		  { 5404, 2, 3, false, "\xe2\x89\x88" },
+		  { 5406, 3, 3, false, "\xe2\xa9\xb0" },
+		  { 5409, 6, 3, false, "\xe2\xa9\xaf" },
+		  { 5415, 3, 3, false, "\xe2\x89\x8a" },
+		  { 5418, 4, 3, false, "\xe2\x89\x8b" },
+		  { 5422, 4, 1, false, "\x27" },
+		  { 5426, 6, 3, false, "\xe2\x89\x88" },
+		  { 5432, 8, 3, false, "\xe2\x89\x8a" },
+		  { 5440, 5, 2, true, "\xc3\xa5" },
+		  { 5445, 4, 4, false, "\xf0\x9d\x92\xb6" },
+		  { 5449, 3, 1, false, "\x2a" },
+		  { 5452, 5, 3, false, "\xe2\x89\x88" },
+		  { 5457, 7, 3, false, "\xe2\x89\x8d" },
+		  { 5464, 6, 2, true, "\xc3\xa3" },
+		  { 5470, 4, 2, true, "\xc3\xa4" },
+		  { 5474, 8, 3, false, "\xe2\x88\xb3" },
+		  { 5482, 5, 3, false, "\xe2\xa8\x91" },
+		  { 5487, 4, 3, false, "\xe2\xab\xad" },
+		  { 5491, 8, 3, false, "\xe2\x89\x8c" },
+		  { 5499, 11, 2, false, "\xcf\xb6" },
+		  { 5510, 9, 3, false, "\xe2\x80\xb5" },
+		  { 5519, 7, 3, false, "\xe2\x88\xbd" },
+		  { 5526, 9, 3, false, "\xe2\x8b\x8d" },
+		  { 5535, 6, 3, false, "\xe2\x8a\xbd" },
+		  { 5541, 6, 3, false, "\xe2\x8c\x85" },
+		  { 5547, 8, 3, false, "\xe2\x8c\x85" },
+		  { 5555, 4, 3, false, "\xe2\x8e\xb5" },
+		  { 5559, 8, 3, false, "\xe2\x8e\xb6" },
+		  { 5567, 5, 3, false, "\xe2\x89\x8c" },
+		  { 5572, 3, 2, false, "\xd0\xb1" },
+		  { 5575, 5, 3, false, "\xe2\x80\x9e" },
+		  { 5580, 6, 3, false, "\xe2\x88\xb5" },
+		  { 5586, 7, 3, false, "\xe2\x88\xb5" },
+		  { 5593, 7, 3, false, "\xe2\xa6\xb0" },
+		  { 5600, 5, 2, false, "\xcf\xb6" },
+		  { 5605, 6, 3, false, "\xe2\x84\xac" },
+		  { 5611, 4, 2, false, "\xce\xb2" },
+		  { 5615, 4, 3, false, "\xe2\x84\xb6" },
+		  { 5619, 7, 3, false, "\xe2\x89\xac" },
+		  { 5626, 3, 4, false, "\xf0\x9d\x94\x9f" },
+		  { 5629, 6, 3, false, "\xe2\x8b\x82" },
+		  { 5635, 7, 3, false, "\xe2\x97\xaf" },
+		  { 5642, 6, 3, false, "\xe2\x8b\x83" },
+		  { 5648, 7, 3, false, "\xe2\xa8\x80" },
+		  { 5655, 8, 3, false, "\xe2\xa8\x81" },
+		  { 5663, 9, 3, false, "\xe2\xa8\x82" },
+		  { 5672, 8, 3, false, "\xe2\xa8\x86" },
+		  { 5680, 7, 3, false, "\xe2\x98\x85" },
+		  { 5687, 15, 3, false, "\xe2\x96\xbd" },
+		  { 5702, 13, 3, false, "\xe2\x96\xb3" },
+		  { 5715, 8, 3, false, "\xe2\xa8\x84" },
+		  { 5723, 6, 3, false, "\xe2\x8b\x81" },
+		  { 5729, 8, 3, false, "\xe2\x8b\x80" },
+		  { 5737, 6, 3, false, "\xe2\xa4\x8d" },
+		  { 5743, 12, 3, false, "\xe2\xa7\xab" },
+		  { 5755, 11, 3, false, "\xe2\x96\xaa" },
+		  { 5766, 13, 3, false, "\xe2\x96\xb4" },
+		  { 5779, 17, 3, false, "\xe2\x96\xbe" },
+		  { 5796, 17, 3, false, "\xe2\x97\x82" },
+		  { 5813, 18, 3, false, "\xe2\x96\xb8" },
+		  { 5831, 5, 3, false, "\xe2\x90\xa3" },
+		  { 5836, 5, 3, false, "\xe2\x96\x92" },
+		  { 5841, 5, 3, false, "\xe2\x96\x91" },
+		  { 5846, 5, 3, false, "\xe2\x96\x93" },
+		  { 5851, 5, 3, false, "\xe2\x96\x88" },
+		  { 5856, 3, 4, false, "\x3d\xe2\x83\xa5" },
+		  { 5859, 7, 6, false, "\xe2\x89\xa1\xe2\x83\xa5" },
+		  { 5866, 4, 3, false, "\xe2\x8c\x90" },
+		  { 5870, 4, 4, false, "\xf0\x9d\x95\x93" },
+		  { 5874, 3, 3, false, "\xe2\x8a\xa5" },
+		  { 5877, 6, 3, false, "\xe2\x8a\xa5" },
+		  { 5883, 6, 3, false, "\xe2\x8b\x88" },
+		  { 5889, 5, 3, false, "\xe2\x95\x97" },
+		  { 5894, 5, 3, false, "\xe2\x95\x94" },
+		  { 5899, 5, 3, false, "\xe2\x95\x96" },
+		  { 5904, 5, 3, false, "\xe2\x95\x93" },
+		  { 5909, 4, 3, false, "\xe2\x95\x90" },
+		  { 5913, 5, 3, false, "\xe2\x95\xa6" },
+		  { 5918, 5, 3, false, "\xe2\x95\xa9" },
+		  { 5923, 5, 3, false, "\xe2\x95\xa4" },
+		  { 5928, 5, 3, false, "\xe2\x95\xa7" },
+		  { 5933, 5, 3, false, "\xe2\x95\x9d" },
+		  { 5938, 5, 3, false, "\xe2\x95\x9a" },
+		  { 5943, 5, 3, false, "\xe2\x95\x9c" },
+		  { 5948, 5, 3, false, "\xe2\x95\x99" },
+		  { 5953, 4, 3, false, "\xe2\x95\x91" },
+		  { 5957, 5, 3, false, "\xe2\x95\xac" },
+		  { 5962, 5, 3, false, "\xe2\x95\xa3" },
+		  { 5967, 5, 3, false, "\xe2\x95\xa0" },
+		  { 5972, 5, 3, false, "\xe2\x95\xab" },
+		  { 5977, 5, 3, false, "\xe2\x95\xa2" },
+		  { 5982, 5, 3, false, "\xe2\x95\x9f" },
+		  { 5987, 6, 3, false, "\xe2\xa7\x89" },
+		  { 5993, 5, 3, false, "\xe2\x95\x95" },
+		  { 5998, 5, 3, false, "\xe2\x95\x92" },
+		  { 6003, 5, 3, false, "\xe2\x94\x90" },
+		  { 6008, 5, 3, false, "\xe2\x94\x8c" },
+		  { 6013, 4, 3, false, "\xe2\x94\x80" },
+		  { 6017, 5, 3, false, "\xe2\x95\xa5" },
+		  { 6022, 5, 3, false, "\xe2\x95\xa8" },
+		  { 6027, 5, 3, false, "\xe2\x94\xac" },
+		  { 6032, 5, 3, false, "\xe2\x94\xb4" },
+		  { 6037, 8, 3, false, "\xe2\x8a\x9f" },
+		  { 6045, 7, 3, false, "\xe2\x8a\x9e" },
+		  { 6052, 8, 3, false, "\xe2\x8a\xa0" },
+		  { 6060, 5, 3, false, "\xe2\x95\x9b" },
+		  { 6065, 5, 3, false, "\xe2\x95\x98" },
+		  { 6070, 5, 3, false, "\xe2\x94\x98" },
+		  { 6075, 5, 3, false, "\xe2\x94\x94" },
+		  { 6080, 4, 3, false, "\xe2\x94\x82" },
+		  { 6084, 5, 3, false, "\xe2\x95\xaa" },
+		  { 6089, 5, 3, false, "\xe2\x95\xa1" },
+		  { 6094, 5, 3, false, "\xe2\x95\x9e" },
+		  { 6099, 5, 3, false, "\xe2\x94\xbc" },
+		  { 6104, 5, 3, false, "\xe2\x94\xa4" },
+		  { 6109, 5, 3, false, "\xe2\x94\x9c" },
+		  { 6114, 6, 3, false, "\xe2\x80\xb5" },
+		  { 6120, 5, 2, false, "\xcb\x98" },
+		  { 6125, 6, 2, true, "\xc2\xa6" },
+		  { 6131, 4, 4, false, "\xf0\x9d\x92\xb7" },
+		  { 6135, 5, 3, false, "\xe2\x81\x8f" },
+		  { 6140, 4, 3, false, "\xe2\x88\xbd" },
+		  { 6144, 5, 3, false, "\xe2\x8b\x8d" },
+		  { 6149, 4, 1, false, "\x5c" },
+		  { 6153, 5, 3, false, "\xe2\xa7\x85" },
+		  { 6158, 8, 3, false, "\xe2\x9f\x88" },
+		  { 6166, 4, 3, false, "\xe2\x80\xa2" },
+		  { 6170, 6, 3, false, "\xe2\x80\xa2" },
+		  { 6176, 4, 3, false, "\xe2\x89\x8e" },
+		  { 6180, 5, 3, false, "\xe2\xaa\xae" },
+		  { 6185, 5, 3, false, "\xe2\x89\x8f" },
+		  { 6190, 6, 3, false, "\xe2\x89\x8f" },
+		  { 6196, 6, 2, false, "\xc4\x87" },
+		  { 6202, 3, 3, false, "\xe2\x88\xa9" },
+		  { 6205, 6, 3, false, "\xe2\xa9\x84" },
+		  { 6211, 8, 3, false, "\xe2\xa9\x89" },
+		  { 6219, 6, 3, false, "\xe2\xa9\x8b" },
+		  { 6225, 6, 3, false, "\xe2\xa9\x87" },
+		  { 6231, 6, 3, false, "\xe2\xa9\x80" },
+		  { 6237, 4, 6, false, "\xe2\x88\xa9\xef\xb8\x80" },
+		  { 6241, 5, 3, false, "\xe2\x81\x81" },
+		  { 6246, 5, 2, false, "\xcb\x87" },
+		  { 6251, 5, 3, false, "\xe2\xa9\x8d" },
+		  { 6256, 6, 2, false, "\xc4\x8d" },
+		  { 6262, 6, 2, true, "\xc3\xa7" },
+		  { 6268, 5, 2, false, "\xc4\x89" },
+		  { 6273, 5, 3, false, "\xe2\xa9\x8c" },
+		  { 6278, 7, 3, false, "\xe2\xa9\x90" },
+		  { 6285, 4, 2, false, "\xc4\x8b" },
+		  { 6289, 5, 2, true, "\xc2\xb8" },
+		  { 6294, 7, 3, false, "\xe2\xa6\xb2" },
+		  { 6301, 4, 2, true, "\xc2\xa2" },
+		  { 6305, 9, 2, false, "\xc2\xb7" },
+		  { 6314, 3, 4, false, "\xf0\x9d\x94\xa0" },
+		  { 6317, 4, 2, false, "\xd1\x87" },
+		  { 6321, 5, 3, false, "\xe2\x9c\x93" },
+		  { 6326, 9, 3, false, "\xe2\x9c\x93" },
+		  { 6335, 3, 2, false, "\xcf\x87" },
+		  { 6338, 3, 3, false, "\xe2\x97\x8b" },
+		  { 6341, 4, 3, false, "\xe2\xa7\x83" },
+		  { 6345, 4, 2, false, "\xcb\x86" },
+		  { 6349, 6, 3, false, "\xe2\x89\x97" },
+		  { 6355, 15, 3, false, "\xe2\x86\xba" },
+		  { 6370, 16, 3, false, "\xe2\x86\xbb" },
+		  { 6386, 8, 2, false, "\xc2\xae" },
+		  { 6394, 8, 3, false, "\xe2\x93\x88" },
+		  { 6402, 10, 3, false, "\xe2\x8a\x9b" },
+		  { 6412, 11, 3, false, "\xe2\x8a\x9a" },
+		  { 6423, 11, 3, false, "\xe2\x8a\x9d" },
+		  { 6434, 4, 3, false, "\xe2\x89\x97" },
+		  { 6438, 8, 3, false, "\xe2\xa8\x90" },
+		  { 6446, 6, 3, false, "\xe2\xab\xaf" },
+		  { 6452, 7, 3, false, "\xe2\xa7\x82" },
+		  { 6459, 5, 3, false, "\xe2\x99\xa3" },
+		  { 6464, 8, 3, false, "\xe2\x99\xa3" },
+		  { 6472, 5, 1, false, "\x3a" },
+		  { 6477, 6, 3, false, "\xe2\x89\x94" },
+		  { 6483, 7, 3, false, "\xe2\x89\x94" },
+		  { 6490, 5, 1, false, "\x2c" },
+		  { 6495, 6, 1, false, "\x40" },
+		  { 6501, 4, 3, false, "\xe2\x88\x81" },
+		  { 6505, 6, 3, false, "\xe2\x88\x98" },
+		  { 6511, 10, 3, false, "\xe2\x88\x81" },
+		  { 6521, 9, 3, false, "\xe2\x84\x82" },
+		  { 6530, 4, 3, false, "\xe2\x89\x85" },
+		  { 6534, 7, 3, false, "\xe2\xa9\xad" },
+		  { 6541, 6, 3, false, "\xe2\x88\xae" },
+		  { 6547, 4, 4, false, "\xf0\x9d\x95\x94" },
+		  { 6551, 6, 3, false, "\xe2\x88\x90" },
+		  { 6557, 4, 2, true, "\xc2\xa9" },
+		  { 6561, 6, 3, false, "\xe2\x84\x97" },
+		  { 6567, 5, 3, false, "\xe2\x86\xb5" },
+		  { 6572, 5, 3, false, "\xe2\x9c\x97" },
+		  { 6577, 4, 4, false, "\xf0\x9d\x92\xb8" },
+		  { 6581, 4, 3, false, "\xe2\xab\x8f" },
+		  { 6585, 5, 3, false, "\xe2\xab\x91" },
+		  { 6590, 4, 3, false, "\xe2\xab\x90" },
+		  { 6594, 5, 3, false, "\xe2\xab\x92" },
+		  { 6599, 5, 3, false, "\xe2\x8b\xaf" },
+		  { 6604, 7, 3, false, "\xe2\xa4\xb8" },
+		  { 6611, 7, 3, false, "\xe2\xa4\xb5" },
+		  { 6618, 5, 3, false, "\xe2\x8b\x9e" },
+		  { 6623, 5, 3, false, "\xe2\x8b\x9f" },
+		  { 6628, 6, 3, false, "\xe2\x86\xb6" },
+		  { 6634, 7, 3, false, "\xe2\xa4\xbd" },
+		  { 6641, 3, 3, false, "\xe2\x88\xaa" },
+		  { 6644, 8, 3, false, "\xe2\xa9\x88" },
+		  { 6652, 6, 3, false, "\xe2\xa9\x86" },
+		  { 6658, 6, 3, false, "\xe2\xa9\x8a" },
+		  { 6664, 6, 3, false, "\xe2\x8a\x8d" },
+		  { 6670, 5, 3, false, "\xe2\xa9\x85" },
+		  { 6675, 4, 6, false, "\xe2\x88\xaa\xef\xb8\x80" },
+		  { 6679, 6, 3, false, "\xe2\x86\xb7" },
+		  { 6685, 7, 3, false, "\xe2\xa4\xbc" },
+		  { 6692, 11, 3, false, "\xe2\x8b\x9e" },
+		  { 6703, 11, 3, false, "\xe2\x8b\x9f" },
+		  { 6714, 8, 3, false, "\xe2\x8b\x8e" },
+		  { 6722, 10, 3, false, "\xe2\x8b\x8f" },
+		  { 6732, 6, 2, true, "\xc2\xa4" },
+		  { 6738, 14, 3, false, "\xe2\x86\xb6" },
+		  { 6752, 15, 3, false, "\xe2\x86\xb7" },
+		  { 6767, 5, 3, false, "\xe2\x8b\x8e" },
+		  { 6772, 5, 3, false, "\xe2\x8b\x8f" },
+		  { 6777, 8, 3, false, "\xe2\x88\xb2" },
+		  { 6785, 5, 3, false, "\xe2\x88\xb1" },
+		  { 6790, 6, 3, false, "\xe2\x8c\xad" },
+		  { 6796, 4, 3, false, "\xe2\x87\x93" },
+		  { 6800, 4, 3, false, "\xe2\xa5\xa5" },
+		  { 6804, 6, 3, false, "\xe2\x80\xa0" },
+		  { 6810, 6, 3, false, "\xe2\x84\xb8" },
+		  { 6816, 4, 3, false, "\xe2\x86\x93" },
+		  { 6820, 4, 3, false, "\xe2\x80\x90" },
+		  { 6824, 5, 3, false, "\xe2\x8a\xa3" },
+		  { 6829, 7, 3, false, "\xe2\xa4\x8f" },
+		  { 6836, 5, 2, false, "\xcb\x9d" },
+		  { 6841, 6, 2, false, "\xc4\x8f" },
+		  { 6847, 3, 2, false, "\xd0\xb4" },
+		  { 6850, 2, 3, false, "\xe2\x85\x86" },
+		  { 6852, 7, 3, false, "\xe2\x80\xa1" },
+		  { 6859, 5, 3, false, "\xe2\x87\x8a" },
+		  { 6864, 7, 3, false, "\xe2\xa9\xb7" },
+		  { 6871, 3, 2, true, "\xc2\xb0" },
+		  { 6874, 5, 2, false, "\xce\xb4" },
+		  { 6879, 7, 3, false, "\xe2\xa6\xb1" },
+		  { 6886, 6, 3, false, "\xe2\xa5\xbf" },
+		  { 6892, 3, 4, false, "\xf0\x9d\x94\xa1" },
+		  { 6895, 5, 3, false, "\xe2\x87\x83" },
+		  { 6900, 5, 3, false, "\xe2\x87\x82" },
+		  { 6905, 4, 3, false, "\xe2\x8b\x84" },
+		  { 6909, 7, 3, false, "\xe2\x8b\x84" },
+		  { 6916, 11, 3, false, "\xe2\x99\xa6" },
+		  { 6927, 5, 3, false, "\xe2\x99\xa6" },
+		  { 6932, 3, 2, false, "\xc2\xa8" },
+		  { 6935, 7, 2, false, "\xcf\x9d" },
+		  { 6942, 5, 3, false, "\xe2\x8b\xb2" },
+		  { 6947, 3, 2, false, "\xc3\xb7" },
+		  { 6950, 6, 2, true, "\xc3\xb7" },
+		  { 6956, 13, 3, false, "\xe2\x8b\x87" },
+		  { 6969, 6, 3, false, "\xe2\x8b\x87" },
+		  { 6975, 4, 2, false, "\xd1\x92" },
+		  { 6979, 6, 3, false, "\xe2\x8c\x9e" },
+		  { 6985, 6, 3, false, "\xe2\x8c\x8d" },
+		  { 6991, 6, 1, false, "\x24" },
+		  { 6997, 4, 4, false, "\xf0\x9d\x95\x95" },
+		  { 7001, 3, 2, false, "\xcb\x99" },
+		  { 7004, 5, 3, false, "\xe2\x89\x90" },
+		  { 7009, 8, 3, false, "\xe2\x89\x91" },
+		  { 7017, 8, 3, false, "\xe2\x88\xb8" },
+		  { 7025, 7, 3, false, "\xe2\x88\x94" },
+		  { 7032, 9, 3, false, "\xe2\x8a\xa1" },
+		  { 7041, 14, 3, false, "\xe2\x8c\x86" },
+		  { 7055, 9, 3, false, "\xe2\x86\x93" },
+		  { 7064, 14, 3, false, "\xe2\x87\x8a" },
+		  { 7078, 15, 3, false, "\xe2\x87\x83" },
+		  { 7093, 16, 3, false, "\xe2\x87\x82" },
+		  { 7109, 8, 3, false, "\xe2\xa4\x90" },
+		  { 7117, 6, 3, false, "\xe2\x8c\x9f" },
+		  { 7123, 6, 3, false, "\xe2\x8c\x8c" },
+		  { 7129, 4, 4, false, "\xf0\x9d\x92\xb9" },
+		  { 7133, 4, 2, false, "\xd1\x95" },
+		  { 7137, 4, 3, false, "\xe2\xa7\xb6" },
+		  { 7141, 6, 2, false, "\xc4\x91" },
+		  { 7147, 5, 3, false, "\xe2\x8b\xb1" },
+		  { 7152, 4, 3, false, "\xe2\x96\xbf" },
+		  { 7156, 5, 3, false, "\xe2\x96\xbe" },
+		  { 7161, 5, 3, false, "\xe2\x87\xb5" },
+		  { 7166, 5, 3, false, "\xe2\xa5\xaf" },
+		  { 7171, 7, 3, false, "\xe2\xa6\xa6" },
+		  { 7178, 4, 2, false, "\xd1\x9f" },
+		  { 7182, 8, 3, false, "\xe2\x9f\xbf" },
+		  { 7190, 5, 3, false, "\xe2\xa9\xb7" },
+		  { 7195, 4, 3, false, "\xe2\x89\x91" },
+		  { 7199, 6, 2, true, "\xc3\xa9" },
+		  { 7205, 6, 3, false, "\xe2\xa9\xae" },
+		  { 7211, 6, 2, false, "\xc4\x9b" },
+		  { 7217, 4, 3, false, "\xe2\x89\x96" },
+		  { 7221, 5, 2, true, "\xc3\xaa" },
+		  { 7226, 6, 3, false, "\xe2\x89\x95" },
+		  { 7232, 3, 2, false, "\xd1\x8d" },
+		  { 7235, 4, 2, false, "\xc4\x97" },
+		  { 7239, 2, 3, false, "\xe2\x85\x87" },
+		  { 7241, 5, 3, false, "\xe2\x89\x92" },
+		  { 7246, 3, 4, false, "\xf0\x9d\x94\xa2" },
+		  { 7249, 2, 3, false, "\xe2\xaa\x9a" },
+		  { 7251, 6, 2, true, "\xc3\xa8" },
+		  { 7257, 3, 3, false, "\xe2\xaa\x96" },
+		  { 7260, 6, 3, false, "\xe2\xaa\x98" },
+		  { 7266, 2, 3, false, "\xe2\xaa\x99" },
+		  { 7268, 8, 3, false, "\xe2\x8f\xa7" },
+		  { 7276, 3, 3, false, "\xe2\x84\x93" },
+		  { 7279, 3, 3, false, "\xe2\xaa\x95" },
+		  { 7282, 6, 3, false, "\xe2\xaa\x97" },
+		  { 7288, 5, 2, false, "\xc4\x93" },
+		  { 7293, 5, 3, false, "\xe2\x88\x85" },
+		  { 7298, 8, 3, false, "\xe2\x88\x85" },
+		  { 7306, 6, 3, false, "\xe2\x88\x85" },
+		  { 7312, 4, 3, false, "\xe2\x80\x83" },
+		  { 7316, 6, 3, false, "\xe2\x80\x84" },
+		  { 7322, 6, 3, false, "\xe2\x80\x85" },
+		  { 7328, 3, 2, false, "\xc5\x8b" },
+		  { 7331, 4, 3, false, "\xe2\x80\x82" },
+		  { 7335, 5, 2, false, "\xc4\x99" },
+		  { 7340, 4, 4, false, "\xf0\x9d\x95\x96" },
+		  { 7344, 4, 3, false, "\xe2\x8b\x95" },
+		  { 7348, 6, 3, false, "\xe2\xa7\xa3" },
+		  { 7354, 5, 3, false, "\xe2\xa9\xb1" },
+		  { 7359, 4, 2, false, "\xce\xb5" },
+		  { 7363, 7, 2, false, "\xce\xb5" },
+		  { 7370, 5, 2, false, "\xcf\xb5" },
+		  { 7375, 6, 3, false, "\xe2\x89\x96" },
+		  { 7381, 7, 3, false, "\xe2\x89\x95" },
+		  { 7388, 5, 3, false, "\xe2\x89\x82" },
+		  { 7393, 10, 3, false, "\xe2\xaa\x96" },
+		  { 7403, 11, 3, false, "\xe2\xaa\x95" },
+		  { 7414, 6, 1, false, "\x3d" },
+		  { 7420, 6, 3, false, "\xe2\x89\x9f" },
+		  { 7426, 5, 3, false, "\xe2\x89\xa1" },
+		  { 7431, 7, 3, false, "\xe2\xa9\xb8" },
+		  { 7438, 8, 3, false, "\xe2\xa7\xa5" },
+		  { 7446, 5, 3, false, "\xe2\x89\x93" },
+		  { 7451, 5, 3, false, "\xe2\xa5\xb1" },
+		  { 7456, 4, 3, false, "\xe2\x84\xaf" },
+		  { 7460, 5, 3, false, "\xe2\x89\x90" },
+		  { 7465, 4, 3, false, "\xe2\x89\x82" },
+		  { 7469, 3, 2, false, "\xce\xb7" },
+		  { 7472, 3, 2, true, "\xc3\xb0" },
+		  { 7475, 4, 2, true, "\xc3\xab" },
+		  { 7479, 4, 3, false, "\xe2\x82\xac" },
+		  { 7483, 4, 1, false, "\x21" },
+		  { 7487, 5, 3, false, "\xe2\x88\x83" },
+		  { 7492, 11, 3, false, "\xe2\x84\xb0" },
+		  { 7503, 12, 3, false, "\xe2\x85\x87" },
+		  { 7515, 13, 3, false, "\xe2\x89\x92" },
+		  { 7528, 3, 2, false, "\xd1\x84" },
+		  { 7531, 6, 3, false, "\xe2\x99\x80" },
+		  { 7537, 6, 3, false, "\xef\xac\x83" },
+		  { 7543, 5, 3, false, "\xef\xac\x80" },
+		  { 7548, 6, 3, false, "\xef\xac\x84" },
+		  { 7554, 3, 4, false, "\xf0\x9d\x94\xa3" },
+		  { 7557, 5, 3, false, "\xef\xac\x81" },
+		  { 7562, 5, 2, false, "\x66\x6a" },
+		  { 7567, 4, 3, false, "\xe2\x99\xad" },
+		  { 7571, 5, 3, false, "\xef\xac\x82" },
+		  { 7576, 5, 3, false, "\xe2\x96\xb1" },
+		  { 7581, 4, 2, false, "\xc6\x92" },
+		  { 7585, 4, 4, false, "\xf0\x9d\x95\x97" },
+		  { 7589, 6, 3, false, "\xe2\x88\x80" },
+		  { 7595, 4, 3, false, "\xe2\x8b\x94" },
+		  { 7599, 5, 3, false, "\xe2\xab\x99" },
+		  { 7604, 8, 3, false, "\xe2\xa8\x8d" },
+		  { 7612, 6, 2, true, "\xc2\xbd" },
+		  { 7618, 6, 3, false, "\xe2\x85\x93" },
+		  { 7624, 6, 2, true, "\xc2\xbc" },
+		  { 7630, 6, 3, false, "\xe2\x85\x95" },
+		  { 7636, 6, 3, false, "\xe2\x85\x99" },
+		  { 7642, 6, 3, false, "\xe2\x85\x9b" },
+		  { 7648, 6, 3, false, "\xe2\x85\x94" },
+		  { 7654, 6, 3, false, "\xe2\x85\x96" },
+		  { 7660, 6, 2, true, "\xc2\xbe" },
+		  { 7666, 6, 3, false, "\xe2\x85\x97" },
+		  { 7672, 6, 3, false, "\xe2\x85\x9c" },
+		  { 7678, 6, 3, false, "\xe2\x85\x98" },
+		  { 7684, 6, 3, false, "\xe2\x85\x9a" },
+		  { 7690, 6, 3, false, "\xe2\x85\x9d" },
+		  { 7696, 6, 3, false, "\xe2\x85\x9e" },
+		  { 7702, 5, 3, false, "\xe2\x81\x84" },
+		  { 7707, 5, 3, false, "\xe2\x8c\xa2" },
+		  { 7712, 4, 4, false, "\xf0\x9d\x92\xbb" },
+		  { 7716, 2, 3, false, "\xe2\x89\xa7" },
+		  { 7718, 3, 3, false, "\xe2\xaa\x8c" },
+		  { 7721, 6, 2, false, "\xc7\xb5" },
+		  { 7727, 5, 2, false, "\xce\xb3" },
+		  { 7732, 6, 2, false, "\xcf\x9d" },
+		  { 7738, 3, 3, false, "\xe2\xaa\x86" },
+		  { 7741, 6, 2, false, "\xc4\x9f" },
+		  { 7747, 5, 2, false, "\xc4\x9d" },
+		  { 7752, 3, 2, false, "\xd0\xb3" },
+		  { 7755, 4, 2, false, "\xc4\xa1" },
+		  { 7759, 2, 3, false, "\xe2\x89\xa5" },
+		  { 7761, 3, 3, false, "\xe2\x8b\x9b" },
+		  { 7764, 3, 3, false, "\xe2\x89\xa5" },
+		  { 7767, 4, 3, false, "\xe2\x89\xa7" },
+		  { 7771, 8, 3, false, "\xe2\xa9\xbe" },
+		  { 7779, 3, 3, false, "\xe2\xa9\xbe" },
+		  { 7782, 5, 3, false, "\xe2\xaa\xa9" },
+		  { 7787, 6, 3, false, "\xe2\xaa\x80" },
+		  { 7793, 7, 3, false, "\xe2\xaa\x82" },
+		  { 7800, 8, 3, false, "\xe2\xaa\x84" },
+		  { 7808, 4, 6, false, "\xe2\x8b\x9b\xef\xb8\x80" },
+		  { 7812, 6, 3, false, "\xe2\xaa\x94" },
+		  { 7818, 3, 4, false, "\xf0\x9d\x94\xa4" },
+		  { 7821, 2, 3, false, "\xe2\x89\xab" },
+		  { 7823, 3, 3, false, "\xe2\x8b\x99" },
+		  { 7826, 5, 3, false, "\xe2\x84\xb7" },
+		  { 7831, 4, 2, false, "\xd1\x93" },
+		  { 7835, 2, 3, false, "\xe2\x89\xb7" },
+		  { 7837, 3, 3, false, "\xe2\xaa\x92" },
+		  { 7840, 3, 3, false, "\xe2\xaa\xa5" },
+		  { 7843, 3, 3, false, "\xe2\xaa\xa4" },
+		  { 7846, 3, 3, false, "\xe2\x89\xa9" },
+		  { 7849, 4, 3, false, "\xe2\xaa\x8a" },
+		  { 7853, 8, 3, false, "\xe2\xaa\x8a" },
+		  { 7861, 3, 3, false, "\xe2\xaa\x88" },
+		  { 7864, 4, 3, false, "\xe2\xaa\x88" },
+		  { 7868, 5, 3, false, "\xe2\x89\xa9" },
+		  { 7873, 5, 3, false, "\xe2\x8b\xa7" },
+		  { 7878, 4, 4, false, "\xf0\x9d\x95\x98" },
+		  { 7882, 5, 1, false, "\x60" },
+		  { 7887, 4, 3, false, "\xe2\x84\x8a" },
+		  { 7891, 4, 3, false, "\xe2\x89\xb3" },
+		  { 7895, 5, 3, false, "\xe2\xaa\x8e" },
+		  { 7900, 5, 3, false, "\xe2\xaa\x90" },
+		  { 7905, 2, 1, true, "\x3e" },
+		  { 7907, 4, 3, false, "\xe2\xaa\xa7" },
+		  { 7911, 5, 3, false, "\xe2\xa9\xba" },
+		  { 7916, 5, 3, false, "\xe2\x8b\x97" },
+		  { 7921, 6, 3, false, "\xe2\xa6\x95" },
+		  { 7927, 7, 3, false, "\xe2\xa9\xbc" },
+		  { 7934, 9, 3, false, "\xe2\xaa\x86" },
+		  { 7943, 6, 3, false, "\xe2\xa5\xb8" },
+		  { 7949, 6, 3, false, "\xe2\x8b\x97" },
+		  { 7955, 9, 3, false, "\xe2\x8b\x9b" },
+		  { 7964, 10, 3, false, "\xe2\xaa\x8c" },
+		  { 7974, 7, 3, false, "\xe2\x89\xb7" },
+		  { 7981, 6, 3, false, "\xe2\x89\xb3" },
+		  { 7987, 9, 6, false, "\xe2\x89\xa9\xef\xb8\x80" },
+		  { 7996, 4, 6, false, "\xe2\x89\xa9\xef\xb8\x80" },
+		  { 8000, 4, 3, false, "\xe2\x87\x94" },
+		  { 8004, 6, 3, false, "\xe2\x80\x8a" },
+		  { 8010, 4, 2, false, "\xc2\xbd" },
+		  { 8014, 6, 3, false, "\xe2\x84\x8b" },
+		  { 8020, 6, 2, false, "\xd1\x8a" },
+		  { 8026, 4, 3, false, "\xe2\x86\x94" },
+		  { 8030, 7, 3, false, "\xe2\xa5\x88" },
+		  { 8037, 5, 3, false, "\xe2\x86\xad" },
+		  { 8042, 4, 3, false, "\xe2\x84\x8f" },
+		  { 8046, 5, 2, false, "\xc4\xa5" },
+		  { 8051, 6, 3, false, "\xe2\x99\xa5" },
+		  { 8057, 9, 3, false, "\xe2\x99\xa5" },
+		  { 8066, 6, 3, false, "\xe2\x80\xa6" },
+		  { 8072, 6, 3, false, "\xe2\x8a\xb9" },
+		  { 8078, 3, 4, false, "\xf0\x9d\x94\xa5" },
+		  { 8081, 8, 3, false, "\xe2\xa4\xa5" },
+		  { 8089, 8, 3, false, "\xe2\xa4\xa6" },
+		  { 8097, 5, 3, false, "\xe2\x87\xbf" },
+		  { 8102, 6, 3, false, "\xe2\x88\xbb" },
+		  { 8108, 13, 3, false, "\xe2\x86\xa9" },
+		  { 8121, 14, 3, false, "\xe2\x86\xaa" },
+		  { 8135, 4, 4, false, "\xf0\x9d\x95\x99" },
+		  { 8139, 6, 3, false, "\xe2\x80\x95" },
+		  { 8145, 4, 4, false, "\xf0\x9d\x92\xbd" },
+		  { 8149, 6, 3, false, "\xe2\x84\x8f" },
+		  { 8155, 6, 2, false, "\xc4\xa7" },
+		  { 8161, 6, 3, false, "\xe2\x81\x83" },
+		  { 8167, 6, 3, false, "\xe2\x80\x90" },
+		  { 8173, 6, 2, true, "\xc3\xad" },
+		  { 8179, 2, 3, false, "\xe2\x81\xa3" },
+		  { 8181, 5, 2, true, "\xc3\xae" },
+		  { 8186, 3, 2, false, "\xd0\xb8" },
+		  { 8189, 4, 2, false, "\xd0\xb5" },
+		  { 8193, 5, 2, true, "\xc2\xa1" },
+		  { 8198, 3, 3, false, "\xe2\x87\x94" },
+		  { 8201, 3, 4, false, "\xf0\x9d\x94\xa6" },
+		  { 8204, 6, 2, true, "\xc3\xac" },
+		  { 8210, 2, 3, false, "\xe2\x85\x88" },
+		  { 8212, 6, 3, false, "\xe2\xa8\x8c" },
+		  { 8218, 5, 3, false, "\xe2\x88\xad" },
+		  { 8223, 6, 3, false, "\xe2\xa7\x9c" },
+		  { 8229, 5, 3, false, "\xe2\x84\xa9" },
+		  { 8234, 5, 2, false, "\xc4\xb3" },
+		  { 8239, 5, 2, false, "\xc4\xab" },
+		  { 8244, 5, 3, false, "\xe2\x84\x91" },
+		  { 8249, 8, 3, false, "\xe2\x84\x90" },
+		  { 8257, 8, 3, false, "\xe2\x84\x91" },
+		  { 8265, 5, 2, false, "\xc4\xb1" },
+		  { 8270, 4, 3, false, "\xe2\x8a\xb7" },
+		  { 8274, 5, 2, false, "\xc6\xb5" },
+		  { 8279, 2, 3, false, "\xe2\x88\x88" },
+		  { 8281, 6, 3, false, "\xe2\x84\x85" },
+		  { 8287, 5, 3, false, "\xe2\x88\x9e" },
+		  { 8292, 8, 3, false, "\xe2\xa7\x9d" },
+		  { 8300, 6, 2, false, "\xc4\xb1" },
+		  { 8306, 3, 3, false, "\xe2\x88\xab" },
+		  { 8309, 6, 3, false, "\xe2\x8a\xba" },
+		  { 8315, 8, 3, false, "\xe2\x84\xa4" },
+		  { 8323, 8, 3, false, "\xe2\x8a\xba" },
+		  { 8331, 8, 3, false, "\xe2\xa8\x97" },
+		  { 8339, 7, 3, false, "\xe2\xa8\xbc" },
+		  { 8346, 4, 2, false, "\xd1\x91" },
+		  { 8350, 5, 2, false, "\xc4\xaf" },
+		  { 8355, 4, 4, false, "\xf0\x9d\x95\x9a" },
+		  { 8359, 4, 2, false, "\xce\xb9" },
+		  { 8363, 5, 3, false, "\xe2\xa8\xbc" },
+		  { 8368, 6, 2, true, "\xc2\xbf" },
+		  { 8374, 4, 4, false, "\xf0\x9d\x92\xbe" },
+		  { 8378, 4, 3, false, "\xe2\x88\x88" },
+		  { 8382, 5, 3, false, "\xe2\x8b\xb9" },
+		  { 8387, 7, 3, false, "\xe2\x8b\xb5" },
+		  { 8394, 5, 3, false, "\xe2\x8b\xb4" },
+		  { 8399, 6, 3, false, "\xe2\x8b\xb3" },
+		  { 8405, 5, 3, false, "\xe2\x88\x88" },
+		  { 8410, 2, 3, false, "\xe2\x81\xa2" },
+		  { 8412, 6, 2, false, "\xc4\xa9" },
+		  { 8418, 5, 2, false, "\xd1\x96" },
+		  { 8423, 4, 2, true, "\xc3\xaf" },
+		  { 8427, 5, 2, false, "\xc4\xb5" },
+		  { 8432, 3, 2, false, "\xd0\xb9" },
+		  { 8435, 3, 4, false, "\xf0\x9d\x94\xa7" },
+		  { 8438, 5, 2, false, "\xc8\xb7" },
+		  { 8443, 4, 4, false, "\xf0\x9d\x95\x9b" },
+		  { 8447, 4, 4, false, "\xf0\x9d\x92\xbf" },
+		  { 8451, 6, 2, false, "\xd1\x98" },
+		  { 8457, 5, 2, false, "\xd1\x94" },
+		  { 8462, 5, 2, false, "\xce\xba" },
+		  { 8467, 6, 2, false, "\xcf\xb0" },
+		  { 8473, 6, 2, false, "\xc4\xb7" },
+		  { 8479, 3, 2, false, "\xd0\xba" },
+		  { 8482, 3, 4, false, "\xf0\x9d\x94\xa8" },
+		  { 8485, 6, 2, false, "\xc4\xb8" },
+		  { 8491, 4, 2, false, "\xd1\x85" },
+		  { 8495, 4, 2, false, "\xd1\x9c" },
+		  { 8499, 4, 4, false, "\xf0\x9d\x95\x9c" },
+		  { 8503, 4, 4, false, "\xf0\x9d\x93\x80" },
+		  { 8507, 5, 3, false, "\xe2\x87\x9a" },
+		  { 8512, 4, 3, false, "\xe2\x87\x90" },
+		  { 8516, 6, 3, false, "\xe2\xa4\x9b" },
+		  { 8522, 5, 3, false, "\xe2\xa4\x8e" },
+		  { 8527, 2, 3, false, "\xe2\x89\xa6" },
+		  { 8529, 3, 3, false, "\xe2\xaa\x8b" },
+		  { 8532, 4, 3, false, "\xe2\xa5\xa2" },
+		  { 8536, 6, 2, false, "\xc4\xba" },
+		  { 8542, 8, 3, false, "\xe2\xa6\xb4" },
+		  { 8550, 6, 3, false, "\xe2\x84\x92" },
+		  { 8556, 6, 2, false, "\xce\xbb" },
+		  { 8562, 4, 3, false, "\xe2\x9f\xa8" },
+		  { 8566, 5, 3, false, "\xe2\xa6\x91" },
+		  { 8571, 6, 3, false, "\xe2\x9f\xa8" },
+		  { 8577, 3, 3, false, "\xe2\xaa\x85" },
+		  { 8580, 5, 2, true, "\xc2\xab" },
+		  { 8585, 4, 3, false, "\xe2\x86\x90" },
+		  { 8589, 5, 3, false, "\xe2\x87\xa4" },
+		  { 8594, 7, 3, false, "\xe2\xa4\x9f" },
+		  { 8601, 6, 3, false, "\xe2\xa4\x9d" },
+		  { 8607, 6, 3, false, "\xe2\x86\xa9" },
+		  { 8613, 6, 3, false, "\xe2\x86\xab" },
+		  { 8619, 6, 3, false, "\xe2\xa4\xb9" },
+		  { 8625, 7, 3, false, "\xe2\xa5\xb3" },
+		  { 8632, 6, 3, false, "\xe2\x86\xa2" },
+		  { 8638, 3, 3, false, "\xe2\xaa\xab" },
+		  { 8641, 6, 3, false, "\xe2\xa4\x99" },
+		  { 8647, 4, 3, false, "\xe2\xaa\xad" },
+		  { 8651, 5, 6, false, "\xe2\xaa\xad\xef\xb8\x80" },
+		  { 8656, 5, 3, false, "\xe2\xa4\x8c" },
+		  { 8661, 5, 3, false, "\xe2\x9d\xb2" },
+		  { 8666, 6, 1, false, "\x7b" },
+		  { 8672, 6, 1, false, "\x5b" },
+		  { 8678, 5, 3, false, "\xe2\xa6\x8b" },
+		  { 8683, 7, 3, false, "\xe2\xa6\x8f" },
+		  { 8690, 7, 3, false, "\xe2\xa6\x8d" },
+		  { 8697, 6, 2, false, "\xc4\xbe" },
+		  { 8703, 6, 2, false, "\xc4\xbc" },
+		  { 8709, 5, 3, false, "\xe2\x8c\x88" },
+		  { 8714, 4, 1, false, "\x7b" },
+		  { 8718, 3, 2, false, "\xd0\xbb" },
+		  { 8721, 4, 3, false, "\xe2\xa4\xb6" },
+		  { 8725, 5, 3, false, "\xe2\x80\x9c" },
+		  { 8730, 6, 3, false, "\xe2\x80\x9e" },
+		  { 8736, 7, 3, false, "\xe2\xa5\xa7" },
+		  { 8743, 8, 3, false, "\xe2\xa5\x8b" },
+		  { 8751, 4, 3, false, "\xe2\x86\xb2" },
+		  { 8755, 2, 3, false, "\xe2\x89\xa4" },
+		  { 8757, 9, 3, false, "\xe2\x86\x90" },
+		  { 8766, 13, 3, false, "\xe2\x86\xa2" },
+		  { 8779, 15, 3, false, "\xe2\x86\xbd" },
+		  { 8794, 13, 3, false, "\xe2\x86\xbc" },
+		  { 8807, 14, 3, false, "\xe2\x87\x87" },
+		  { 8821, 14, 3, false, "\xe2\x86\x94" },
+		  { 8835, 15, 3, false, "\xe2\x87\x86" },
+		  { 8850, 17, 3, false, "\xe2\x87\x8b" },
+		  { 8867, 19, 3, false, "\xe2\x86\xad" },
+		  { 8886, 14, 3, false, "\xe2\x8b\x8b" },
+		  { 8900, 3, 3, false, "\xe2\x8b\x9a" },
+		  { 8903, 3, 3, false, "\xe2\x89\xa4" },
+		  { 8906, 4, 3, false, "\xe2\x89\xa6" },
+		  { 8910, 8, 3, false, "\xe2\xa9\xbd" },
+		  { 8918, 3, 3, false, "\xe2\xa9\xbd" },
+		  { 8921, 5, 3, false, "\xe2\xaa\xa8" },
+		  { 8926, 6, 3, false, "\xe2\xa9\xbf" },
+		  { 8932, 7, 3, false, "\xe2\xaa\x81" },
+		  { 8939, 8, 3, false, "\xe2\xaa\x83" },
+		  { 8947, 4, 6, false, "\xe2\x8b\x9a\xef\xb8\x80" },
+		  { 8951, 6, 3, false, "\xe2\xaa\x93" },
+		  { 8957, 10, 3, false, "\xe2\xaa\x85" },
+		  { 8967, 7, 3, false, "\xe2\x8b\x96" },
+		  { 8974, 9, 3, false, "\xe2\x8b\x9a" },
+		  { 8983, 10, 3, false, "\xe2\xaa\x8b" },
+		  { 8993, 7, 3, false, "\xe2\x89\xb6" },
+		  { 9000, 7, 3, false, "\xe2\x89\xb2" },
+		  { 9007, 6, 3, false, "\xe2\xa5\xbc" },
+		  { 9013, 6, 3, false, "\xe2\x8c\x8a" },
+		  { 9019, 3, 4, false, "\xf0\x9d\x94\xa9" },
+		  { 9022, 2, 3, false, "\xe2\x89\xb6" },
+		  { 9024, 3, 3, false, "\xe2\xaa\x91" },
+		  { 9027, 5, 3, false, "\xe2\x86\xbd" },
+		  { 9032, 5, 3, false, "\xe2\x86\xbc" },
+		  { 9037, 6, 3, false, "\xe2\xa5\xaa" },
+		  { 9043, 5, 3, false, "\xe2\x96\x84" },
+		  { 9048, 4, 2, false, "\xd1\x99" },
+		  { 9052, 2, 3, false, "\xe2\x89\xaa" },
+		  { 9054, 5, 3, false, "\xe2\x87\x87" },
+		  { 9059, 8, 3, false, "\xe2\x8c\x9e" },
+		  { 9067, 6, 3, false, "\xe2\xa5\xab" },
+		  { 9073, 5, 3, false, "\xe2\x97\xba" },
+		  { 9078, 6, 2, false, "\xc5\x80" },
+		  { 9084, 6, 3, false, "\xe2\x8e\xb0" },
+		  { 9090, 10, 3, false, "\xe2\x8e\xb0" },
+		  { 9100, 3, 3, false, "\xe2\x89\xa8" },
+		  { 9103, 4, 3, false, "\xe2\xaa\x89" },
+		  { 9107, 8, 3, false, "\xe2\xaa\x89" },
+		  { 9115, 3, 3, false, "\xe2\xaa\x87" },
+		  { 9118, 4, 3, false, "\xe2\xaa\x87" },
+		  { 9122, 5, 3, false, "\xe2\x89\xa8" },
+		  { 9127, 5, 3, false, "\xe2\x8b\xa6" },
+		  { 9132, 5, 3, false, "\xe2\x9f\xac" },
+		  { 9137, 5, 3, false, "\xe2\x87\xbd" },
+		  { 9142, 5, 3, false, "\xe2\x9f\xa6" },
+		  { 9147, 13, 3, false, "\xe2\x9f\xb5" },
+		  { 9160, 18, 3, false, "\xe2\x9f\xb7" },
+		  { 9178, 10, 3, false, "\xe2\x9f\xbc" },
+		  { 9188, 14, 3, false, "\xe2\x9f\xb6" },
+		  { 9202, 13, 3, false, "\xe2\x86\xab" },
+		  { 9215, 14, 3, false, "\xe2\x86\xac" },
+		  { 9229, 5, 3, false, "\xe2\xa6\x85" },
+		  { 9234, 4, 4, false, "\xf0\x9d\x95\x9d" },
+		  { 9238, 6, 3, false, "\xe2\xa8\xad" },
+		  { 9244, 7, 3, false, "\xe2\xa8\xb4" },
+		  { 9251, 6, 3, false, "\xe2\x88\x97" },
+		  { 9257, 6, 1, false, "\x5f" },
+		  { 9263, 3, 3, false, "\xe2\x97\x8a" },
+		  { 9266, 7, 3, false, "\xe2\x97\x8a" },
+		  { 9273, 4, 3, false, "\xe2\xa7\xab" },
+		  { 9277, 4, 1, false, "\x28" },
+		  { 9281, 6, 3, false, "\xe2\xa6\x93" },
+		  { 9287, 5, 3, false, "\xe2\x87\x86" },
+		  { 9292, 8, 3, false, "\xe2\x8c\x9f" },
+		  { 9300, 5, 3, false, "\xe2\x87\x8b" },
+		  { 9305, 6, 3, false, "\xe2\xa5\xad" },
+		  { 9311, 3, 3, false, "\xe2\x80\x8e" },
+		  { 9314, 5, 3, false, "\xe2\x8a\xbf" },
+		  { 9319, 6, 3, false, "\xe2\x80\xb9" },
+		  { 9325, 4, 4, false, "\xf0\x9d\x93\x81" },
+		  { 9329, 3, 3, false, "\xe2\x86\xb0" },
+		  { 9332, 4, 3, false, "\xe2\x89\xb2" },
+		  { 9336, 5, 3, false, "\xe2\xaa\x8d" },
+		  { 9341, 5, 3, false, "\xe2\xaa\x8f" },
+		  { 9346, 4, 1, false, "\x5b" },
+		  { 9350, 5, 3, false, "\xe2\x80\x98" },
+		  { 9355, 6, 3, false, "\xe2\x80\x9a" },
+		  { 9361, 6, 2, false, "\xc5\x82" },
+		  { 9367, 2, 1, true, "\x3c" },
+		  { 9369, 4, 3, false, "\xe2\xaa\xa6" },
+		  { 9373, 5, 3, false, "\xe2\xa9\xb9" },
+		  { 9378, 5, 3, false, "\xe2\x8b\x96" },
+		  { 9383, 6, 3, false, "\xe2\x8b\x8b" },
+		  { 9389, 6, 3, false, "\xe2\x8b\x89" },
+		  { 9395, 6, 3, false, "\xe2\xa5\xb6" },
+		  { 9401, 7, 3, false, "\xe2\xa9\xbb" },
+		  { 9408, 6, 3, false, "\xe2\xa6\x96" },
+		  { 9414, 4, 3, false, "\xe2\x97\x83" },
+		  { 9418, 5, 3, false, "\xe2\x8a\xb4" },
+		  { 9423, 5, 3, false, "\xe2\x97\x82" },
+		  { 9428, 8, 3, false, "\xe2\xa5\x8a" },
+		  { 9436, 7, 3, false, "\xe2\xa5\xa6" },
+		  { 9443, 9, 6, false, "\xe2\x89\xa8\xef\xb8\x80" },
+		  { 9452, 4, 6, false, "\xe2\x89\xa8\xef\xb8\x80" },
+		  { 9456, 5, 3, false, "\xe2\x88\xba" },
+		  { 9461, 4, 2, true, "\xc2\xaf" },
+		  { 9465, 4, 3, false, "\xe2\x99\x82" },
+		  { 9469, 4, 3, false, "\xe2\x9c\xa0" },
+		  { 9473, 7, 3, false, "\xe2\x9c\xa0" },
+		  { 9480, 3, 3, false, "\xe2\x86\xa6" },
+		  { 9483, 6, 3, false, "\xe2\x86\xa6" },
+		  { 9489, 10, 3, false, "\xe2\x86\xa7" },
+		  { 9499, 10, 3, false, "\xe2\x86\xa4" },
+		  { 9509, 8, 3, false, "\xe2\x86\xa5" },
+		  { 9517, 6, 3, false, "\xe2\x96\xae" },
+		  { 9523, 6, 3, false, "\xe2\xa8\xa9" },
+		  { 9529, 3, 2, false, "\xd0\xbc" },
+		  { 9532, 5, 3, false, "\xe2\x80\x94" },
+		  { 9537, 13, 3, false, "\xe2\x88\xa1" },
+		  { 9550, 3, 4, false, "\xf0\x9d\x94\xaa" },
+		  { 9553, 3, 3, false, "\xe2\x84\xa7" },
+		  { 9556, 5, 2, true, "\xc2\xb5" },
+		  { 9561, 3, 3, false, "\xe2\x88\xa3" },
+		  { 9564, 6, 1, false, "\x2a" },
+		  { 9570, 6, 3, false, "\xe2\xab\xb0" },
+		  { 9576, 6, 2, true, "\xc2\xb7" },
+		  { 9582, 5, 3, false, "\xe2\x88\x92" },
+		  { 9587, 6, 3, false, "\xe2\x8a\x9f" },
+		  { 9593, 6, 3, false, "\xe2\x88\xb8" },
+		  { 9599, 7, 3, false, "\xe2\xa8\xaa" },
+		  { 9606, 4, 3, false, "\xe2\xab\x9b" },
+		  { 9610, 4, 3, false, "\xe2\x80\xa6" },
+		  { 9614, 6, 3, false, "\xe2\x88\x93" },
+		  { 9620, 6, 3, false, "\xe2\x8a\xa7" },
+		  { 9626, 4, 4, false, "\xf0\x9d\x95\x9e" },
+		  { 9630, 2, 3, false, "\xe2\x88\x93" },
+		  { 9632, 4, 4, false, "\xf0\x9d\x93\x82" },
+		  { 9636, 6, 3, false, "\xe2\x88\xbe" },
+		  { 9642, 2, 2, false, "\xce\xbc" },
+		  { 9644, 8, 3, false, "\xe2\x8a\xb8" },
+		  { 9652, 5, 3, false, "\xe2\x8a\xb8" },
+		  { 9657, 3, 5, false, "\xe2\x8b\x99\xcc\xb8" },
+		  { 9660, 3, 6, false, "\xe2\x89\xab\xe2\x83\x92" },
+		  { 9663, 4, 5, false, "\xe2\x89\xab\xcc\xb8" },
+		  { 9667, 10, 3, false, "\xe2\x87\x8d" },
+		  { 9677, 15, 3, false, "\xe2\x87\x8e" },
+		  { 9692, 3, 5, false, "\xe2\x8b\x98\xcc\xb8" },
+		  { 9695, 3, 6, false, "\xe2\x89\xaa\xe2\x83\x92" },
+		  { 9698, 4, 5, false, "\xe2\x89\xaa\xcc\xb8" },
+		  { 9702, 11, 3, false, "\xe2\x87\x8f" },
+		  { 9713, 6, 3, false, "\xe2\x8a\xaf" },
+		  { 9719, 6, 3, false, "\xe2\x8a\xae" },
+		  { 9725, 5, 3, false, "\xe2\x88\x87" },
+		  { 9730, 6, 2, false, "\xc5\x84" },
+		  { 9736, 4, 6, false, "\xe2\x88\xa0\xe2\x83\x92" },
+		  { 9740, 3, 3, false, "\xe2\x89\x89" },
+		  { 9743, 4, 5, false, "\xe2\xa9\xb0\xcc\xb8" },
+		  { 9747, 5, 5, false, "\xe2\x89\x8b\xcc\xb8" },
+		  { 9752, 5, 2, false, "\xc5\x89" },
+		  { 9757, 7, 3, false, "\xe2\x89\x89" },
+		  { 9764, 5, 3, false, "\xe2\x99\xae" },
+		  { 9769, 7, 3, false, "\xe2\x99\xae" },
+		  { 9776, 8, 3, false, "\xe2\x84\x95" },
+		  { 9784, 4, 2, true, "\xc2\xa0" },
+		  { 9788, 5, 5, false, "\xe2\x89\x8e\xcc\xb8" },
+		  { 9793, 6, 5, false, "\xe2\x89\x8f\xcc\xb8" },
+		  { 9799, 4, 3, false, "\xe2\xa9\x83" },
+		  { 9803, 6, 2, false, "\xc5\x88" },
+		  { 9809, 6, 2, false, "\xc5\x86" },
+		  { 9815, 5, 3, false, "\xe2\x89\x87" },
+		  { 9820, 8, 5, false, "\xe2\xa9\xad\xcc\xb8" },
+		  { 9828, 4, 3, false, "\xe2\xa9\x82" },
+		  { 9832, 3, 2, false, "\xd0\xbd" },
+		  { 9835, 5, 3, false, "\xe2\x80\x93" },
+		  { 9840, 2, 3, false, "\xe2\x89\xa0" },
+		  { 9842, 5, 3, false, "\xe2\x87\x97" },
+		  { 9847, 6, 3, false, "\xe2\xa4\xa4" },
+		  { 9853, 5, 3, false, "\xe2\x86\x97" },
+		  { 9858, 7, 3, false, "\xe2\x86\x97" },
+		  { 9865, 5, 5, false, "\xe2\x89\x90\xcc\xb8" },
+		  { 9870, 6, 3, false, "\xe2\x89\xa2" },
+		  { 9876, 6, 3, false, "\xe2\xa4\xa8" },
+		  { 9882, 5, 5, false, "\xe2\x89\x82\xcc\xb8" },
+		  { 9887, 6, 3, false, "\xe2\x88\x84" },
+		  { 9893, 7, 3, false, "\xe2\x88\x84" },
+		  { 9900, 3, 4, false, "\xf0\x9d\x94\xab" },
+		  { 9903, 3, 5, false, "\xe2\x89\xa7\xcc\xb8" },
+		  { 9906, 3, 3, false, "\xe2\x89\xb1" },
+		  { 9909, 4, 3, false, "\xe2\x89\xb1" },
+		  { 9913, 5, 5, false, "\xe2\x89\xa7\xcc\xb8" },
+		  { 9918, 9, 5, false, "\xe2\xa9\xbe\xcc\xb8" },
+		  { 9927, 4, 5, false, "\xe2\xa9\xbe\xcc\xb8" },
+		  { 9931, 5, 3, false, "\xe2\x89\xb5" },
+		  { 9936, 3, 3, false, "\xe2\x89\xaf" },
+		  { 9939, 4, 3, false, "\xe2\x89\xaf" },
+		  { 9943, 5, 3, false, "\xe2\x87\x8e" },
+		  { 9948, 5, 3, false, "\xe2\x86\xae" },
+		  { 9953, 5, 3, false, "\xe2\xab\xb2" },
+		  { 9958, 2, 3, false, "\xe2\x88\x8b" },
+		  { 9960, 3, 3, false, "\xe2\x8b\xbc" },
+		  { 9963, 4, 3, false, "\xe2\x8b\xba" },
+		  { 9967, 3, 3, false, "\xe2\x88\x8b" },
+		  { 9970, 4, 2, false, "\xd1\x9a" },
+		  { 9974, 5, 3, false, "\xe2\x87\x8d" },
+		  { 9979, 3, 5, false, "\xe2\x89\xa6\xcc\xb8" },
+		  { 9982, 5, 3, false, "\xe2\x86\x9a" },
+		  { 9987, 4, 3, false, "\xe2\x80\xa5" },
+		  { 9991, 3, 3, false, "\xe2\x89\xb0" },
+		  { 9994, 10, 3, false, "\xe2\x86\x9a" },
+		  { 10004, 15, 3, false, "\xe2\x86\xae" },
+		  { 10019, 4, 3, false, "\xe2\x89\xb0" },
+		  { 10023, 5, 5, false, "\xe2\x89\xa6\xcc\xb8" },
+		  { 10028, 9, 5, false, "\xe2\xa9\xbd\xcc\xb8" },
+		  { 10037, 4, 5, false, "\xe2\xa9\xbd\xcc\xb8" },
+		  { 10041, 5, 3, false, "\xe2\x89\xae" },
+		  { 10046, 5, 3, false, "\xe2\x89\xb4" },
+		  { 10051, 3, 3, false, "\xe2\x89\xae" },
+		  { 10054, 5, 3, false, "\xe2\x8b\xaa" },
+		  { 10059, 6, 3, false, "\xe2\x8b\xac" },
+		  { 10065, 4, 3, false, "\xe2\x88\xa4" },
+		  { 10069, 4, 4, false, "\xf0\x9d\x95\x9f" },
+		  { 10073, 3, 2, true, "\xc2\xac" },
+		  { 10076, 5, 3, false, "\xe2\x88\x89" },
+		  { 10081, 6, 5, false, "\xe2\x8b\xb9\xcc\xb8" },
+		  { 10087, 8, 5, false, "\xe2\x8b\xb5\xcc\xb8" },
+		  { 10095, 7, 3, false, "\xe2\x88\x89" },
+		  { 10102, 7, 3, false, "\xe2\x8b\xb7" },
+		  { 10109, 7, 3, false, "\xe2\x8b\xb6" },
+		  { 10116, 5, 3, false, "\xe2\x88\x8c" },
+		  { 10121, 7, 3, false, "\xe2\x88\x8c" },
+		  { 10128, 7, 3, false, "\xe2\x8b\xbe" },
+		  { 10135, 7, 3, false, "\xe2\x8b\xbd" },
+		  { 10142, 4, 3, false, "\xe2\x88\xa6" },
+		  { 10146, 9, 3, false, "\xe2\x88\xa6" },
+		  { 10155, 6, 6, false, "\xe2\xab\xbd\xe2\x83\xa5" },
+		  { 10161, 5, 5, false, "\xe2\x88\x82\xcc\xb8" },
+		  { 10166, 7, 3, false, "\xe2\xa8\x94" },
+		  { 10173, 3, 3, false, "\xe2\x8a\x80" },
+		  { 10176, 6, 3, false, "\xe2\x8b\xa0" },
+		  { 10182, 4, 5, false, "\xe2\xaa\xaf\xcc\xb8" },
+		  { 10186, 5, 3, false, "\xe2\x8a\x80" },
+		  { 10191, 7, 5, false, "\xe2\xaa\xaf\xcc\xb8" },
+		  { 10198, 5, 3, false, "\xe2\x87\x8f" },
+		  { 10203, 5, 3, false, "\xe2\x86\x9b" },
+		  { 10208, 6, 5, false, "\xe2\xa4\xb3\xcc\xb8" },
+		  { 10214, 6, 5, false, "\xe2\x86\x9d\xcc\xb8" },
+		  { 10220, 11, 3, false, "\xe2\x86\x9b" },
+		  { 10231, 5, 3, false, "\xe2\x8b\xab" },
+		  { 10236, 6, 3, false, "\xe2\x8b\xad" },
+		  { 10242, 3, 3, false, "\xe2\x8a\x81" },
+		  { 10245, 6, 3, false, "\xe2\x8b\xa1" },
+		  { 10251, 4, 5, false, "\xe2\xaa\xb0\xcc\xb8" },
+		  { 10255, 4, 4, false, "\xf0\x9d\x93\x83" },
+		  { 10259, 9, 3, false, "\xe2\x88\xa4" },
+		  { 10268, 14, 3, false, "\xe2\x88\xa6" },
+		  { 10282, 4, 3, false, "\xe2\x89\x81" },
+		  { 10286, 5, 3, false, "\xe2\x89\x84" },
+		  { 10291, 6, 3, false, "\xe2\x89\x84" },
+		  { 10297, 5, 3, false, "\xe2\x88\xa4" },
+		  { 10302, 5, 3, false, "\xe2\x88\xa6" },
+		  { 10307, 7, 3, false, "\xe2\x8b\xa2" },
+		  { 10314, 7, 3, false, "\xe2\x8b\xa3" },
+		  { 10321, 4, 3, false, "\xe2\x8a\x84" },
+		  { 10325, 5, 5, false, "\xe2\xab\x85\xcc\xb8" },
+		  { 10330, 5, 3, false, "\xe2\x8a\x88" },
+		  { 10335, 7, 6, false, "\xe2\x8a\x82\xe2\x83\x92" },
+		  { 10342, 9, 3, false, "\xe2\x8a\x88" },
+		  { 10351, 10, 5, false, "\xe2\xab\x85\xcc\xb8" },
+		  { 10361, 5, 3, false, "\xe2\x8a\x81" },
+		  { 10366, 7, 5, false, "\xe2\xaa\xb0\xcc\xb8" },
+		  { 10373, 4, 3, false, "\xe2\x8a\x85" },
+		  { 10377, 5, 5, false, "\xe2\xab\x86\xcc\xb8" },
+		  { 10382, 5, 3, false, "\xe2\x8a\x89" },
+		  { 10387, 7, 6, false, "\xe2\x8a\x83\xe2\x83\x92" },
+		  { 10394, 9, 3, false, "\xe2\x8a\x89" },
+		  { 10403, 10, 5, false, "\xe2\xab\x86\xcc\xb8" },
+		  { 10413, 4, 3, false, "\xe2\x89\xb9" },
+		  { 10417, 6, 2, true, "\xc3\xb1" },
+		  { 10423, 4, 3, false, "\xe2\x89\xb8" },
+		  { 10427, 13, 3, false, "\xe2\x8b\xaa" },
+		  { 10440, 15, 3, false, "\xe2\x8b\xac" },
+		  { 10455, 14, 3, false, "\xe2\x8b\xab" },
+		  { 10469, 16, 3, false, "\xe2\x8b\xad" },
+		  { 10485, 2, 2, false, "\xce\xbd" },
+		  { 10487, 3, 1, false, "\x23" },
+		  { 10490, 6, 3, false, "\xe2\x84\x96" },
+		  { 10496, 5, 3, false, "\xe2\x80\x87" },
+		  { 10501, 6, 3, false, "\xe2\x8a\xad" },
+		  { 10507, 6, 3, false, "\xe2\xa4\x84" },
+		  { 10513, 4, 6, false, "\xe2\x89\x8d\xe2\x83\x92" },
+		  { 10517, 6, 3, false, "\xe2\x8a\xac" },
+		  { 10523, 4, 6, false, "\xe2\x89\xa5\xe2\x83\x92" },
+		  { 10527, 4, 4, false, "\x3e\xe2\x83\x92" },
+		  { 10531, 7, 3, false, "\xe2\xa7\x9e" },
+		  { 10538, 6, 3, false, "\xe2\xa4\x82" },
+		  { 10544, 4, 6, false, "\xe2\x89\xa4\xe2\x83\x92" },
+		  { 10548, 4, 4, false, "\x3c\xe2\x83\x92" },
+		  { 10552, 7, 6, false, "\xe2\x8a\xb4\xe2\x83\x92" },
+		  { 10559, 6, 3, false, "\xe2\xa4\x83" },
+		  { 10565, 7, 6, false, "\xe2\x8a\xb5\xe2\x83\x92" },
+		  { 10572, 5, 6, false, "\xe2\x88\xbc\xe2\x83\x92" },
+		  { 10577, 5, 3, false, "\xe2\x87\x96" },
+		  { 10582, 6, 3, false, "\xe2\xa4\xa3" },
+		  { 10588, 5, 3, false, "\xe2\x86\x96" },
+		  { 10593, 7, 3, false, "\xe2\x86\x96" },
+		  { 10600, 6, 3, false, "\xe2\xa4\xa7" },
+		  { 10606, 2, 3, false, "\xe2\x93\x88" },
+		  { 10608, 6, 2, true, "\xc3\xb3" },
+		  { 10614, 4, 3, false, "\xe2\x8a\x9b" },
+		  { 10618, 4, 3, false, "\xe2\x8a\x9a" },
+		  { 10622, 5, 2, true, "\xc3\xb4" },
+		  { 10627, 3, 2, false, "\xd0\xbe" },
+		  { 10630, 5, 3, false, "\xe2\x8a\x9d" },
+		  { 10635, 6, 2, false, "\xc5\x91" },
+		  { 10641, 4, 3, false, "\xe2\xa8\xb8" },
+		  { 10645, 4, 3, false, "\xe2\x8a\x99" },
+		  { 10649, 6, 3, false, "\xe2\xa6\xbc" },
+		  { 10655, 5, 2, false, "\xc5\x93" },
+		  { 10660, 5, 3, false, "\xe2\xa6\xbf" },
+		  { 10665, 3, 4, false, "\xf0\x9d\x94\xac" },
+		  { 10668, 4, 2, false, "\xcb\x9b" },
+		  { 10672, 6, 2, true, "\xc3\xb2" },
+		  { 10678, 3, 3, false, "\xe2\xa7\x81" },
+		  { 10681, 5, 3, false, "\xe2\xa6\xb5" },
+		  { 10686, 3, 2, false, "\xce\xa9" },
+		  { 10689, 4, 3, false, "\xe2\x88\xae" },
+		  { 10693, 5, 3, false, "\xe2\x86\xba" },
+		  { 10698, 5, 3, false, "\xe2\xa6\xbe" },
+		  { 10703, 7, 3, false, "\xe2\xa6\xbb" },
+		  { 10710, 5, 3, false, "\xe2\x80\xbe" },
+		  { 10715, 3, 3, false, "\xe2\xa7\x80" },
+		  { 10718, 5, 2, false, "\xc5\x8d" },
+		  { 10723, 5, 2, false, "\xcf\x89" },
+		  { 10728, 7, 2, false, "\xce\xbf" },
+		  { 10735, 4, 3, false, "\xe2\xa6\xb6" },
+		  { 10739, 6, 3, false, "\xe2\x8a\x96" },
+		  { 10745, 4, 4, false, "\xf0\x9d\x95\xa0" },
+		  { 10749, 4, 3, false, "\xe2\xa6\xb7" },
+		  { 10753, 5, 3, false, "\xe2\xa6\xb9" },
+		  { 10758, 5, 3, false, "\xe2\x8a\x95" },
+		  { 10763, 2, 3, false, "\xe2\x88\xa8" },
+		  { 10765, 5, 3, false, "\xe2\x86\xbb" },
+		  { 10770, 3, 3, false, "\xe2\xa9\x9d" },
+		  { 10773, 5, 3, false, "\xe2\x84\xb4" },
+		  { 10778, 7, 3, false, "\xe2\x84\xb4" },
+		  { 10785, 4, 2, true, "\xc2\xaa" },
+		  { 10789, 4, 2, true, "\xc2\xba" },
+		  { 10793, 6, 3, false, "\xe2\x8a\xb6" },
+		  { 10799, 4, 3, false, "\xe2\xa9\x96" },
+		  { 10803, 7, 3, false, "\xe2\xa9\x97" },
+		  { 10810, 3, 3, false, "\xe2\xa9\x9b" },
+		  { 10813, 4, 3, false, "\xe2\x84\xb4" },
+		  { 10817, 6, 2, true, "\xc3\xb8" },
+		  { 10823, 4, 3, false, "\xe2\x8a\x98" },
+		  { 10827, 6, 2, true, "\xc3\xb5" },
+		  { 10833, 6, 3, false, "\xe2\x8a\x97" },
+		  { 10839, 8, 3, false, "\xe2\xa8\xb6" },
+		  { 10847, 4, 2, true, "\xc3\xb6" },
+		  { 10851, 5, 3, false, "\xe2\x8c\xbd" },
+		  { 10856, 3, 3, false, "\xe2\x88\xa5" },
+		  { 10859, 4, 2, true, "\xc2\xb6" },
+		  { 10863, 8, 3, false, "\xe2\x88\xa5" },
+		  { 10871, 6, 3, false, "\xe2\xab\xb3" },
+		  { 10877, 5, 3, false, "\xe2\xab\xbd" },
+		  { 10882, 4, 3, false, "\xe2\x88\x82" },
+		  { 10886, 3, 2, false, "\xd0\xbf" },
+		  { 10889, 6, 1, false, "\x25" },
+		  { 10895, 6, 1, false, "\x2e" },
+		  { 10901, 6, 3, false, "\xe2\x80\xb0" },
+		  { 10907, 4, 3, false, "\xe2\x8a\xa5" },
+		  { 10911, 7, 3, false, "\xe2\x80\xb1" },
+		  { 10918, 3, 4, false, "\xf0\x9d\x94\xad" },
+		  { 10921, 3, 2, false, "\xcf\x86" },
+		  { 10924, 4, 2, false, "\xcf\x95" },
+		  { 10928, 6, 3, false, "\xe2\x84\xb3" },
+		  { 10934, 5, 3, false, "\xe2\x98\x8e" },
+		  { 10939, 2, 2, false, "\xcf\x80" },
+		  { 10941, 9, 3, false, "\xe2\x8b\x94" },
+		  { 10950, 3, 2, false, "\xcf\x96" },
+		  { 10953, 6, 3, false, "\xe2\x84\x8f" },
+		  { 10959, 7, 3, false, "\xe2\x84\x8e" },
+		  { 10966, 6, 3, false, "\xe2\x84\x8f" },
+		  { 10972, 4, 1, false, "\x2b" },
+		  { 10976, 8, 3, false, "\xe2\xa8\xa3" },
+		  { 10984, 5, 3, false, "\xe2\x8a\x9e" },
+		  { 10989, 7, 3, false, "\xe2\xa8\xa2" },
+		  { 10996, 6, 3, false, "\xe2\x88\x94" },
+		  { 11002, 6, 3, false, "\xe2\xa8\xa5" },
+		  { 11008, 5, 3, false, "\xe2\xa9\xb2" },
+		  { 11013, 6, 2, true, "\xc2\xb1" },
+		  { 11019, 7, 3, false, "\xe2\xa8\xa6" },
+		  { 11026, 7, 3, false, "\xe2\xa8\xa7" },
+		  { 11033, 2, 2, false, "\xc2\xb1" },
+		  { 11035, 8, 3, false, "\xe2\xa8\x95" },
+		  { 11043, 4, 4, false, "\xf0\x9d\x95\xa1" },
+		  { 11047, 5, 2, true, "\xc2\xa3" },
+		  { 11052, 2, 3, false, "\xe2\x89\xba" },
+		  { 11054, 3, 3, false, "\xe2\xaa\xb3" },
+		  { 11057, 4, 3, false, "\xe2\xaa\xb7" },
+		  { 11061, 5, 3, false, "\xe2\x89\xbc" },
+		  { 11066, 3, 3, false, "\xe2\xaa\xaf" },
+		  { 11069, 4, 3, false, "\xe2\x89\xba" },
+		  { 11073, 10, 3, false, "\xe2\xaa\xb7" },
+		  { 11083, 11, 3, false, "\xe2\x89\xbc" },
+		  { 11094, 6, 3, false, "\xe2\xaa\xaf" },
+		  { 11100, 11, 3, false, "\xe2\xaa\xb9" },
+		  { 11111, 8, 3, false, "\xe2\xaa\xb5" },
+		  { 11119, 8, 3, false, "\xe2\x8b\xa8" },
+		  { 11127, 7, 3, false, "\xe2\x89\xbe" },
+		  { 11134, 5, 3, false, "\xe2\x80\xb2" },
+		  { 11139, 6, 3, false, "\xe2\x84\x99" },
+		  { 11145, 4, 3, false, "\xe2\xaa\xb5" },
+		  { 11149, 5, 3, false, "\xe2\xaa\xb9" },
+		  { 11154, 6, 3, false, "\xe2\x8b\xa8" },
+		  { 11160, 4, 3, false, "\xe2\x88\x8f" },
+		  { 11164, 8, 3, false, "\xe2\x8c\xae" },
+		  { 11172, 8, 3, false, "\xe2\x8c\x92" },
+		  { 11180, 8, 3, false, "\xe2\x8c\x93" },
+		  { 11188, 4, 3, false, "\xe2\x88\x9d" },
+		  { 11192, 6, 3, false, "\xe2\x88\x9d" },
+		  { 11198, 5, 3, false, "\xe2\x89\xbe" },
+		  { 11203, 6, 3, false, "\xe2\x8a\xb0" },
+		  { 11209, 4, 4, false, "\xf0\x9d\x93\x85" },
+		  { 11213, 3, 2, false, "\xcf\x88" },
+		  { 11216, 6, 3, false, "\xe2\x80\x88" },
+		  { 11222, 3, 4, false, "\xf0\x9d\x94\xae" },
+		  { 11225, 4, 3, false, "\xe2\xa8\x8c" },
+		  { 11229, 4, 4, false, "\xf0\x9d\x95\xa2" },
+		  { 11233, 6, 3, false, "\xe2\x81\x97" },
+		  { 11239, 4, 4, false, "\xf0\x9d\x93\x86" },
+		  { 11243, 11, 3, false, "\xe2\x84\x8d" },
+		  { 11254, 7, 3, false, "\xe2\xa8\x96" },
+		  { 11261, 5, 1, false, "\x3f" },
+		  { 11266, 7, 3, false, "\xe2\x89\x9f" },
+		  { 11273, 4, 1, true, "\x22" },
+		  { 11277, 5, 3, false, "\xe2\x87\x9b" },
+		  { 11282, 4, 3, false, "\xe2\x87\x92" },
+		  { 11286, 6, 3, false, "\xe2\xa4\x9c" },
+		  { 11292, 5, 3, false, "\xe2\xa4\x8f" },
+		  { 11297, 4, 3, false, "\xe2\xa5\xa4" },
+		  { 11301, 4, 5, false, "\xe2\x88\xbd\xcc\xb1" },
+		  { 11305, 6, 2, false, "\xc5\x95" },
+		  { 11311, 5, 3, false, "\xe2\x88\x9a" },
+		  { 11316, 8, 3, false, "\xe2\xa6\xb3" },
+		  { 11324, 4, 3, false, "\xe2\x9f\xa9" },
+		  { 11328, 5, 3, false, "\xe2\xa6\x92" },
+		  { 11333, 5, 3, false, "\xe2\xa6\xa5" },
+		  { 11338, 6, 3, false, "\xe2\x9f\xa9" },
+		  { 11344, 5, 2, true, "\xc2\xbb" },
+		  { 11349, 4, 3, false, "\xe2\x86\x92" },
+		  { 11353, 6, 3, false, "\xe2\xa5\xb5" },
+		  { 11359, 5, 3, false, "\xe2\x87\xa5" },
+		  { 11364, 7, 3, false, "\xe2\xa4\xa0" },
+		  { 11371, 5, 3, false, "\xe2\xa4\xb3" },
+		  { 11376, 6, 3, false, "\xe2\xa4\x9e" },
+		  { 11382, 6, 3, false, "\xe2\x86\xaa" },
+		  { 11388, 6, 3, false, "\xe2\x86\xac" },
+		  { 11394, 6, 3, false, "\xe2\xa5\x85" },
+		  { 11400, 7, 3, false, "\xe2\xa5\xb4" },
+		  { 11407, 6, 3, false, "\xe2\x86\xa3" },
+		  { 11413, 5, 3, false, "\xe2\x86\x9d" },
+		  { 11418, 6, 3, false, "\xe2\xa4\x9a" },
+		  { 11424, 5, 3, false, "\xe2\x88\xb6" },
+		  { 11429, 9, 3, false, "\xe2\x84\x9a" },
+		  { 11438, 5, 3, false, "\xe2\xa4\x8d" },
+		  { 11443, 5, 3, false, "\xe2\x9d\xb3" },
+		  { 11448, 6, 1, false, "\x7d" },
+		  { 11454, 6, 1, false, "\x5d" },
+		  { 11460, 5, 3, false, "\xe2\xa6\x8c" },
+		  { 11465, 7, 3, false, "\xe2\xa6\x8e" },
+		  { 11472, 7, 3, false, "\xe2\xa6\x90" },
+		  { 11479, 6, 2, false, "\xc5\x99" },
+		  { 11485, 6, 2, false, "\xc5\x97" },
+		  { 11491, 5, 3, false, "\xe2\x8c\x89" },
+		  { 11496, 4, 1, false, "\x7d" },
+		  { 11500, 3, 2, false, "\xd1\x80" },
+		  { 11503, 4, 3, false, "\xe2\xa4\xb7" },
+		  { 11507, 7, 3, false, "\xe2\xa5\xa9" },
+		  { 11514, 5, 3, false, "\xe2\x80\x9d" },
+		  { 11519, 6, 3, false, "\xe2\x80\x9d" },
+		  { 11525, 4, 3, false, "\xe2\x86\xb3" },
+		  { 11529, 4, 3, false, "\xe2\x84\x9c" },
+		  { 11533, 7, 3, false, "\xe2\x84\x9b" },
+		  { 11540, 8, 3, false, "\xe2\x84\x9c" },
+		  { 11548, 5, 3, false, "\xe2\x84\x9d" },
+		  { 11553, 4, 3, false, "\xe2\x96\xad" },
+		  { 11557, 3, 2, true, "\xc2\xae" },
+		  { 11560, 6, 3, false, "\xe2\xa5\xbd" },
+		  { 11566, 6, 3, false, "\xe2\x8c\x8b" },
+		  { 11572, 3, 4, false, "\xf0\x9d\x94\xaf" },
+		  { 11575, 5, 3, false, "\xe2\x87\x81" },
+		  { 11580, 5, 3, false, "\xe2\x87\x80" },
+		  { 11585, 6, 3, false, "\xe2\xa5\xac" },
+		  { 11591, 3, 2, false, "\xcf\x81" },
+		  { 11594, 4, 2, false, "\xcf\xb1" },
+		  { 11598, 10, 3, false, "\xe2\x86\x92" },
+		  { 11608, 14, 3, false, "\xe2\x86\xa3" },
+		  { 11622, 16, 3, false, "\xe2\x87\x81" },
+		  { 11638, 14, 3, false, "\xe2\x87\x80" },
+		  { 11652, 15, 3, false, "\xe2\x87\x84" },
+		  { 11667, 17, 3, false, "\xe2\x87\x8c" },
+		  { 11684, 16, 3, false, "\xe2\x87\x89" },
+		  { 11700, 15, 3, false, "\xe2\x86\x9d" },
+		  { 11715, 15, 3, false, "\xe2\x8b\x8c" },
+		  { 11730, 4, 2, false, "\xcb\x9a" },
+		  { 11734, 12, 3, false, "\xe2\x89\x93" },
+		  { 11746, 5, 3, false, "\xe2\x87\x84" },
+		  { 11751, 5, 3, false, "\xe2\x87\x8c" },
+		  { 11756, 3, 3, false, "\xe2\x80\x8f" },
+		  { 11759, 6, 3, false, "\xe2\x8e\xb1" },
+		  { 11765, 10, 3, false, "\xe2\x8e\xb1" },
+		  { 11775, 5, 3, false, "\xe2\xab\xae" },
+		  { 11780, 5, 3, false, "\xe2\x9f\xad" },
+		  { 11785, 5, 3, false, "\xe2\x87\xbe" },
+		  { 11790, 5, 3, false, "\xe2\x9f\xa7" },
+		  { 11795, 5, 3, false, "\xe2\xa6\x86" },
+		  { 11800, 4, 4, false, "\xf0\x9d\x95\xa3" },
+		  { 11804, 6, 3, false, "\xe2\xa8\xae" },
+		  { 11810, 7, 3, false, "\xe2\xa8\xb5" },
+		  { 11817, 4, 1, false, "\x29" },
+		  { 11821, 6, 3, false, "\xe2\xa6\x94" },
+		  { 11827, 8, 3, false, "\xe2\xa8\x92" },
+		  { 11835, 5, 3, false, "\xe2\x87\x89" },
+		  { 11840, 6, 3, false, "\xe2\x80\xba" },
+		  { 11846, 4, 4, false, "\xf0\x9d\x93\x87" },
+		  { 11850, 3, 3, false, "\xe2\x86\xb1" },
+		  { 11853, 4, 1, false, "\x5d" },
+		  { 11857, 5, 3, false, "\xe2\x80\x99" },
+		  { 11862, 6, 3, false, "\xe2\x80\x99" },
+		  { 11868, 6, 3, false, "\xe2\x8b\x8c" },
+		  { 11874, 6, 3, false, "\xe2\x8b\x8a" },
+		  { 11880, 4, 3, false, "\xe2\x96\xb9" },
+		  { 11884, 5, 3, false, "\xe2\x8a\xb5" },
+		  { 11889, 5, 3, false, "\xe2\x96\xb8" },
+		  { 11894, 8, 3, false, "\xe2\xa7\x8e" },
+		  { 11902, 7, 3, false, "\xe2\xa5\xa8" },
+		  { 11909, 2, 3, false, "\xe2\x84\x9e" },
+		  { 11911, 6, 2, false, "\xc5\x9b" },
+		  { 11917, 5, 3, false, "\xe2\x80\x9a" },
+		  { 11922, 2, 3, false, "\xe2\x89\xbb" },
+		  { 11924, 3, 3, false, "\xe2\xaa\xb4" },
+		  { 11927, 4, 3, false, "\xe2\xaa\xb8" },
+		  { 11931, 6, 2, false, "\xc5\xa1" },
+		  { 11937, 5, 3, false, "\xe2\x89\xbd" },
+		  { 11942, 3, 3, false, "\xe2\xaa\xb0" },
+		  { 11945, 6, 2, false, "\xc5\x9f" },
+		  { 11951, 5, 2, false, "\xc5\x9d" },
+		  { 11956, 4, 3, false, "\xe2\xaa\xb6" },
+		  { 11960, 5, 3, false, "\xe2\xaa\xba" },
+		  { 11965, 6, 3, false, "\xe2\x8b\xa9" },
+		  { 11971, 8, 3, false, "\xe2\xa8\x93" },
+		  { 11979, 5, 3, false, "\xe2\x89\xbf" },
+		  { 11984, 3, 2, false, "\xd1\x81" },
+		  { 11987, 4, 3, false, "\xe2\x8b\x85" },
+		  { 11991, 5, 3, false, "\xe2\x8a\xa1" },
+		  { 11996, 5, 3, false, "\xe2\xa9\xa6" },
+		  { 12001, 5, 3, false, "\xe2\x87\x98" },
+		  { 12006, 6, 3, false, "\xe2\xa4\xa5" },
+		  { 12012, 5, 3, false, "\xe2\x86\x98" },
+		  { 12017, 7, 3, false, "\xe2\x86\x98" },
+		  { 12024, 4, 2, true, "\xc2\xa7" },
+		  { 12028, 4, 1, false, "\x3b" },
+		  { 12032, 6, 3, false, "\xe2\xa4\xa9" },
+		  { 12038, 8, 3, false, "\xe2\x88\x96" },
+		  { 12046, 5, 3, false, "\xe2\x88\x96" },
+		  { 12051, 4, 3, false, "\xe2\x9c\xb6" },
+		  { 12055, 3, 4, false, "\xf0\x9d\x94\xb0" },
+		  { 12058, 6, 3, false, "\xe2\x8c\xa2" },
+		  { 12064, 5, 3, false, "\xe2\x99\xaf" },
+		  { 12069, 6, 2, false, "\xd1\x89" },
+		  { 12075, 4, 2, false, "\xd1\x88" },
+		  { 12079, 8, 3, false, "\xe2\x88\xa3" },
+		  { 12087, 13, 3, false, "\xe2\x88\xa5" },
+		  { 12100, 3, 2, true, "\xc2\xad" },
+		  { 12103, 5, 2, false, "\xcf\x83" },
+		  { 12108, 6, 2, false, "\xcf\x82" },
+		  { 12114, 6, 2, false, "\xcf\x82" },
+		  { 12120, 3, 3, false, "\xe2\x88\xbc" },
+		  { 12123, 6, 3, false, "\xe2\xa9\xaa" },
+		  { 12129, 4, 3, false, "\xe2\x89\x83" },
+		  { 12133, 5, 3, false, "\xe2\x89\x83" },
+		  { 12138, 4, 3, false, "\xe2\xaa\x9e" },
+		  { 12142, 5, 3, false, "\xe2\xaa\xa0" },
+		  { 12147, 4, 3, false, "\xe2\xaa\x9d" },
+		  { 12151, 5, 3, false, "\xe2\xaa\x9f" },
+		  { 12156, 5, 3, false, "\xe2\x89\x86" },
+		  { 12161, 7, 3, false, "\xe2\xa8\xa4" },
+		  { 12168, 7, 3, false, "\xe2\xa5\xb2" },
+		  { 12175, 5, 3, false, "\xe2\x86\x90" },
+		  { 12180, 13, 3, false, "\xe2\x88\x96" },
+		  { 12193, 6, 3, false, "\xe2\xa8\xb3" },
+		  { 12199, 8, 3, false, "\xe2\xa7\xa4" },
+		  { 12207, 4, 3, false, "\xe2\x88\xa3" },
+		  { 12211, 5, 3, false, "\xe2\x8c\xa3" },
+		  { 12216, 3, 3, false, "\xe2\xaa\xaa" },
+		  { 12219, 4, 3, false, "\xe2\xaa\xac" },
+		  { 12223, 5, 6, false, "\xe2\xaa\xac\xef\xb8\x80" },
+		  { 12228, 6, 2, false, "\xd1\x8c" },
+		  { 12234, 3, 1, false, "\x2f" },
+		  { 12237, 4, 3, false, "\xe2\xa7\x84" },
+		  { 12241, 6, 3, false, "\xe2\x8c\xbf" },
+		  { 12247, 4, 4, false, "\xf0\x9d\x95\xa4" },
+		  { 12251, 6, 3, false, "\xe2\x99\xa0" },
+		  { 12257, 9, 3, false, "\xe2\x99\xa0" },
+		  { 12266, 4, 3, false, "\xe2\x88\xa5" },
+		  { 12270, 5, 3, false, "\xe2\x8a\x93" },
+		  { 12275, 6, 6, false, "\xe2\x8a\x93\xef\xb8\x80" },
+		  { 12281, 5, 3, false, "\xe2\x8a\x94" },
+		  { 12286, 6, 6, false, "\xe2\x8a\x94\xef\xb8\x80" },
+		  { 12292, 5, 3, false, "\xe2\x8a\x8f" },
+		  { 12297, 6, 3, false, "\xe2\x8a\x91" },
+		  { 12303, 8, 3, false, "\xe2\x8a\x8f" },
+		  { 12311, 10, 3, false, "\xe2\x8a\x91" },
+		  { 12321, 5, 3, false, "\xe2\x8a\x90" },
+		  { 12326, 6, 3, false, "\xe2\x8a\x92" },
+		  { 12332, 8, 3, false, "\xe2\x8a\x90" },
+		  { 12340, 10, 3, false, "\xe2\x8a\x92" },
+		  { 12350, 3, 3, false, "\xe2\x96\xa1" },
+		  { 12353, 6, 3, false, "\xe2\x96\xa1" },
+		  { 12359, 6, 3, false, "\xe2\x96\xaa" },
+		  { 12365, 4, 3, false, "\xe2\x96\xaa" },
+		  { 12369, 5, 3, false, "\xe2\x86\x92" },
+		  { 12374, 4, 4, false, "\xf0\x9d\x93\x88" },
+		  { 12378, 6, 3, false, "\xe2\x88\x96" },
+		  { 12384, 6, 3, false, "\xe2\x8c\xa3" },
+		  { 12390, 6, 3, false, "\xe2\x8b\x86" },
+		  { 12396, 4, 3, false, "\xe2\x98\x86" },
+		  { 12400, 5, 3, false, "\xe2\x98\x85" },
+		  { 12405, 15, 2, false, "\xcf\xb5" },
+		  { 12420, 11, 2, false, "\xcf\x95" },
+		  { 12431, 5, 2, false, "\xc2\xaf" },
+		  { 12436, 3, 3, false, "\xe2\x8a\x82" },
+		  { 12439, 4, 3, false, "\xe2\xab\x85" },
+		  { 12443, 6, 3, false, "\xe2\xaa\xbd" },
+		  { 12449, 4, 3, false, "\xe2\x8a\x86" },
+		  { 12453, 7, 3, false, "\xe2\xab\x83" },
+		  { 12460, 7, 3, false, "\xe2\xab\x81" },
+		  { 12467, 5, 3, false, "\xe2\xab\x8b" },
+		  { 12472, 5, 3, false, "\xe2\x8a\x8a" },
+		  { 12477, 7, 3, false, "\xe2\xaa\xbf" },
+		  { 12484, 7, 3, false, "\xe2\xa5\xb9" },
+		  { 12491, 6, 3, false, "\xe2\x8a\x82" },
+		  { 12497, 8, 3, false, "\xe2\x8a\x86" },
+		  { 12505, 9, 3, false, "\xe2\xab\x85" },
+		  { 12514, 9, 3, false, "\xe2\x8a\x8a" },
+		  { 12523, 10, 3, false, "\xe2\xab\x8b" },
+		  { 12533, 6, 3, false, "\xe2\xab\x87" },
+		  { 12539, 6, 3, false, "\xe2\xab\x95" },
+		  { 12545, 6, 3, false, "\xe2\xab\x93" },
+		  { 12551, 4, 3, false, "\xe2\x89\xbb" },
+		  { 12555, 10, 3, false, "\xe2\xaa\xb8" },
+		  { 12565, 11, 3, false, "\xe2\x89\xbd" },
+		  { 12576, 6, 3, false, "\xe2\xaa\xb0" },
+		  { 12582, 11, 3, false, "\xe2\xaa\xba" },
+		  { 12593, 8, 3, false, "\xe2\xaa\xb6" },
+		  { 12601, 8, 3, false, "\xe2\x8b\xa9" },
+		  { 12609, 7, 3, false, "\xe2\x89\xbf" },
+		  { 12616, 3, 3, false, "\xe2\x88\x91" },
+		  { 12619, 4, 3, false, "\xe2\x99\xaa" },
+		  { 12623, 3, 3, false, "\xe2\x8a\x83" },
+		  { 12626, 4, 2, true, "\xc2\xb9" },
+		  { 12630, 4, 2, true, "\xc2\xb2" },
+		  { 12634, 4, 2, true, "\xc2\xb3" },
+		  { 12638, 4, 3, false, "\xe2\xab\x86" },
+		  { 12642, 6, 3, false, "\xe2\xaa\xbe" },
+		  { 12648, 7, 3, false, "\xe2\xab\x98" },
+		  { 12655, 4, 3, false, "\xe2\x8a\x87" },
+		  { 12659, 7, 3, false, "\xe2\xab\x84" },
+		  { 12666, 7, 3, false, "\xe2\x9f\x89" },
+		  { 12673, 7, 3, false, "\xe2\xab\x97" },
+		  { 12680, 7, 3, false, "\xe2\xa5\xbb" },
+		  { 12687, 7, 3, false, "\xe2\xab\x82" },
+		  { 12694, 5, 3, false, "\xe2\xab\x8c" },
+		  { 12699, 5, 3, false, "\xe2\x8a\x8b" },
+		  { 12704, 7, 3, false, "\xe2\xab\x80" },
+		  { 12711, 6, 3, false, "\xe2\x8a\x83" },
+		  { 12717, 8, 3, false, "\xe2\x8a\x87" },
+		  { 12725, 9, 3, false, "\xe2\xab\x86" },
+		  { 12734, 9, 3, false, "\xe2\x8a\x8b" },
+		  { 12743, 10, 3, false, "\xe2\xab\x8c" },
+		  { 12753, 6, 3, false, "\xe2\xab\x88" },
+		  { 12759, 6, 3, false, "\xe2\xab\x94" },
+		  { 12765, 6, 3, false, "\xe2\xab\x96" },
+		  { 12771, 5, 3, false, "\xe2\x87\x99" },
+		  { 12776, 6, 3, false, "\xe2\xa4\xa6" },
+		  { 12782, 5, 3, false, "\xe2\x86\x99" },
+		  { 12787, 7, 3, false, "\xe2\x86\x99" },
+		  { 12794, 6, 3, false, "\xe2\xa4\xaa" },
+		  { 12800, 5, 2, true, "\xc3\x9f" },
+		  { 12805, 6, 3, false, "\xe2\x8c\x96" },
+		  { 12811, 3, 2, false, "\xcf\x84" },
+		  { 12814, 4, 3, false, "\xe2\x8e\xb4" },
+		  { 12818, 6, 2, false, "\xc5\xa5" },
+		  { 12824, 6, 2, false, "\xc5\xa3" },
+		  { 12830, 3, 2, false, "\xd1\x82" },
+		  { 12833, 4, 3, false, "\xe2\x83\x9b" },
+		  { 12837, 6, 3, false, "\xe2\x8c\x95" },
+		  { 12843, 3, 4, false, "\xf0\x9d\x94\xb1" },
+		  { 12846, 6, 3, false, "\xe2\x88\xb4" },
+		  { 12852, 9, 3, false, "\xe2\x88\xb4" },
+		  { 12861, 5, 2, false, "\xce\xb8" },
+		  { 12866, 8, 2, false, "\xcf\x91" },
+		  { 12874, 6, 2, false, "\xcf\x91" },
+		  { 12880, 11, 3, false, "\xe2\x89\x88" },
+		  { 12891, 8, 3, false, "\xe2\x88\xbc" },
+		  { 12899, 6, 3, false, "\xe2\x80\x89" },
+		  { 12905, 5, 3, false, "\xe2\x89\x88" },
+		  { 12910, 6, 3, false, "\xe2\x88\xbc" },
+		  { 12916, 5, 2, true, "\xc3\xbe" },
+		  { 12921, 5, 2, false, "\xcb\x9c" },
+		  { 12926, 5, 2, true, "\xc3\x97" },
+		  { 12931, 6, 3, false, "\xe2\x8a\xa0" },
+		  { 12937, 8, 3, false, "\xe2\xa8\xb1" },
+		  { 12945, 6, 3, false, "\xe2\xa8\xb0" },
+		  { 12951, 4, 3, false, "\xe2\x88\xad" },
+		  { 12955, 4, 3, false, "\xe2\xa4\xa8" },
+		  { 12959, 3, 3, false, "\xe2\x8a\xa4" },
+		  { 12962, 6, 3, false, "\xe2\x8c\xb6" },
+		  { 12968, 6, 3, false, "\xe2\xab\xb1" },
+		  { 12974, 4, 4, false, "\xf0\x9d\x95\xa5" },
+		  { 12978, 7, 3, false, "\xe2\xab\x9a" },
+		  { 12985, 4, 3, false, "\xe2\xa4\xa9" },
+		  { 12989, 6, 3, false, "\xe2\x80\xb4" },
+		  { 12995, 5, 3, false, "\xe2\x84\xa2" },
+		  { 13000, 8, 3, false, "\xe2\x96\xb5" },
+		  { 13008, 12, 3, false, "\xe2\x96\xbf" },
+		  { 13020, 12, 3, false, "\xe2\x97\x83" },
+		  { 13032, 14, 3, false, "\xe2\x8a\xb4" },
+		  { 13046, 9, 3, false, "\xe2\x89\x9c" },
+		  { 13055, 13, 3, false, "\xe2\x96\xb9" },
+		  { 13068, 15, 3, false, "\xe2\x8a\xb5" },
+		  { 13083, 6, 3, false, "\xe2\x97\xac" },
+		  { 13089, 4, 3, false, "\xe2\x89\x9c" },
+		  { 13093, 8, 3, false, "\xe2\xa8\xba" },
+		  { 13101, 7, 3, false, "\xe2\xa8\xb9" },
+		  { 13108, 5, 3, false, "\xe2\xa7\x8d" },
+		  { 13113, 7, 3, false, "\xe2\xa8\xbb" },
+		  { 13120, 8, 3, false, "\xe2\x8f\xa2" },
+		  { 13128, 4, 4, false, "\xf0\x9d\x93\x89" },
+		  { 13132, 4, 2, false, "\xd1\x86" },
+		  { 13136, 5, 2, false, "\xd1\x9b" },
+		  { 13141, 6, 2, false, "\xc5\xa7" },
+		  { 13147, 5, 3, false, "\xe2\x89\xac" },
+		  { 13152, 16, 3, false, "\xe2\x86\x9e" },
+		  { 13168, 17, 3, false, "\xe2\x86\xa0" },
+		  { 13185, 4, 3, false, "\xe2\x87\x91" },
+		  { 13189, 4, 3, false, "\xe2\xa5\xa3" },
+		  { 13193, 6, 2, true, "\xc3\xba" },
+		  { 13199, 4, 3, false, "\xe2\x86\x91" },
+		  { 13203, 5, 2, false, "\xd1\x9e" },
+		  { 13208, 6, 2, false, "\xc5\xad" },
+		  { 13214, 5, 2, true, "\xc3\xbb" },
+		  { 13219, 3, 2, false, "\xd1\x83" },
+		  { 13222, 5, 3, false, "\xe2\x87\x85" },
+		  { 13227, 6, 2, false, "\xc5\xb1" },
+		  { 13233, 5, 3, false, "\xe2\xa5\xae" },
+		  { 13238, 6, 3, false, "\xe2\xa5\xbe" },
+		  { 13244, 3, 4, false, "\xf0\x9d\x94\xb2" },
+		  { 13247, 6, 2, true, "\xc3\xb9" },
+		  { 13253, 5, 3, false, "\xe2\x86\xbf" },
+		  { 13258, 5, 3, false, "\xe2\x86\xbe" },
+		  { 13263, 5, 3, false, "\xe2\x96\x80" },
+		  { 13268, 6, 3, false, "\xe2\x8c\x9c" },
+		  { 13274, 8, 3, false, "\xe2\x8c\x9c" },
+		  { 13282, 6, 3, false, "\xe2\x8c\x8f" },
+		  { 13288, 5, 3, false, "\xe2\x97\xb8" },
+		  { 13293, 5, 2, false, "\xc5\xab" },
+		  { 13298, 3, 2, true, "\xc2\xa8" },
+		  { 13301, 5, 2, false, "\xc5\xb3" },
+		  { 13306, 4, 4, false, "\xf0\x9d\x95\xa6" },
+		  { 13310, 7, 3, false, "\xe2\x86\x91" },
+		  { 13317, 11, 3, false, "\xe2\x86\x95" },
+		  { 13328, 13, 3, false, "\xe2\x86\xbf" },
+		  { 13341, 14, 3, false, "\xe2\x86\xbe" },
+		  { 13355, 5, 3, false, "\xe2\x8a\x8e" },
+		  { 13360, 4, 2, false, "\xcf\x85" },
+		  { 13364, 5, 2, false, "\xcf\x92" },
+		  { 13369, 7, 2, false, "\xcf\x85" },
+		  { 13376, 10, 3, false, "\xe2\x87\x88" },
+		  { 13386, 6, 3, false, "\xe2\x8c\x9d" },
+		  { 13392, 8, 3, false, "\xe2\x8c\x9d" },
+		  { 13400, 6, 3, false, "\xe2\x8c\x8e" },
+		  { 13406, 5, 2, false, "\xc5\xaf" },
+		  { 13411, 5, 3, false, "\xe2\x97\xb9" },
+		  { 13416, 4, 4, false, "\xf0\x9d\x93\x8a" },
+		  { 13420, 5, 3, false, "\xe2\x8b\xb0" },
+		  { 13425, 6, 2, false, "\xc5\xa9" },
+		  { 13431, 4, 3, false, "\xe2\x96\xb5" },
+		  { 13435, 5, 3, false, "\xe2\x96\xb4" },
+		  { 13440, 5, 3, false, "\xe2\x87\x88" },
+		  { 13445, 4, 2, true, "\xc3\xbc" },
+		  { 13449, 7, 3, false, "\xe2\xa6\xa7" },
+		  { 13456, 4, 3, false, "\xe2\x87\x95" },
+		  { 13460, 4, 3, false, "\xe2\xab\xa8" },
+		  { 13464, 5, 3, false, "\xe2\xab\xa9" },
+		  { 13469, 5, 3, false, "\xe2\x8a\xa8" },
+		  { 13474, 6, 3, false, "\xe2\xa6\x9c" },
+		  { 13480, 10, 2, false, "\xcf\xb5" },
+		  { 13490, 8, 2, false, "\xcf\xb0" },
+		  { 13498, 10, 3, false, "\xe2\x88\x85" },
+		  { 13508, 6, 2, false, "\xcf\x95" },
+		  { 13514, 5, 2, false, "\xcf\x96" },
+		  { 13519, 9, 3, false, "\xe2\x88\x9d" },
+		  { 13528, 4, 3, false, "\xe2\x86\x95" },
+		  { 13532, 6, 2, false, "\xcf\xb1" },
+		  { 13538, 8, 2, false, "\xcf\x82" },
+		  { 13546, 12, 6, false, "\xe2\x8a\x8a\xef\xb8\x80" },
+		  { 13558, 13, 6, false, "\xe2\xab\x8b\xef\xb8\x80" },
+		  { 13571, 12, 6, false, "\xe2\x8a\x8b\xef\xb8\x80" },
+		  { 13583, 13, 6, false, "\xe2\xab\x8c\xef\xb8\x80" },
+		  { 13596, 8, 2, false, "\xcf\x91" },
+		  { 13604, 15, 3, false, "\xe2\x8a\xb2" },
+		  { 13619, 16, 3, false, "\xe2\x8a\xb3" },
+		  { 13635, 3, 2, false, "\xd0\xb2" },
+		  { 13638, 5, 3, false, "\xe2\x8a\xa2" },
+		  { 13643, 3, 3, false, "\xe2\x88\xa8" },
+		  { 13646, 6, 3, false, "\xe2\x8a\xbb" },
+		  { 13652, 5, 3, false, "\xe2\x89\x9a" },
+		  { 13657, 6, 3, false, "\xe2\x8b\xae" },
+		  { 13663, 6, 1, false, "\x7c" },
+		  { 13669, 4, 1, false, "\x7c" },
+		  { 13673, 3, 4, false, "\xf0\x9d\x94\xb3" },
+		  { 13676, 5, 3, false, "\xe2\x8a\xb2" },
+		  { 13681, 5, 6, false, "\xe2\x8a\x82\xe2\x83\x92" },
+		  { 13686, 5, 6, false, "\xe2\x8a\x83\xe2\x83\x92" },
+		  { 13691, 4, 4, false, "\xf0\x9d\x95\xa7" },
+		  { 13695, 5, 3, false, "\xe2\x88\x9d" },
+		  { 13700, 5, 3, false, "\xe2\x8a\xb3" },
+		  { 13705, 4, 4, false, "\xf0\x9d\x93\x8b" },
+		  { 13709, 6, 6, false, "\xe2\xab\x8b\xef\xb8\x80" },
+		  { 13715, 6, 6, false, "\xe2\x8a\x8a\xef\xb8\x80" },
+		  { 13721, 6, 6, false, "\xe2\xab\x8c\xef\xb8\x80" },
+		  { 13727, 6, 6, false, "\xe2\x8a\x8b\xef\xb8\x80" },
+		  { 13733, 7, 3, false, "\xe2\xa6\x9a" },
+		  { 13740, 5, 2, false, "\xc5\xb5" },
+		  { 13745, 6, 3, false, "\xe2\xa9\x9f" },
+		  { 13751, 5, 3, false, "\xe2\x88\xa7" },
+		  { 13756, 6, 3, false, "\xe2\x89\x99" },
+		  { 13762, 6, 3, false, "\xe2\x84\x98" },
+		  { 13768, 3, 4, false, "\xf0\x9d\x94\xb4" },
+		  { 13771, 4, 4, false, "\xf0\x9d\x95\xa8" },
+		  { 13775, 2, 3, false, "\xe2\x84\x98" },
+		  { 13777, 2, 3, false, "\xe2\x89\x80" },
+		  { 13779, 6, 3, false, "\xe2\x89\x80" },
+		  { 13785, 4, 4, false, "\xf0\x9d\x93\x8c" },
+		  { 13789, 4, 3, false, "\xe2\x8b\x82" },
+		  { 13793, 5, 3, false, "\xe2\x97\xaf" },
+		  { 13798, 4, 3, false, "\xe2\x8b\x83" },
+		  { 13802, 5, 3, false, "\xe2\x96\xbd" },
+		  { 13807, 3, 4, false, "\xf0\x9d\x94\xb5" },
+		  { 13810, 5, 3, false, "\xe2\x9f\xba" },
+		  { 13815, 5, 3, false, "\xe2\x9f\xb7" },
+		  { 13820, 2, 2, false, "\xce\xbe" },
+		  { 13822, 5, 3, false, "\xe2\x9f\xb8" },
+		  { 13827, 5, 3, false, "\xe2\x9f\xb5" },
+		  { 13832, 4, 3, false, "\xe2\x9f\xbc" },
+		  { 13836, 4, 3, false, "\xe2\x8b\xbb" },
+		  { 13840, 5, 3, false, "\xe2\xa8\x80" },
+		  { 13845, 4, 4, false, "\xf0\x9d\x95\xa9" },
+		  { 13849, 6, 3, false, "\xe2\xa8\x81" },
+		  { 13855, 6, 3, false, "\xe2\xa8\x82" },
+		  { 13861, 5, 3, false, "\xe2\x9f\xb9" },
+		  { 13866, 5, 3, false, "\xe2\x9f\xb6" },
+		  { 13871, 4, 4, false, "\xf0\x9d\x93\x8d" },
+		  { 13875, 6, 3, false, "\xe2\xa8\x86" },
+		  { 13881, 6, 3, false, "\xe2\xa8\x84" },
+		  { 13887, 5, 3, false, "\xe2\x96\xb3" },
+		  { 13892, 4, 3, false, "\xe2\x8b\x81" },
+		  { 13896, 6, 3, false, "\xe2\x8b\x80" },
+		  { 13902, 6, 2, true, "\xc3\xbd" },
+		  { 13908, 4, 2, false, "\xd1\x8f" },
+		  { 13912, 5, 2, false, "\xc5\xb7" },
+		  { 13917, 3, 2, false, "\xd1\x8b" },
+		  { 13920, 3, 2, true, "\xc2\xa5" },
+		  { 13923, 3, 4, false, "\xf0\x9d\x94\xb6" },
+		  { 13926, 4, 2, false, "\xd1\x97" },
+		  { 13930, 4, 4, false, "\xf0\x9d\x95\xaa" },
+		  { 13934, 4, 4, false, "\xf0\x9d\x93\x8e" },
+		  { 13938, 4, 2, false, "\xd1\x8e" },
+		  { 13942, 4, 2, true, "\xc3\xbf" },
+		  { 13946, 6, 2, false, "\xc5\xba" },
+		  { 13952, 6, 2, false, "\xc5\xbe" },
+		  { 13958, 3, 2, false, "\xd0\xb7" },
+		  { 13961, 4, 2, false, "\xc5\xbc" },
+		  { 13965, 6, 3, false, "\xe2\x84\xa8" },
+		  { 13971, 4, 2, false, "\xce\xb6" },
+		  { 13975, 3, 4, false, "\xf0\x9d\x94\xb7" },
+		  { 13978, 4, 2, false, "\xd0\xb6" },
+		  { 13982, 7, 3, false, "\xe2\x87\x9d" },
+		  { 13989, 4, 4, false, "\xf0\x9d\x95\xab" },
+		  { 13993, 4, 4, false, "\xf0\x9d\x93\x8f" },
+		  { 13997, 3, 3, false, "\xe2\x80\x8d" },
+		  { 14000, 4, 3, false, "\xe2\x80\x8c" },
+		};
+
+		constexpr std::size_t entity_count = 2125;
+		constexpr std::size_t bucket_count = 1024;
+		constexpr std::size_t slot_count = 4096;
+		constexpr std::uint16_t no_entity = 0xFFFF;
+
+		constexpr std::uint16_t displacements[] = {
+		  2, 1, 3, 1, 1, 1, 2, 1, 1, 2, 1, 4, 1, 1, 0, 2, 3, 1, 1, 2, 4, 1, 2,
+		  1, 2, 5, 0, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 2, 2, 3, 1, 1, 1, 2, 2, 2,
+		  1, 1, 1, 3, 3, 2, 1, 1, 20, 2, 1, 1, 1, 3, 1, 4, 1, 2, 2, 2, 0, 1, 1,
+		  2, 6, 1, 6, 1, 2, 2, 1, 2, 0, 7, 1, 2, 0, 4, 1, 1, 1, 1, 1, 1, 0, 2,
+		  1, 5, 1, 1, 4, 1, 0, 2, 1, 1, 1, 1, 1, 2, 1, 1, 3, 2, 0, 2, 1, 0, 4,
+		  3, 0, 1, 0, 1, 1, 1, 0, 1, 2, 1, 1, 5, 1, 6, 2, 1, 1, 1, 1, 3, 1, 3,
+		  1, 1, 1, 1, 1, 2, 11, 1, 1, 1, 4, 1, 2, 2, 6, 0, 1, 1, 2, 1, 4, 1, 2,
+		  1, 1, 1, 3, 9, 2, 1, 4, 1, 2, 1, 6, 3, 1, 0, 5, 3, 2, 4, 0, 3, 1, 1,
+		  2, 3, 1, 13, 1, 1, 1, 1, 1, 3, 1, 64, 1, 1, 0, 1, 1, 0, 2, 3, 1, 0,
+		  10, 3, 1, 1, 2, 2, 0, 3, 1, 1, 0, 1, 0, 2, 2, 2, 1, 1, 1, 1, 4, 1, 5,
+		  6, 1, 1, 3, 0, 4, 1, 4, 1, 66, 2, 2, 2, 1, 1, 1, 3, 0, 2, 2, 2, 2, 15,
+		  5, 1, 0, 1, 4, 4, 2, 1, 4, 1, 1, 1, 6, 1, 2, 2, 2, 3, 9, 4, 1, 64, 2,
+		  1, 64, 3, 1, 1, 0, 22, 4, 0, 1, 4, 3, 8, 1, 2, 1, 1, 0, 2, 1, 3, 2, 2,
+		  3, 1, 3, 5, 0, 4, 1, 2, 1, 3, 0, 1, 1, 1, 2, 1, 1, 1, 1, 14, 0, 3, 0,
+		  1, 5, 2, 1, 1, 1, 1, 1, 30, 1, 1, 19, 1, 1, 27, 1, 1, 2, 1, 1, 2, 4,
+		  3, 65, 5, 1, 3, 2, 40, 1, 1, 3, 1, 2, 0, 0, 3, 0, 0, 3, 64, 0, 1, 3,
+		  1, 1, 1, 2, 2, 0, 6, 3, 2, 4, 2, 3, 1, 2, 0, 12, 1, 0, 0, 5, 4, 2, 17,
+		  1, 1, 1, 1, 3, 3, 1, 1, 0, 1, 1, 1, 24, 1, 5, 5, 1, 2, 2, 1, 1, 66, 6,
+		  3, 0, 0, 1, 0, 0, 1, 2, 1, 0, 4, 1, 2, 64, 1, 1, 2, 1, 3, 1, 2, 1, 2,
+		  0, 1, 6, 5, 2, 1, 1, 3, 65, 1, 1, 2, 1, 7, 2, 2, 1, 0, 1, 1, 0, 7, 1,
+		  1, 21, 1, 1, 0, 1, 1, 1, 13, 1, 30, 1, 0, 0, 1, 2, 2, 1, 0, 3, 1, 1,
+		  2, 0, 0, 1, 2, 7, 3, 3, 1, 2, 1, 4, 1, 3, 0, 0, 1, 1, 1, 0, 1, 1, 1,
+		  1, 3, 14, 7, 1, 0, 0, 0, 5, 2, 3, 0, 2, 4, 5, 3, 1, 1, 12, 1, 2, 6, 1,
+		  2, 4, 1, 1, 0, 3, 4, 1, 1, 2, 1, 15, 1, 1, 1, 2, 0, 0, 1, 7, 19, 1, 2,
+		  3, 8, 1, 7, 18, 1, 1, 1, 0, 3, 3, 1, 0, 2, 6, 2, 6, 1, 5, 1, 1, 1, 1,
+		  1, 1, 3, 0, 2, 68, 2, 1, 2, 1, 1, 1, 0, 2, 2, 0, 1, 21, 0, 2, 1, 1, 1,
+		  2, 9, 0, 0, 1, 2, 1, 1, 4, 3, 7, 0, 2, 1, 3, 6, 3, 4, 6, 1, 2, 2, 1,
+		  2, 2, 1, 3, 71, 0, 0, 1, 0, 2, 1, 4, 5, 5, 1, 3, 2, 1, 0, 2, 0, 22,
+		  13, 1, 1, 2, 26, 17, 1, 1, 3, 3, 2, 0, 13, 3, 1, 0, 1, 1, 2, 2, 2, 1,
+		  10, 65, 1, 2, 4, 1, 1, 1, 0, 2, 2, 2, 0, 1, 2, 3, 62, 9, 4, 1, 1, 1,
+		  2, 3, 0, 2, 1, 2, 2, 1, 1, 1, 1, 1, 5, 3, 20, 7, 1, 0, 0, 2, 2, 3, 1,
+		  1, 1, 1, 0, 2, 1, 1, 1, 2, 0, 6, 42, 3, 1, 8, 2, 1, 0, 9, 1, 1, 1, 2,
+		  0, 1, 1, 3, 0, 4, 15, 0, 5, 2, 8, 0, 0, 6, 1, 1, 64, 1, 4, 6, 2, 1, 3,
+		  65, 2, 64, 1, 7, 1, 4, 1, 1, 5, 13, 2, 1, 0, 1, 0, 1, 0, 1, 4, 4, 0,
+		  1, 5, 1, 5, 1, 9, 12, 2, 6, 2, 65, 1, 2, 1, 15, 1, 1, 2, 7, 5, 18, 1,
+		  1, 1, 68, 3, 5, 0, 1, 1, 1, 20, 1, 3, 4, 1, 1, 11, 1, 2, 1, 2, 1, 1,
+		  3, 1, 4, 0, 1, 65, 0, 4, 22, 3, 3, 68, 2, 2, 6, 12, 1, 1, 9, 1, 7, 3,
+		  1, 20, 4, 4, 10, 64, 9, 1, 1, 0, 0, 4, 2, 2, 0, 7, 1, 1, 7, 3, 5, 1,
+		  2, 2, 2, 0, 4, 70, 0, 0, 2, 1, 14, 8, 2, 1, 2, 4, 2, 1, 2, 1, 3, 1, 2,
+		  2, 27, 1, 1, 1, 3, 1, 6, 2, 35, 2, 0, 0, 3, 1, 0, 2, 1, 2, 1, 1, 1,
+		  64, 1, 1, 64, 2, 2, 1, 3, 0, 4, 8, 10, 0, 5, 65, 2, 0, 15, 20, 2, 1,
+		  7, 9, 2, 4, 1, 7, 5, 16, 6, 4, 18, 1, 2, 1, 11, 1, 1, 3, 2, 1, 2, 2,
+		  21, 1, 2, 0, 9, 1, 1, 1, 1, 0, 2, 0, 1, 1, 0, 0, 2, 65, 1, 1, 1, 0, 5,
+		  4, 1, 0, 4, 2, 1, 4, 3, 0, 5, 1, 3, 3, 3, 21, 7, 9, 4, 3, 0, 2, 29,
+		  42, 15, 3, 1, 2, 1, 2, 1, 1, 1, 12, 3, 3, 0, 1, 1, 64, 1, 4, 3, 0, 2,
+		  0, 1, 1, 6, 0, 1, 2, };
+
+		constexpr std::uint16_t slots[] = {
+		  no_entity, 1568, 1297, 536, no_entity, no_entity, no_entity, 2023,
+		  no_entity, 1290, no_entity, 1378, no_entity, 135, no_entity, 1011,
+		  1063, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, 1599, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, 1736, no_entity, no_entity, no_entity, 1939,
+		  no_entity, 2000, 682, no_entity, no_entity, 809, 58, no_entity, 828,
+		  no_entity, 225, no_entity, 936, 23, no_entity, 76, 867, 1844, 29, 950,
+		  1230, 2092, 738, 421, no_entity, no_entity, 1966, no_entity,
+		  no_entity, 639, no_entity, no_entity, no_entity, no_entity, 1295,
+		  no_entity, 1784, 1680, no_entity, no_entity, no_entity, 863, 1741,
+		  542, 1641, 350, no_entity, no_entity, no_entity, 1502, no_entity,
+		  no_entity, 667, no_entity, 1319, no_entity, 554, 1713, 364, 1770,
+		  no_entity, no_entity, 1224, 187, 1520, no_entity, 579, no_entity, 771,
+		  308, 1201, no_entity, no_entity, no_entity, no_entity, 1789, 1238,
+		  no_entity, no_entity, 689, no_entity, no_entity, 1095, 1035, 905,
+		  no_entity, 368, 1992, 779, 833, 491, 1817, no_entity, no_entity,
+		  no_entity, no_entity, 316, 160, 608, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 1569, no_entity, no_entity, 1220,
+		  1262, no_entity, no_entity, 1776, 871, no_entity, no_entity, 986,
+		  no_entity, 1205, 902, 272, 405, 1989, no_entity, no_entity, no_entity,
+		  99, no_entity, 1188, no_entity, no_entity, 1708, no_entity, no_entity,
+		  no_entity, no_entity, 549, 1546, no_entity, 1348, 232, 1025, 1906,
+		  no_entity, no_entity, no_entity, 835, no_entity, 1157, no_entity,
+		  no_entity, no_entity, no_entity, 457, no_entity, no_entity, 1396, 877,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, 1921,
+		  no_entity, 1233, no_entity, 1525, no_entity, 484, no_entity, 1260,
+		  399, 824, no_entity, 699, 801, no_entity, 92, no_entity, 1467,
+		  no_entity, 1575, no_entity, no_entity, 274, no_entity, no_entity, 127,
+		  1884, 1096, 1987, no_entity, no_entity, 1970, no_entity, 564,
+		  no_entity, 11, 497, no_entity, 1140, 1265, no_entity, 458, 1937,
+		  no_entity, no_entity, 1028, no_entity, no_entity, no_entity, 955,
+		  1963, 1373, no_entity, no_entity, 178, 1953, no_entity, 1604,
+		  no_entity, 1683, no_entity, 320, 172, 2101, no_entity, no_entity, 81,
+		  710, no_entity, no_entity, 928, no_entity, no_entity, 2081, 304, 1375,
+		  no_entity, 976, 217, no_entity, 677, 131, no_entity, 234, 2087, 522,
+		  no_entity, 1452, no_entity, 1218, no_entity, 1406, 661, 170, 823,
+		  1393, no_entity, 2084, no_entity, no_entity, no_entity, 2063, 1949,
+		  no_entity, no_entity, no_entity, 1128, 861, 672, no_entity, 142, 754,
+		  1514, no_entity, no_entity, no_entity, no_entity, 1700, 618,
+		  no_entity, 1627, 314, no_entity, 746, 1617, no_entity, no_entity,
+		  no_entity, 1585, 366, no_entity, no_entity, no_entity, no_entity,
+		  1873, no_entity, no_entity, 455, 2123, 171, no_entity, no_entity,
+		  no_entity, 2071, no_entity, 1472, 1711, 996, no_entity, 1185, 1145,
+		  no_entity, 662, 934, 1974, 506, 766, no_entity, 1038, 1848, no_entity,
+		  no_entity, no_entity, 273, 875, no_entity, no_entity, no_entity,
+		  no_entity, 1109, 1008, no_entity, no_entity, no_entity, 1667,
+		  no_entity, 1198, 1309, 2105, no_entity, no_entity, 916, no_entity,
+		  1256, no_entity, 723, 1051, 1434, 185, no_entity, 1879, no_entity,
+		  545, no_entity, no_entity, 181, 1207, 2036, no_entity, 874, 1496, 641,
+		  no_entity, 52, no_entity, 241, 2099, no_entity, 1327, 1311, 531,
+		  no_entity, no_entity, no_entity, 1510, 1632, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 808, no_entity, 1666, no_entity,
+		  1454, 277, no_entity, 446, 1089, 392, no_entity, 2057, 708, 1307,
+		  1640, 1788, 513, 962, no_entity, 66, no_entity, no_entity, no_entity,
+		  1100, 1983, 129, 1693, no_entity, 742, no_entity, 1712, 1556,
+		  no_entity, no_entity, 1503, no_entity, 1079, 1099, no_entity,
+		  no_entity, 1186, no_entity, no_entity, 1346, 434, no_entity, 1793,
+		  no_entity, 1404, 1500, 309, no_entity, no_entity, no_entity, 612,
+		  no_entity, 669, no_entity, no_entity, no_entity, 1108, no_entity,
+		  1930, 376, no_entity, 150, no_entity, 668, no_entity, no_entity,
+		  no_entity, no_entity, 939, no_entity, 632, 2051, 1945, 1891,
+		  no_entity, 279, no_entity, 1476, 423, no_entity, no_entity, 1687,
+		  no_entity, no_entity, 1356, no_entity, no_entity, 1578, no_entity, 46,
+		  1691, no_entity, 1747, no_entity, no_entity, 589, 334, 467, 1480,
+		  no_entity, no_entity, 907, no_entity, 926, no_entity, no_entity,
+		  no_entity, 615, 477, no_entity, 1249, 134, 1704, 1326, 1240, 1418,
+		  1718, no_entity, no_entity, no_entity, no_entity, no_entity, 56, 541,
+		  no_entity, 335, no_entity, no_entity, no_entity, 2096, 804, no_entity,
+		  no_entity, 1674, no_entity, 301, no_entity, 1828, 1415, 707,
+		  no_entity, no_entity, no_entity, 1754, no_entity, 438, 402, 1730,
+		  no_entity, 1513, 879, no_entity, 1851, 886, no_entity, 212, 1408,
+		  1340, no_entity, no_entity, 1927, no_entity, no_entity, no_entity,
+		  no_entity, 1978, 105, 84, 658, 2124, no_entity, 436, 609, 345, 1837,
+		  476, no_entity, 1577, 39, 1491, 1610, 1868, 1112, 1057, 163, 1324,
+		  1958, no_entity, no_entity, no_entity, no_entity, 1193, 1965,
+		  no_entity, 2109, no_entity, 1010, 621, 1904, no_entity, no_entity,
+		  307, no_entity, 717, no_entity, no_entity, 656, no_entity, no_entity,
+		  2015, no_entity, 1915, 188, 847, 582, no_entity, 1474, 1414, 1846,
+		  no_entity, 85, no_entity, 324, 87, no_entity, 599, no_entity,
+		  no_entity, 1335, 2089, 598, 1245, 1161, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 1855, 15, 363, 1579, no_entity,
+		  no_entity, no_entity, 271, no_entity, no_entity, 1122, no_entity,
+		  no_entity, 408, 1738, 1910, no_entity, no_entity, 1387, no_entity,
+		  no_entity, 1801, no_entity, 1791, no_entity, 881, no_entity,
+		  no_entity, no_entity, 12, no_entity, 2075, no_entity, 35, 1887,
+		  no_entity, no_entity, no_entity, no_entity, 1200, no_entity, 331,
+		  no_entity, no_entity, 1988, 1642, 601, 1058, no_entity, no_entity,
+		  1669, no_entity, no_entity, no_entity, no_entity, 1239, 1662, 386,
+		  1737, 355, 680, no_entity, 1892, no_entity, no_entity, 1976,
+		  no_entity, no_entity, no_entity, 1633, 1412, no_entity, 1723, 817,
+		  no_entity, 1567, no_entity, 1533, 1807, 903, no_entity, no_entity,
+		  896, no_entity, no_entity, no_entity, 183, 1675, no_entity, 1778,
+		  no_entity, 1598, no_entity, 994, 1363, 2021, no_entity, 1676,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, 1547, 1135,
+		  233, 332, no_entity, no_entity, no_entity, no_entity, 1372, no_entity,
+		  1849, no_entity, 155, no_entity, 221, no_entity, 140, 2095, no_entity,
+		  664, no_entity, no_entity, no_entity, 1779, no_entity, 1971, 1318, 79,
+		  1551, no_entity, 1385, 1527, no_entity, 1221, 1813, 111, 499,
+		  no_entity, no_entity, 1624, 1663, no_entity, 2086, 72, no_entity,
+		  2073, 517, no_entity, 1438, 925, no_entity, 383, 1785, no_entity,
+		  no_entity, 303, 411, 2024, 785, 1391, 289, no_entity, no_entity,
+		  no_entity, 767, no_entity, no_entity, no_entity, 500, 218, no_entity,
+		  no_entity, 117, 954, no_entity, 209, 917, no_entity, 914, no_entity,
+		  no_entity, 1394, 749, 1671, no_entity, no_entity, no_entity, 782,
+		  no_entity, 519, 1113, 520, 851, 891, no_entity, 1424, 1653, no_entity,
+		  419, 696, 1614, 1033, no_entity, 1827, 40, 1847, no_entity, no_entity,
+		  no_entity, 889, 1977, 1602, 1803, 1055, 1782, 859, no_entity, 32,
+		  no_entity, 512, no_entity, 1508, 1329, 1071, no_entity, 1626,
+		  no_entity, 1947, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, 101, no_entity, no_entity, no_entity, 1613, 617, no_entity,
+		  1322, 317, 420, 2064, no_entity, 1083, no_entity, 1136, 602, 1257, 91,
+		  264, 700, 1536, 1110, 1471, no_entity, 377, no_entity, 1982, 1583,
+		  206, no_entity, 1116, no_entity, 748, no_entity, 1048, no_entity,
+		  no_entity, 339, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  361, 132, no_entity, no_entity, 503, no_entity, 489, 1670, no_entity,
+		  no_entity, 145, 228, no_entity, 588, 674, 1312, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 625, 1190, no_entity,
+		  no_entity, 1379, no_entity, 1890, no_entity, no_entity, 464, 687,
+		  no_entity, no_entity, 1726, 790, 1455, no_entity, 864, 1215, 1920,
+		  no_entity, 2006, no_entity, no_entity, 214, 224, 1225, 923, no_entity,
+		  1856, no_entity, 1587, no_entity, 2022, 1863, 252, 2112, no_entity,
+		  no_entity, 1664, 1672, no_entity, 1885, no_entity, 578, 695, 1345,
+		  no_entity, 1505, 595, 1829, 1160, no_entity, 865, no_entity,
+		  no_entity, no_entity, no_entity, 1009, 1629, no_entity, 2046, 504,
+		  1973, no_entity, 2069, no_entity, no_entity, 1928, 1959, no_entity,
+		  963, 1473, no_entity, 1735, no_entity, no_entity, 816, no_entity,
+		  1306, no_entity, 1620, no_entity, 2083, no_entity, 1081, 286,
+		  no_entity, 1076, 1809, no_entity, no_entity, no_entity, no_entity,
+		  352, 930, 1882, 827, 1497, 1504, no_entity, 1446, 645, no_entity,
+		  no_entity, 622, 1411, 972, no_entity, no_entity, no_entity, 793, 635,
+		  1124, no_entity, no_entity, no_entity, no_entity, 1462, no_entity,
+		  no_entity, 437, no_entity, no_entity, 1859, no_entity, 1936,
+		  no_entity, 1210, no_entity, 1390, 502, 1690, 1107, 57, no_entity,
+		  1899, 556, 679, 1541, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, 683, no_entity, 1997, 251, no_entity, no_entity,
+		  688, 281, 792, 1216, 719, 837, no_entity, 814, 1020, 1790, 1639,
+		  no_entity, no_entity, no_entity, 764, no_entity, 1013, 1383,
+		  no_entity, no_entity, 555, 255, no_entity, 37, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 9, no_entity, no_entity, no_entity,
+		  no_entity, 586, no_entity, 283, no_entity, 1341, no_entity, 648,
+		  no_entity, no_entity, no_entity, 585, no_entity, 333, no_entity,
+		  no_entity, no_entity, 65, 1243, no_entity, no_entity, 2079, 1592, 892,
+		  1696, 1543, 2067, no_entity, 543, no_entity, 1728, 880, no_entity,
+		  no_entity, no_entity, 1697, 2037, 2018, 1367, 86, 459, no_entity,
+		  1152, no_entity, no_entity, 1619, 1332, no_entity, 1278, no_entity,
+		  no_entity, 199, 580, no_entity, no_entity, no_entity, 1584, 2070, 825,
+		  no_entity, no_entity, no_entity, no_entity, 798, no_entity, no_entity,
+		  1969, 2059, no_entity, no_entity, no_entity, 1819, 1428, no_entity,
+		  507, no_entity, 1001, no_entity, no_entity, 69, no_entity, no_entity,
+		  no_entity, 216, 1871, no_entity, 1660, 1440, no_entity, no_entity, 20,
+		  no_entity, 690, no_entity, 21, 1052, no_entity, no_entity, 897,
+		  no_entity, no_entity, 1907, 1979, 440, 472, no_entity, 323, no_entity,
+		  1195, 1212, 349, 1410, 1981, 722, no_entity, 1085, no_entity, 1822,
+		  1565, no_entity, 1815, 1234, 1235, no_entity, 416, 1806, 305, 992,
+		  1170, no_entity, no_entity, 515, no_entity, 1429, 1331, no_entity,
+		  325, 193, 1264, 1843, 1078, no_entity, no_entity, no_entity, 974,
+		  no_entity, no_entity, no_entity, 1181, no_entity, 791, 1365, 1821,
+		  no_entity, no_entity, 559, no_entity, 947, no_entity, no_entity, 714,
+		  no_entity, 938, 201, no_entity, 77, no_entity, 2012, no_entity,
+		  no_entity, no_entity, no_entity, 665, 1030, 466, 813, 1561, 553,
+		  no_entity, no_entity, 919, no_entity, 965, 242, no_entity, no_entity,
+		  429, no_entity, no_entity, 1967, no_entity, 1199, 637, 1077,
+		  no_entity, 2029, 1715, no_entity, 2032, 1955, no_entity, no_entity,
+		  1689, 463, no_entity, no_entity, 709, 726, 849, 1724, no_entity, 125,
+		  1911, 1130, no_entity, no_entity, 1490, 763, no_entity, no_entity,
+		  1482, 770, no_entity, 1223, 384, no_entity, no_entity, 597, no_entity,
+		  1570, no_entity, no_entity, 1727, 1771, no_entity, no_entity, 1310,
+		  1070, 220, 873, 1214, no_entity, no_entity, no_entity, no_entity,
+		  1374, 787, 1, no_entity, 666, no_entity, 909, no_entity, no_entity,
+		  1572, 1409, 485, no_entity, 412, 469, 1164, no_entity, 1601, 1702,
+		  1168, 1354, 753, 1990, 1053, no_entity, 1731, 2061, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 213, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 1031, 852, 1368, 948, 737,
+		  no_entity, no_entity, 1080, no_entity, no_entity, 1098, 937,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, 783, no_entity,
+		  1286, 465, 702, no_entity, 660, no_entity, no_entity, 44, 2033, 550,
+		  no_entity, no_entity, 1548, 115, no_entity, no_entity, 223, no_entity,
+		  154, 2114, no_entity, 1088, no_entity, 1258, 483, 1292, 557, 1917,
+		  1665, no_entity, no_entity, no_entity, 204, 1463, 878, no_entity,
+		  no_entity, 1656, 256, 2093, no_entity, no_entity, 614, no_entity,
+		  no_entity, 1609, 498, no_entity, no_entity, 1563, no_entity, 2103,
+		  1176, 328, 1344, no_entity, no_entity, no_entity, 182, no_entity,
+		  no_entity, no_entity, 1852, 75, 454, 341, 427, 347, 922, 2011,
+		  no_entity, no_entity, no_entity, no_entity, 1004, no_entity,
+		  no_entity, no_entity, 267, 1894, no_entity, no_entity, 1655, 25, 1150,
+		  624, no_entity, 1842, 2003, no_entity, no_entity, no_entity, 1537,
+		  1270, 834, 1499, 1739, 1985, 480, 1589, no_entity, no_entity,
+		  no_entity, 733, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, 1902, 1000, 1805, no_entity, 61, 1576, no_entity, 1734,
+		  1317, no_entity, no_entity, 2035, 1926, 2065, no_entity, 654,
+		  no_entity, 1630, no_entity, no_entity, 2116, no_entity, 989,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  1147, no_entity, no_entity, 705, 344, 673, 6, 1479, 1155, 98,
+		  no_entity, 136, no_entity, no_entity, no_entity, no_entity, 1280,
+		  1538, no_entity, no_entity, 1222, 988, no_entity, 36, no_entity, 1831,
+		  168, 890, 1281, 1184, 33, 391, no_entity, 2107, no_entity, 1206, 607,
+		  529, no_entity, 1182, 2113, 1104, 839, no_entity, 2074, no_entity,
+		  no_entity, no_entity, no_entity, 760, no_entity, 1935, 2111, 1389,
+		  no_entity, 776, 1293, 1137, no_entity, no_entity, 327, 2038,
+		  no_entity, no_entity, 124, no_entity, 22, 1115, no_entity, no_entity,
+		  1019, no_entity, no_entity, no_entity, 343, 19, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 2054, 1125, 1178,
+		  no_entity, 1395, 1506, no_entity, 932, 1492, 1529, no_entity, 569,
+		  1875, 2098, 1449, 353, 1762, no_entity, 958, 1686, 2013, no_entity,
+		  no_entity, 901, no_entity, 102, 1761, 530, no_entity, no_entity, 1698,
+		  1650, no_entity, 1143, no_entity, no_entity, no_entity, no_entity,
+		  516, no_entity, 1056, no_entity, 1272, 1717, no_entity, 45, 1768,
+		  no_entity, no_entity, no_entity, no_entity, 1764, no_entity,
+		  no_entity, 1426, 1271, 1862, no_entity, 2048, 42, 1850, 1668,
+		  no_entity, no_entity, no_entity, 1034, no_entity, 885, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, 2056, 1549,
+		  no_entity, no_entity, 1381, no_entity, no_entity, 1248, no_entity,
+		  no_entity, 1692, 388, 1780, 1991, no_entity, 41, no_entity, 684, 296,
+		  no_entity, no_entity, no_entity, 895, 1877, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 1291, 893, 1470, 1398, 1753,
+		  no_entity, no_entity, no_entity, 1752, no_entity, no_entity, 1259,
+		  no_entity, 1247, no_entity, 186, 1027, no_entity, no_entity, 109, 276,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, 1146, no_entity, no_entity, no_entity, 1903, 1126, 1364,
+		  908, 532, no_entity, 573, 96, no_entity, 1600, 207, no_entity, 1590,
+		  382, 375, 1695, no_entity, 1832, no_entity, no_entity, 495, 381, 2077,
+		  210, 1316, 1912, no_entity, 222, no_entity, no_entity, no_entity,
+		  no_entity, 1397, 583, no_entity, no_entity, 831, no_entity, 261, 1453,
+		  no_entity, 1559, no_entity, no_entity, 1605, 1443, no_entity, 706,
+		  no_entity, 1351, 807, 161, no_entity, no_entity, 1061, 1197, 509,
+		  no_entity, no_entity, 2104, 563, no_entity, 330, 486, 657, 644, 1425,
+		  no_entity, 640, no_entity, 358, 247, no_entity, no_entity, no_entity,
+		  no_entity, 1796, 2042, 1678, no_entity, 1673, 1039, no_entity,
+		  no_entity, 166, no_entity, no_entity, 1237, 1573, no_entity,
+		  no_entity, no_entity, no_entity, 393, 28, no_entity, no_entity, 990,
+		  1874, 1521, no_entity, no_entity, no_entity, no_entity, 1466, 1582,
+		  855, no_entity, 292, 716, 1993, 1183, 1707, 1818, 777, 1909,
+		  no_entity, no_entity, 481, 322, no_entity, no_entity, no_entity,
+		  no_entity, 270, 82, no_entity, 348, 461, no_entity, no_entity, 468,
+		  no_entity, no_entity, no_entity, no_entity, 1167, no_entity, 788,
+		  1744, no_entity, 253, 1481, no_entity, no_entity, no_entity, 1191,
+		  946, no_entity, no_entity, 603, 1091, no_entity, no_entity, no_entity,
+		  no_entity, 750, 1241, no_entity, no_entity, no_entity, no_entity,
+		  1355, no_entity, no_entity, no_entity, 1940, no_entity, 537, 983,
+		  no_entity, 540, 1603, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, 747, no_entity, 985, 1430, 453, no_entity, no_entity, 492,
+		  no_entity, 830, 291, 943, 1138, no_entity, no_entity, no_entity, 1103,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  1946, 811, no_entity, 68, no_entity, 231, 900, no_entity, 870,
+		  no_entity, no_entity, no_entity, 431, no_entity, 1347, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 1532, 1370, no_entity, 71, no_entity,
+		  1763, 299, 820, 1688, no_entity, no_entity, 735, no_entity, no_entity,
+		  1914, 18, no_entity, 5, 1942, 1759, no_entity, 409, no_entity, 966,
+		  1469, no_entity, no_entity, 1211, 487, 426, no_entity, 711, 365, 799,
+		  no_entity, 62, no_entity, no_entity, 836, no_entity, no_entity,
+		  no_entity, no_entity, 1905, no_entity, no_entity, no_entity, 1811,
+		  no_entity, 415, no_entity, no_entity, no_entity, 1250, no_entity,
+		  1948, no_entity, no_entity, 692, no_entity, 971, 829, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity, 843,
+		  627, no_entity, 838, 1493, no_entity, no_entity, 177, 146, no_entity,
+		  1637, 725, 671, no_entity, 1961, no_entity, 797, no_entity, no_entity,
+		  1964, no_entity, 1266, 2122, 31, no_entity, 144, 844, no_entity, 1132,
+		  805, no_entity, 600, no_entity, 592, no_entity, 1528, no_entity,
+		  no_entity, no_entity, 50, no_entity, no_entity, no_entity, 1996,
+		  no_entity, 1456, 360, no_entity, no_entity, 2001, 698, no_entity,
+		  no_entity, no_entity, 1646, no_entity, no_entity, no_entity, 336,
+		  no_entity, 198, 728, 1706, no_entity, 1441, no_entity, no_entity,
+		  no_entity, no_entity, 1386, 1841, 432, no_entity, no_entity, 1954,
+		  no_entity, 739, 1352, no_entity, no_entity, no_entity, no_entity, 73,
+		  no_entity, 802, 288, no_entity, 1451, 842, no_entity, no_entity, 1042,
+		  1925, 433, no_entity, 1826, 1477, 83, 538, 250, 638, no_entity,
+		  no_entity, no_entity, 1358, no_entity, 1320, no_entity, no_entity,
+		  no_entity, 479, no_entity, 1277, 24, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, 189, no_entity, 254, no_entity, no_entity, 840,
+		  544, 1064, no_entity, no_entity, no_entity, 587, 2090, no_entity,
+		  no_entity, 1984, 1219, 1349, 659, no_entity, 572, no_entity, 2017,
+		  2016, no_entity, 713, no_entity, no_entity, 1173, no_entity, 114,
+		  1275, no_entity, 1941, no_entity, no_entity, 1628, no_entity, 567,
+		  1097, 525, no_entity, 306, no_entity, 1835, no_entity, 539, 685,
+		  no_entity, no_entity, 2082, no_entity, no_entity, 1460, no_entity,
+		  1156, no_entity, 1644, 1399, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, 1998, 1878, no_entity, 379, 1444, no_entity,
+		  no_entity, 857, no_entity, 1032, 1523, 351, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 494, 1323, no_entity, 1799, 2060,
+		  no_entity, 551, no_entity, 444, 721, 394, 59, no_entity, no_entity,
+		  1509, no_entity, 616, 180, 1839, no_entity, no_entity, 1900, 1557,
+		  389, no_entity, no_entity, no_entity, 1825, no_entity, 1468, 1288,
+		  237, 1714, 370, 1041, 704, no_entity, no_entity, no_entity, 961, 2085,
+		  no_entity, 202, 845, no_entity, 1228, no_entity, no_entity, 104,
+		  no_entity, no_entity, 302, no_entity, 1721, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, 1740, 1534, no_entity, 413, 960, 1086, no_entity,
+		  no_entity, 4, 755, 1830, no_entity, 1276, 956, no_entity, 406, 13,
+		  no_entity, 623, 866, no_entity, 1679, no_entity, 703, no_entity,
+		  no_entity, 1342, 1282, 1684, 1427, 606, 933, 649, no_entity, 1343,
+		  no_entity, 1169, no_entity, 257, 1960, no_entity, 1555, 1065,
+		  no_entity, 417, no_entity, no_entity, 1423, no_entity, no_entity,
+		  no_entity, 1608, 904, 159, no_entity, 285, 1486, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 1075, 634, no_entity, 803, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 112, 17, 260, 449, 1283,
+		  1932, 1437, no_entity, no_entity, no_entity, 984, 240, 390, 490, 474,
+		  no_entity, 561, 1400, no_entity, 1045, 915, no_entity, no_entity,
+		  2108, 652, 1330, 593, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, 911, 1151, 110, 1494, no_entity, 387, no_entity, 1515,
+		  1812, 1084, 1808, no_entity, no_entity, 1611, 2004, no_entity, 762,
+		  no_entity, no_entity, 1962, no_entity, no_entity, 2, no_entity,
+		  no_entity, 978, 1015, no_entity, 1296, 1388, 1870, 1392, 626, 633,
+		  1699, 354, 1865, 2117, no_entity, no_entity, 2062, no_entity, 1059,
+		  407, no_entity, no_entity, 318, 822, 1742, 310, no_entity, no_entity,
+		  no_entity, 1357, no_entity, 63, no_entity, 1588, 1760, no_entity, 806,
+		  no_entity, no_entity, 1251, no_entity, no_entity, 751, 1858,
+		  no_entity, 1189, no_entity, no_entity, 452, no_entity, 312, 774,
+		  no_entity, no_entity, 378, 174, 450, no_entity, 200, no_entity, 975,
+		  no_entity, 169, 493, no_entity, no_entity, 1127, no_entity, 1649,
+		  1405, 229, 2100, 123, 929, no_entity, no_entity, 94, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 410, no_entity, 60, 1786,
+		  2040, 647, no_entity, 1402, no_entity, no_entity, no_entity, 1450,
+		  999, no_entity, 1571, 1350, 1725, 1621, 1253, 841, no_entity, 122,
+		  103, 1709, 14, 1957, 815, 1284, 1591, no_entity, 982, no_entity, 2034,
+		  no_entity, no_entity, no_entity, 524, 359, 1196, no_entity, 275, 1287,
+		  no_entity, no_entity, 1896, 568, 428, 158, no_entity, 1044, 1607,
+		  no_entity, no_entity, 1810, 2025, no_entity, no_entity, no_entity,
+		  1304, no_entity, 1518, 631, no_entity, no_entity, 812, no_entity,
+		  1647, no_entity, no_entity, 1254, no_entity, 1314, 1952, 1732, 269,
+		  no_entity, 514, 119, 1883, no_entity, 1994, 1540, no_entity,
+		  no_entity, no_entity, 991, 1134, no_entity, 1457, 2115, 1530, 443,
+		  1431, 1580, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  1313, 2058, 675, 1924, 1918, 265, no_entity, 676, 1369, no_entity,
+		  1956, no_entity, 784, 95, 227, 55, 1066, 1872, no_entity, 1459,
+		  no_entity, no_entity, 526, no_entity, no_entity, 1289, 130, 2091, 184,
+		  141, 1516, 1623, no_entity, 153, 38, no_entity, no_entity, 149,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 2053, 1231, 203,
+		  no_entity, no_entity, 293, 2014, 1512, no_entity, no_entity, 1159,
+		  1840, 1037, no_entity, 326, no_entity, no_entity, 1158, no_entity,
+		  138, no_entity, 197, no_entity, 1187, 2118, 2009, 294, 1562,
+		  no_entity, no_entity, 533, no_entity, no_entity, no_entity, 64, 262,
+		  338, no_entity, 1209, no_entity, no_entity, 219, 1488, no_entity, 611,
+		  no_entity, 952, 856, 772, 1999, 1615, no_entity, 1934, 781, 137,
+		  no_entity, no_entity, no_entity, no_entity, 741, no_entity, 1888,
+		  1165, no_entity, no_entity, no_entity, no_entity, 732, 1359,
+		  no_entity, no_entity, no_entity, no_entity, 400, 651, no_entity,
+		  no_entity, no_entity, 2076, 898, 248, 1797, no_entity, no_entity,
+		  no_entity, no_entity, 548, no_entity, no_entity, no_entity, 610,
+		  no_entity, 2007, 211, 1106, 1092, no_entity, no_entity, 736,
+		  no_entity, 1681, no_entity, 1651, no_entity, no_entity, no_entity,
+		  1002, 596, no_entity, 397, 918, no_entity, 1995, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 89, 1564, 1036, 894, 90,
+		  1922, 398, no_entity, 715, no_entity, no_entity, 329, 295, no_entity,
+		  1244, 1047, 1729, 1236, no_entity, no_entity, no_entity, 620, 97,
+		  no_entity, no_entity, 1545, no_entity, no_entity, no_entity, 693, 810,
+		  no_entity, 571, no_entity, no_entity, no_entity, 445, 1535, no_entity,
+		  311, 920, 1743, 1154, 2066, no_entity, no_entity, 701, no_entity,
+		  1631, 1867, no_entity, 826, 858, no_entity, 442, no_entity, 1908,
+		  1014, no_entity, no_entity, no_entity, 646, 1054, 1208, no_entity, 34,
+		  no_entity, no_entity, 107, no_entity, 1067, 1142, 1062, no_entity,
+		  876, 1119, 1861, 2045, no_entity, no_entity, no_entity, 980, 1804,
+		  1625, 118, 2002, 1489, no_entity, 1204, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 371, 944, no_entity, 1750, 1719, 743,
+		  no_entity, 1659, 1226, 106, no_entity, 1498, no_entity, no_entity,
+		  no_entity, 501, 1069, no_entity, no_entity, 425, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 1519, 1487, no_entity, no_entity,
+		  854, no_entity, no_entity, 821, no_entity, no_entity, no_entity, 1531,
+		  no_entity, 1938, 1554, no_entity, 2005, 162, 888, 266, 1595,
+		  no_entity, 1484, no_entity, 575, no_entity, 2027, 584, no_entity, 460,
+		  300, 574, no_entity, no_entity, 113, 108, no_entity, no_entity, 346,
+		  no_entity, 1246, 1131, 765, no_entity, no_entity, 1652, no_entity,
+		  no_entity, no_entity, 887, no_entity, 1022, no_entity, no_entity,
+		  1336, no_entity, no_entity, 1118, 899, no_entity, no_entity,
+		  no_entity, 2008, no_entity, no_entity, no_entity, 1677, 1192, 1775,
+		  no_entity, no_entity, 496, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, 246, 630, 862, no_entity, no_entity, no_entity,
+		  619, 1007, 987, 1511, no_entity, no_entity, no_entity, 2052,
+		  no_entity, no_entity, 1616, no_entity, 1334, 1733, no_entity,
+		  no_entity, no_entity, 2088, no_entity, 1422, 768, no_entity, 1458,
+		  1121, no_entity, 565, 80, no_entity, 2019, 208, 1021, no_entity, 190,
+		  756, 1705, no_entity, 1163, no_entity, 964, 1094, 1929, no_entity,
+		  1401, no_entity, no_entity, 1886, 794, no_entity, 969, 482, no_entity,
+		  27, no_entity, 995, 1194, 1606, 1749, no_entity, 1141, no_entity,
+		  no_entity, no_entity, 1043, no_entity, 1682, no_entity, 758, 1162,
+		  731, 931, no_entity, no_entity, no_entity, 979, no_entity, 357,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, 967, no_entity,
+		  no_entity, 1203, no_entity, 935, no_entity, 1242, 1574, 681, 1720,
+		  no_entity, 1857, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, 694, no_entity, no_entity, 369, no_entity, no_entity,
+		  no_entity, no_entity, 2106, no_entity, 566, no_entity, 374, 1267,
+		  1566, no_entity, 1005, 321, 1766, no_entity, 1950, no_entity,
+		  no_entity, no_entity, 1227, 977, no_entity, no_entity, 126, 1315,
+		  1765, no_entity, 298, no_entity, no_entity, 546, no_entity, no_entity,
+		  121, 1648, 1916, 1382, 1148, 968, no_entity, 473, 868, 157, no_entity,
+		  no_entity, 590, no_entity, 1933, no_entity, 906, 998, 1756, no_entity,
+		  no_entity, no_entity, no_entity, 912, 1465, 395, no_entity, 650, 1252,
+		  no_entity, 2043, no_entity, 1420, no_entity, 1232, 1180, no_entity,
+		  290, no_entity, 1893, 226, no_entity, 396, no_entity, 236, no_entity,
+		  no_entity, 2072, 1050, 1268, 215, no_entity, 800, 775, 832, 3,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  1017, no_entity, no_entity, 1854, no_entity, no_entity, 1478, 2030,
+		  372, no_entity, no_entity, no_entity, 1111, 1461, 1447, no_entity,
+		  552, no_entity, 720, no_entity, no_entity, 1366, no_entity, no_entity,
+		  no_entity, 147, 116, 1285, 1773, 796, 1645, no_entity, 1802, 1594,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, 560, no_entity, 2055, no_entity, no_entity, 786,
+		  no_entity, 1838, no_entity, 462, no_entity, 471, 67, no_entity, 1748,
+		  1361, no_entity, 1869, no_entity, no_entity, 993, 1417, no_entity,
+		  no_entity, 1175, no_entity, 1944, 1105, no_entity, 1371, 120,
+		  no_entity, no_entity, no_entity, 1483, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 957, 1120, no_entity, no_entity,
+		  1823, no_entity, 1792, 1845, no_entity, no_entity, no_entity, 441,
+		  no_entity, 414, no_entity, no_entity, no_entity, 1321, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 1263, no_entity, 1072,
+		  no_entity, no_entity, 1635, no_entity, 1485, 945, 2026, no_entity,
+		  192, no_entity, no_entity, no_entity, 30, 882, no_entity, no_entity,
+		  362, 196, no_entity, no_entity, no_entity, 235, 1710, no_entity,
+		  no_entity, no_entity, 1294, no_entity, 1889, no_entity, no_entity,
+		  1117, 1853, no_entity, no_entity, no_entity, 576, no_entity, 1596,
+		  2110, no_entity, no_entity, no_entity, 1777, 284, 51, 729, no_entity,
+		  475, no_entity, 819, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, 2049, 470, no_entity, no_entity, no_entity, no_entity,
+		  1798, 869, no_entity, no_entity, 367, no_entity, 795, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 2044, 1638, no_entity,
+		  734, 1439, no_entity, no_entity, no_entity, 1229, no_entity, 1325,
+		  no_entity, 846, 1172, no_entity, 1833, no_entity, 1661, no_entity,
+		  no_entity, 78, no_entity, no_entity, 759, no_entity, 1012, no_entity,
+		  no_entity, no_entity, no_entity, 243, no_entity, 570, no_entity,
+		  no_entity, 319, 970, 342, 727, no_entity, no_entity, no_entity, 1898,
+		  778, 53, 883, 93, no_entity, no_entity, 156, no_entity, no_entity,
+		  no_entity, 670, no_entity, 268, no_entity, no_entity, 686, no_entity,
+		  848, no_entity, no_entity, 1338, 1339, no_entity, 2097, no_entity,
+		  no_entity, no_entity, 1302, 1177, no_entity, 528, 1337, 1060,
+		  no_entity, 508, 456, 1795, no_entity, 239, 1144, 1634, 1074, 143,
+		  1622, 1303, no_entity, 740, no_entity, 47, no_entity, 2119, no_entity,
+		  1517, no_entity, no_entity, 921, 54, 1544, no_entity, 1722, no_entity,
+		  no_entity, 534, no_entity, 562, no_entity, no_entity, no_entity,
+		  no_entity, 1980, no_entity, 1274, 1836, 941, 1880, 1774, 1968, 1919,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, 1416, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, 380, no_entity,
+		  no_entity, 139, 1745, 1539, no_entity, 70, no_entity, no_entity, 642,
+		  152, no_entity, no_entity, no_entity, no_entity, no_entity, 439,
+		  no_entity, 1432, 356, no_entity, no_entity, no_entity, 1301, 1333,
+		  no_entity, no_entity, no_entity, 1166, no_entity, 712, 205, 1380,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, 1407, 724,
+		  no_entity, 1442, no_entity, no_entity, 1794, no_entity, 1279, 1093,
+		  no_entity, 1217, no_entity, no_entity, 2047, no_entity, no_entity,
+		  1526, no_entity, 1716, no_entity, 1643, 435, 133, 940, no_entity,
+		  1816, no_entity, no_entity, 773, no_entity, 1421, 1018, 385, 194,
+		  no_entity, no_entity, no_entity, no_entity, 1618, 175, 1654,
+		  no_entity, no_entity, 1501, no_entity, no_entity, no_entity, 2020,
+		  282, 1769, 1026, 1040, 581, no_entity, 1901, 730, 165, 1082, 1581,
+		  249, 1951, no_entity, no_entity, no_entity, 167, 8, 1464, 1049, 1552,
+		  1377, 422, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, 1923, no_entity, 1269, no_entity, no_entity,
+		  1522, no_entity, no_entity, 280, 1586, no_entity, 718, no_entity,
+		  no_entity, no_entity, no_entity, no_entity, 1558, 629, 195, no_entity,
+		  no_entity, no_entity, 1308, no_entity, no_entity, 1068, 1376, 263,
+		  no_entity, 1448, 1087, 1772, 973, no_entity, 1353, no_entity,
+		  no_entity, no_entity, 853, no_entity, 1114, 518, no_entity, no_entity,
+		  no_entity, 373, no_entity, 1783, no_entity, no_entity, no_entity,
+		  1433, 2010, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  1046, 981, 1123, 2078, no_entity, 278, no_entity, no_entity, 547, 697,
+		  no_entity, no_entity, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, 88, 959, no_entity, 1820, no_entity, 1255, 2041, 1273,
+		  no_entity, no_entity, 1972, 2028, no_entity, 1006, 1986, no_entity,
+		  1781, no_entity, no_entity, no_entity, 10, 1636, 523, no_entity,
+		  no_entity, 997, no_entity, no_entity, no_entity, no_entity, 1787,
+		  no_entity, 2050, 488, no_entity, no_entity, 297, no_entity, 605,
+		  no_entity, no_entity, 927, no_entity, 761, no_entity, no_entity, 1475,
+		  1129, no_entity, no_entity, 1814, 1553, no_entity, 1362, 340,
+		  no_entity, 1435, no_entity, no_entity, no_entity, no_entity, 594,
+		  1179, no_entity, 2121, 478, no_entity, 2102, no_entity, no_entity,
+		  850, 404, 1101, no_entity, 1305, no_entity, no_entity, 1153,
+		  no_entity, no_entity, 1593, 1751, no_entity, no_entity, 173,
+		  no_entity, no_entity, no_entity, 628, 176, no_entity, 128, 745, 558,
+		  no_entity, no_entity, no_entity, 752, no_entity, no_entity, no_entity,
+		  no_entity, 1023, 430, 337, 951, no_entity, 953, no_entity, 418,
+		  no_entity, 1943, no_entity, no_entity, no_entity, 744, 424, 245, 313,
+		  505, 7, 1860, no_entity, 1102, 238, 1495, 1174, 1800, 1746, no_entity,
+		  1090, 74, 691, no_entity, 1202, no_entity, 1866, 1876, 1824, 1597,
+		  no_entity, 2120, 1298, 43, 678, no_entity, no_entity, 1133, 757,
+		  no_entity, no_entity, no_entity, no_entity, 2031, 179, 1550, 451, 510,
+		  no_entity, no_entity, 1757, no_entity, 48, 1029, no_entity, 949,
+		  no_entity, 872, 1024, 818, 769, no_entity, 1299, 1003, no_entity,
+		  1931, 1913, no_entity, no_entity, 653, 1560, 49, 1612, no_entity,
+		  no_entity, 942, 26, no_entity, no_entity, 1685, 16, no_entity,
+		  no_entity, 191, no_entity, no_entity, 1703, no_entity, 1149,
+		  no_entity, no_entity, 1139, no_entity, 527, 1897, no_entity,
+		  no_entity, 1542, no_entity, 780, no_entity, no_entity, no_entity,
+		  no_entity, 884, no_entity, 2094, 1864, 1384, 2080, no_entity, 910,
+		  no_entity, 924, no_entity, 230, no_entity, no_entity, no_entity, 403,
+		  no_entity, no_entity, 448, 577, no_entity, 1701, no_entity, 1300,
+		  1694, 604, 1657, no_entity, no_entity, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 591, no_entity, 315, no_entity, 913,
+		  164, no_entity, 663, no_entity, no_entity, no_entity, no_entity, 535,
+		  no_entity, no_entity, no_entity, 447, 1419, 2068, 151, 100, 1507,
+		  no_entity, 789, 1524, 636, no_entity, 1834, no_entity, 259, no_entity,
+		  no_entity, 1436, no_entity, no_entity, 2039, 1016, 0, no_entity, 613,
+		  287, 1073, no_entity, no_entity, no_entity, no_entity, 1403, 148,
+		  no_entity, 1658, 401, 1758, 1213, 258, 655, 643, 511, 1171, no_entity,
+		  1261, no_entity, no_entity, 1975, 521, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 1881, 1895, no_entity, no_entity,
+		  no_entity, no_entity, no_entity, 1767, 1755, no_entity, 1445,
+		  no_entity, 1328, 1360, no_entity, 244, 1413, 860, };
+
+		static_assert( sizeof( entities ) / sizeof( entities[0] ) == entity_count );
+
+		[[nodiscard]] constexpr std::uint32_t hash( daw::string_view name,
+		                                            std::uint32_t seed ) noexcept {
+			std::uint32_t result = 0x811C'9DC5U ^ seed;
+			for( char c : name ) {
+				result ^= static_cast<unsigned char>( c );
+				result *= 0x0100'0193U;
+			}
+			return result;
+		}
+
+		[[nodiscard]] constexpr daw::string_view
+		entity_name( html_entity const &entity ) noexcept {
+			return daw::string_view( entity_names + entity.name_offset,
+			                         entity.name_size );
+		}
+
+		[[nodiscard]] constexpr std::size_t
+		slot_of( daw::string_view name ) noexcept {
+			auto const bucket = hash( name, 0 ) % bucket_count;
+			return hash( name, displacements[bucket] ) % slot_count;
+		}
+
+		[[nodiscard]] constexpr bool is_perfect_hash( ) noexcept {
+			for( std::size_t n = 0; n < entity_count; ++n ) {
+				if( slots[slot_of( entity_name( entities[n] ) )] != n ) {
+					return false;
+				}
+			}
+			return true;
+		}
+		static_assert( is_perfect_hash( ),
+		               "Every entity must hash to its own slot" );
+	} // namespace
+
+	html_entity const *find_html_entity( daw::string_view name ) noexcept {
+		if( name.empty( ) or name.size( ) > max_entity_name_size ) {
+			return nullptr;
+		}
+		auto const idx = slots[slot_of( name )];
+		if( idx == no_entity ) {
+			return nullptr;
+		}
+		html_entity const &entity = entities[idx];
+		if( entity_name( entity ) != name ) {
+			return nullptr;
+		}
+		return &entity;
+	}
+} // namespace daw::gumbo::entity_details
@@ -0,0 +1,63 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_id_index.h>
+#include <daw/gumbo_pp/gumbo_util.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <gumbo.h>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace daw::gumbo {
+	id_index::id_index( gumbo_range const &rng ) noexcept
+	  : id_index( rng.begin( ), rng.end( ) ) {}
+
+	id_index::id_index( gumbo_node_iterator_t first,
+	                    gumbo_node_iterator_t last ) noexcept
+	  : m_first( first )
+	  , m_last( last ) {}
+
+	void id_index::build( ) const {
+		using entry_t = std::pair<std::string_view, GumboNode const *>;
+		auto entries = std::vector<entry_t>( );
+		for( auto it = m_first; it != m_last; ++it ) {
+			auto const attr_count = get_attribute_count( *it );
+			for( std::size_t n = 0; n < attr_count; ++n ) {
+				auto const *attr = get_attribute_node_at( *it, n );
+				if( std::strcmp( attr->name, "id" ) != 0 ) {
+					continue;
+				}
+				auto const value = std::string_view( attr->value );
+				// An empty id never matches, as with getElementById
+				if( not value.empty( ) ) {
+					entries.emplace_back( value, it.get( ) );
+				}
+				break;
+			}
+		}
+		// Stable, so the elements of a repeated id stay in document order
+		std::stable_sort( entries.begin( ),
+		                  entries.end( ),
+		                  []( entry_t const &lhs, entry_t const &rhs ) {
+			                  return lhs.first < rhs.first;
+		                  } );
+		m_ids.reserve( entries.size( ) );
+		m_nodes.reserve( entries.size( ) );
+		for( auto const &[id, node] : entries ) {
+			if( m_ids.empty( ) or m_ids.back( ) != id ) {
+				++m_distinct;
+			}
+			m_ids.push_back( id );
+			m_nodes.push_back( node );
+		}
+	}
+} // namespace daw::gumbo
@@ -0,0 +1,40 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_interner.h>
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace daw::gumbo {
+	string_interner::string_interner( std::size_t max_value_size )
+	  : m_max_value_size( max_value_size ) {}
+
+	string_interner::atom_t string_interner::intern( daw::string_view str ) {
+		auto const key = std::string_view( str.data( ), str.size( ) );
+		if( auto pos = m_atoms.find( key ); pos != m_atoms.end( ) ) {
+			return pos->second;
+		}
+		auto const atom = static_cast<atom_t>( m_strings.size( ) );
+		auto const &stored = m_strings.emplace_back( key );
+		m_atoms.emplace( std::string_view( stored ), atom );
+		return atom;
+	}
+
+	string_interner::atom_t
+	string_interner::find( daw::string_view str ) const {
+		auto pos = m_atoms.find( std::string_view( str.data( ), str.size( ) ) );
+		if( pos == m_atoms.end( ) ) {
+			return no_atom;
+		}
+		return pos->second;
+	}
+} // namespace daw::gumbo
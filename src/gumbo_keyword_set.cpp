@@ -0,0 +1,192 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_keyword_set.h>
+
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace daw::gumbo {
+	namespace keyword_details {
+		using state_t = std::uint32_t;
+		inline constexpr state_t no_state = static_cast<state_t>( -1 );
+
+		/// The trie of the keywords with the failure links folded into its
+		/// transitions, so each byte of the text is one table lookup.  Bytes are
+		/// mapped to classes first, the bytes that appear in no keyword sharing
+		/// class 0, which keeps a row as wide as the keywords' alphabet instead of
+		/// 256
+		struct automaton {
+			std::vector<std::string> keywords{ };
+			// Up to 256 classes of bytes used by the keywords plus class 0
+			std::array<std::uint16_t, 256> byte_class{ };
+			std::size_t class_count = 1;
+			// class_count entries per state.  State 0 is the root
+			std::vector<state_t> next{ };
+			// The keywords ending at state s are
+			// outputs[output_first[s]..output_first[s + 1])
+			std::vector<std::uint32_t> output_first{ };
+			std::vector<std::uint32_t> outputs{ };
+			// The nearest state along the failure links that has outputs
+			std::vector<state_t> output_link{ };
+			// Does any keyword end at the state, directly or by its output links
+			std::vector<std::uint8_t> accepting{ };
+
+			explicit automaton( std::vector<std::string> kws )
+			  : keywords( std::move( kws ) ) {
+				for( auto const &keyword : keywords ) {
+					for( char c : keyword ) {
+						auto &cls = byte_class[static_cast<unsigned char>( c )];
+						if( cls == 0 ) {
+							cls = static_cast<std::uint16_t>( class_count++ );
+						}
+					}
+				}
+				auto own_outputs = std::vector<std::vector<std::uint32_t>>( 1 );
+				next.assign( class_count, 0 );
+				for( std::size_t k = 0; k < keywords.size( ); ++k ) {
+					if( keywords[k].empty( ) ) {
+						continue;
+					}
+					state_t state = 0;
+					for( char c : keywords[k] ) {
+						auto const cls = byte_class[static_cast<unsigned char>( c )];
+						auto &child = next[state * class_count + cls];
+						if( child == 0 ) {
+							child = static_cast<state_t>( own_outputs.size( ) );
+							own_outputs.emplace_back( );
+							next.resize( next.size( ) + class_count, 0 );
+						}
+						state = next[state * class_count + cls];
+					}
+					own_outputs[state].push_back( static_cast<std::uint32_t>( k ) );
+				}
+				auto const state_count = own_outputs.size( );
+				output_first.reserve( state_count + 1 );
+				for( auto const &own : own_outputs ) {
+					output_first.push_back(
+					  static_cast<std::uint32_t>( outputs.size( ) ) );
+					outputs.insert( outputs.end( ), own.begin( ), own.end( ) );
+				}
+				output_first.push_back(
+				  static_cast<std::uint32_t>( outputs.size( ) ) );
+				link( state_count );
+			}
+
+			[[nodiscard]] bool has_outputs( state_t state ) const {
+				return output_first[state] != output_first[state + 1];
+			}
+
+			/// Breadth first, each state's failure state is shallower and already
+			/// has its row complete.  A missing transition is the transition of the
+			/// failure state, and a trie edge's target fails to where the failure
+			/// state goes on the same byte
+			void link( std::size_t state_count ) {
+				auto fail = std::vector<state_t>( state_count, 0 );
+				output_link.assign( state_count, no_state );
+				accepting.assign( state_count, 0 );
+				auto queue = std::vector<state_t>{ 0 };
+				for( std::size_t n = 0; n < queue.size( ); ++n ) {
+					auto const state = queue[n];
+					auto const row = state * class_count;
+					auto const fail_row = fail[state] * class_count;
+					for( std::size_t cls = 0; cls < class_count; ++cls ) {
+						auto const child = next[row + cls];
+						if( child == 0 ) {
+							next[row + cls] = state == 0 ? 0 : next[fail_row + cls];
+							continue;
+						}
+						auto const child_fail = state == 0 ? 0 : next[fail_row + cls];
+						fail[child] = child_fail;
+						output_link[child] =
+						  has_outputs( child_fail ) ? child_fail : output_link[child_fail];
+						accepting[child] = static_cast<std::uint8_t>(
+						  has_outputs( child ) or accepting[child_fail] );
+						queue.push_back( child );
+					}
+				}
+			}
+
+			[[nodiscard]] state_t step( state_t state, char c ) const {
+				return next[state * class_count +
+				            byte_class[static_cast<unsigned char>( c )]];
+			}
+		};
+	} // namespace keyword_details
+
+	keyword_set::keyword_set( )
+	  : keyword_set( std::vector<std::string>{ } ) {}
+
+	keyword_set::keyword_set( std::vector<std::string> keywords )
+	  : m_automaton( std::make_shared<keyword_details::automaton const>(
+	      std::move( keywords ) ) ) {}
+
+	keyword_set::keyword_set( std::initializer_list<daw::string_view> keywords )
+	  : keyword_set( to_strings( keywords ) ) {}
+
+	std::size_t keyword_set::size( ) const noexcept {
+		return m_automaton->keywords.size( );
+	}
+
+	daw::string_view keyword_set::keyword( std::size_t index ) const {
+		auto const &result = m_automaton->keywords[index];
+		return daw::string_view( result.data( ), result.size( ) );
+	}
+
+	bool keyword_set::contains_any( daw::string_view text ) const {
+		auto const &ac = *m_automaton;
+		keyword_details::state_t state = 0;
+		for( char c : text ) {
+			state = ac.step( state, c );
+			if( ac.accepting[state] ) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	std::size_t
+	keyword_set::find_all( daw::string_view text,
+	                       std::vector<keyword_match> &matches ) const {
+		auto const &ac = *m_automaton;
+		auto const old_size = matches.size( );
+		keyword_details::state_t state = 0;
+		for( std::size_t pos = 0; pos < text.size( ); ++pos ) {
+			state = ac.step( state, text[pos] );
+			if( not ac.accepting[state] ) {
+				continue;
+			}
+			auto out = ac.has_outputs( state ) ? state : ac.output_link[state];
+			while( out != keyword_details::no_state ) {
+				for( auto n = ac.output_first[out]; n != ac.output_first[out + 1];
+				     ++n ) {
+					auto const keyword = ac.outputs[n];
+					matches.push_back( keyword_match{
+					  keyword, pos + 1 - ac.keywords[keyword].size( ) } );
+				}
+				out = ac.output_link[out];
+			}
+		}
+		return matches.size( ) - old_size;
+	}
+
+	std::vector<keyword_match>
+	keyword_set::find_all( daw::string_view text ) const {
+		auto result = std::vector<keyword_match>{ };
+		(void)find_all( text, result );
+		return result;
+	}
+} // namespace daw::gumbo
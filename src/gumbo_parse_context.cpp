@@ -0,0 +1,65 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_parse_context.h>
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <gumbo.h>
+#include <string>
+
+namespace daw::gumbo {
+	namespace {
+		// Rough ratio of arena memory to document size seen with typical pages
+		constexpr std::size_t arena_bytes_per_document_byte = 12U;
+	} // namespace
+
+	parse_context::parse_context( std::size_t max_retained_bytes,
+	                              GumboOptions const &options )
+	  : m_arena( )
+	  , m_options( options ) {
+		m_arena.set_max_retained( max_retained_bytes );
+	}
+
+	gumbo_range parse_context::parse( daw::string_view html_document ) {
+		return gumbo_range( html_document, m_arena, m_options );
+	}
+
+	void
+	parse_context::set_max_retained_bytes( std::size_t max_retained_bytes ) noexcept {
+		m_arena.set_max_retained( max_retained_bytes );
+		if( m_arena.live_outputs( ) == 0 and
+		    m_arena.capacity( ) > max_retained_bytes ) {
+			m_arena.shrink_to( max_retained_bytes );
+		}
+	}
+
+	void parse_context::reserve( std::size_t document_size ) {
+		auto const arena_size = document_size * arena_bytes_per_document_byte;
+		if( arena_size <= m_arena.max_retained( ) ) {
+			m_arena.reserve( arena_size );
+		}
+		if( document_size <= m_arena.max_retained( ) ) {
+			m_scratch.reserve( document_size );
+		}
+	}
+
+	std::string &parse_context::scratch_buffer( ) {
+		if( m_scratch.capacity( ) > m_arena.max_retained( ) ) {
+			std::string( ).swap( m_scratch );
+		}
+		m_scratch.clear( );
+		return m_scratch;
+	}
+
+	parse_context &parse_context::this_thread( ) {
+		static thread_local parse_context ctx{ };
+		return ctx;
+	}
+} // namespace daw::gumbo
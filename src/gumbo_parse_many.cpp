@@ -0,0 +1,111 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_parse_many.h>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace daw::gumbo {
+	parse_executor::parse_executor( std::size_t thread_count ) {
+		if( thread_count < 2 ) {
+			return;
+		}
+		m_threads.reserve( thread_count - 1U );
+		for( std::size_t n = 1; n < thread_count; ++n ) {
+			m_threads.emplace_back( [this] {
+				worker( );
+			} );
+		}
+	}
+
+	parse_executor::~parse_executor( ) {
+		{
+			auto const lck = std::lock_guard( m_mutex );
+			m_stop = true;
+		}
+		m_work_cv.notify_all( );
+		for( auto &t : m_threads ) {
+			t.join( );
+		}
+	}
+
+	void
+	parse_executor::run_items( std::function<void( std::size_t )> const &job,
+	                           std::size_t count ) {
+		while( true ) {
+			auto const n = m_next.fetch_add( 1, std::memory_order_relaxed );
+			if( n >= count ) {
+				return;
+			}
+			try {
+				job( n );
+			} catch( ... ) {
+				auto const lck = std::lock_guard( m_mutex );
+				if( not m_exception ) {
+					m_exception = std::current_exception( );
+				}
+			}
+		}
+	}
+
+	void parse_executor::worker( ) {
+		std::size_t seen_generation = 0;
+		auto lck = std::unique_lock( m_mutex );
+		while( true ) {
+			m_work_cv.wait( lck, [&] {
+				return m_stop or m_generation != seen_generation;
+			} );
+			if( m_stop ) {
+				return;
+			}
+			seen_generation = m_generation;
+			auto const *job = m_job;
+			if( not job ) {
+				// Woke after the batch had already completed
+				continue;
+			}
+			auto const count = m_count;
+			++m_active;
+			lck.unlock( );
+			run_items( *job, count );
+			lck.lock( );
+			if( --m_active == 0 ) {
+				m_done_cv.notify_all( );
+			}
+		}
+	}
+
+	void parse_executor::bulk( std::size_t count,
+	                           std::function<void( std::size_t )> const &job ) {
+		if( count == 0 ) {
+			return;
+		}
+		{
+			auto const lck = std::lock_guard( m_mutex );
+			m_job = &job;
+			m_count = count;
+			m_next.store( 0, std::memory_order_relaxed );
+			m_exception = nullptr;
+			++m_generation;
+		}
+		m_work_cv.notify_all( );
+		run_items( job, count );
+		auto lck = std::unique_lock( m_mutex );
+		m_done_cv.wait( lck, [&] {
+			return m_active == 0;
+		} );
+		m_job = nullptr;
+		if( auto ex = std::exchange( m_exception, nullptr ); ex ) {
+			std::rethrow_exception( ex );
+		}
+	}
+} // namespace daw::gumbo
@@ -9,10 +9,18 @@
 #include <daw/gumbo_pp.h>
 #include <daw/gumbo_pp/details/gumbo_pp.h>
 
+#include "daw/gumbo_pp/gumbo_encoding.h"
 #include "daw/gumbo_pp/gumbo_node_iterator.h"
+#include <daw/daw_memory_mapped_file.h>
 #include <daw/daw_string_view.h>
 
+#include <filesystem>
 #include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
 #include <utility>
 
 namespace daw::gumbo::details {
@@ -22,17 +30,106 @@ namespace daw::gumbo::details {
 
 namespace daw::gumbo {
 	gumbo_range::gumbo_range( GumboHandle &&handle )
-	  : m_handle( std::move( handle ) ) {}
+	  : m_handle( std::move( handle ) )
+	  , m_first( m_handle ? m_handle->root : nullptr ) {}
+
+	gumbo_range::gumbo_range( GumboHandle &&handle,
+	                          daw::string_view html_document )
+	  : m_html( html_document )
+	  , m_handle( std::move( handle ) )
+	  , m_first( m_handle ? m_handle->root : nullptr ) {}
+
+	gumbo_range::gumbo_range( std::shared_ptr<void const> source,
+	                          daw::string_view html_document,
+	                          GumboOptions options )
+	  : m_source( std::move( source ) )
+	  , m_html( html_document )
+	  , m_handle( gumbo_parse_with_options(
+	      &options, html_document.data( ), html_document.size( ) ) )
+	  , m_first( m_handle->root ) {}
 
 	gumbo_range::gumbo_range( daw::string_view html_document,
 	                          GumboOptions options )
-	  : m_handle( gumbo_parse_with_options(
+	  : m_html( html_document )
+	  , m_handle( gumbo_parse_with_options(
 	      &options, html_document.data( ), html_document.size( ) ) )
 	  , m_first( m_handle->root ) {}
 
 	gumbo_range::gumbo_range( daw::string_view html_document )
 	  : gumbo_range( html_document, kGumboDefaultOptions ) {}
 
+	namespace {
+		[[nodiscard]] GumboHandle parse_into_arena( daw::string_view html_document,
+		                                            gumbo_arena &arena,
+		                                            GumboOptions options ) {
+			options = arena.options( options );
+			GumboOutput *output = gumbo_parse_with_options(
+			  &options, html_document.data( ), html_document.size( ) );
+			if( output ) {
+				arena.add_output( );
+			}
+			return GumboHandle( output, GumboDeleter( arena ) );
+		}
+	} // namespace
+
+	gumbo_range::gumbo_range( daw::string_view html_document,
+	                          gumbo_arena &arena,
+	                          GumboOptions options )
+	  : m_html( html_document )
+	  , m_handle( parse_into_arena( html_document, arena, options ) )
+	  , m_first( m_handle->root ) {}
+
+	gumbo_range::gumbo_range( daw::string_view html_document,
+	                          gumbo_arena &arena )
+	  : gumbo_range( html_document, arena, kGumboDefaultOptions ) {}
+
+	gumbo_range gumbo_range::head_only( daw::string_view html_document,
+	                                    std::size_t max_prefix,
+	                                    GumboOptions options ) {
+		return gumbo_range( head_section_prefix( html_document, max_prefix ),
+		                    options );
+	}
+
+	gumbo_range gumbo_range::from_bytes( daw::string_view raw_document,
+	                                     GumboOptions options ) {
+		// to_utf8 only writes to the buffer when it transcodes, so UTF-8 input
+		// does not allocate
+		auto buffer = std::string( );
+		auto const decoded = to_utf8( raw_document, buffer );
+		if( decoded.encoding == html_encoding::unsupported ) {
+			throw std::runtime_error( "Unsupported document encoding" );
+		}
+		if( not decoded.transcoded ) {
+			return gumbo_range( decoded.html, options );
+		}
+		auto owned = std::make_shared<std::string>( std::move( buffer ) );
+		auto const html_document =
+		  daw::string_view( owned->data( ), owned->size( ) );
+		return gumbo_range( std::move( owned ), html_document, options );
+	}
+
+	gumbo_range gumbo_range::from_file( daw::string_view path,
+	                                    GumboOptions options ) {
+		using mapping_t = daw::filesystem::memory_mapped_file_t<char>;
+		auto mapping = std::make_shared<mapping_t>(
+		  std::string_view( path.data( ), path.size( ) ) );
+		if( not *mapping ) {
+			// An empty file cannot be mapped but is still a valid, empty, document
+			auto ec = std::error_code( );
+			auto const file_path =
+			  std::filesystem::path( std::string_view( path.data( ), path.size( ) ) );
+			if( std::filesystem::is_regular_file( file_path, ec ) and
+			    std::filesystem::file_size( file_path, ec ) == 0 and not ec ) {
+				return gumbo_range( daw::string_view( "" ), options );
+			}
+			throw std::runtime_error( "Unable to memory map file: " +
+			                          static_cast<std::string>( path ) );
+		}
+		auto const html_document =
+		  daw::string_view( mapping->data( ), mapping->size( ) );
+		return gumbo_range( std::move( mapping ), html_document, options );
+	}
+
 	namespace {
 		[[nodiscard]] gumbo_node_iterator_t
 		get_first_child( GumboNode const &parent_node ) {
@@ -57,4 +154,8 @@ namespace daw::gumbo {
 	gumbo_child_range::gumbo_child_range( GumboNode const &parent_node )
 	  : m_first( get_first_child( parent_node ) )
 	  , m_last( get_last_child( parent_node ) ) {}
+
+	gumbo_descendant_range::gumbo_descendant_range( GumboNode const &node )
+	  : m_first( std::next( gumbo_node_iterator_t( node ) ) )
+	  , m_last( subtree_end( node ) ) {}
 } // namespace daw::gumbo
@@ -0,0 +1,882 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_selector.h>
+#include <daw/gumbo_pp/gumbo_util.h>
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace daw::gumbo {
+	css_selector_error::css_selector_error( std::string const &message,
+	                                        std::size_t position )
+	  : std::runtime_error( "Invalid selector: " + message + " at offset " +
+	                        std::to_string( position ) )
+	  , m_position( position ) {}
+
+	namespace {
+		using namespace selector_details;
+		using util_details::ascii_lower;
+
+		[[nodiscard]] bool is_ident_char( char c ) noexcept {
+			return ( c >= 'a' and c <= 'z' ) or ( c >= 'A' and c <= 'Z' ) or
+			       ( c >= '0' and c <= '9' ) or c == '-' or c == '_' or
+			       static_cast<unsigned char>( c ) >= 0x80U;
+		}
+
+		[[nodiscard]] bool iequal( daw::string_view lhs,
+		                           daw::string_view rhs ) noexcept {
+			if( lhs.size( ) != rhs.size( ) ) {
+				return false;
+			}
+			for( std::size_t n = 0; n < lhs.size( ); ++n ) {
+				if( ascii_lower( lhs[n] ) != ascii_lower( rhs[n] ) ) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		[[nodiscard]] std::string to_lower( std::string str ) {
+			for( char &c : str ) {
+				c = ascii_lower( c );
+			}
+			return str;
+		}
+
+		/// Recursive descent parser for selector lists.  Errors are reported
+		/// with the offset they were found at
+		class selector_parser {
+			daw::string_view m_sel;
+			std::size_t m_pos = 0;
+
+			[[noreturn]] void fail( char const *message ) const {
+				throw css_selector_error( message, m_pos );
+			}
+
+			[[nodiscard]] bool at_end( ) const noexcept {
+				return m_pos >= m_sel.size( );
+			}
+
+			[[nodiscard]] char peek( ) const noexcept {
+				return at_end( ) ? '\0' : m_sel[m_pos];
+			}
+
+			/// Skip whitespace, returning whether there was any
+			bool skip_space( ) noexcept {
+				auto const start = m_pos;
+				while( not at_end( ) and is_html_space( m_sel[m_pos] ) ) {
+					++m_pos;
+				}
+				return m_pos != start;
+			}
+
+			void expect( char c, char const *message ) {
+				if( peek( ) != c ) {
+					fail( message );
+				}
+				++m_pos;
+			}
+
+			[[nodiscard]] bool at_identifier( ) const noexcept {
+				return not at_end( ) and
+				       ( is_ident_char( m_sel[m_pos] ) or m_sel[m_pos] == '\\' );
+			}
+
+			/// An identifier.  A backslash takes the next character literally
+			std::string identifier( ) {
+				if( not at_identifier( ) ) {
+					fail( "Expected an identifier" );
+				}
+				std::string result{ };
+				while( not at_end( ) ) {
+					char const c = m_sel[m_pos];
+					if( c == '\\' ) {
+						if( m_pos + 1U >= m_sel.size( ) ) {
+							fail( "Incomplete escape" );
+						}
+						result.push_back( m_sel[m_pos + 1U] );
+						m_pos += 2U;
+					} else if( is_ident_char( c ) ) {
+						result.push_back( c );
+						++m_pos;
+					} else {
+						break;
+					}
+				}
+				return result;
+			}
+
+			std::string quoted_string( ) {
+				char const quote = m_sel[m_pos++];
+				std::string result{ };
+				while( not at_end( ) and m_sel[m_pos] != quote ) {
+					if( m_sel[m_pos] == '\\' and m_pos + 1U < m_sel.size( ) ) {
+						++m_pos;
+					}
+					result.push_back( m_sel[m_pos++] );
+				}
+				expect( quote, "Unterminated string" );
+				return result;
+			}
+
+			void attribute( compound &c ) {
+				++m_pos;
+				skip_space( );
+				auto test = attribute_test{ };
+				test.name = to_lower( identifier( ) );
+				skip_space( );
+				if( peek( ) == ']' ) {
+					++m_pos;
+					c.attributes.push_back( std::move( test ) );
+					return;
+				}
+				switch( peek( ) ) {
+				case '=':
+					test.op = attribute_op::equals;
+					break;
+				case '~':
+					test.op = attribute_op::includes;
+					break;
+				case '|':
+					test.op = attribute_op::dash_match;
+					break;
+				case '^':
+					test.op = attribute_op::prefix;
+					break;
+				case '$':
+					test.op = attribute_op::suffix;
+					break;
+				case '*':
+					test.op = attribute_op::substring;
+					break;
+				default:
+					fail( "Expected an attribute operator" );
+				}
+				if( test.op != attribute_op::equals ) {
+					++m_pos;
+				}
+				expect( '=', "Expected = in attribute operator" );
+				skip_space( );
+				if( peek( ) == '"' or peek( ) == '\'' ) {
+					test.value = quoted_string( );
+				} else {
+					test.value = identifier( );
+				}
+				skip_space( );
+				if( peek( ) == 'i' or peek( ) == 'I' ) {
+					test.ignore_case = true;
+					++m_pos;
+					skip_space( );
+				} else if( peek( ) == 's' or peek( ) == 'S' ) {
+					++m_pos;
+					skip_space( );
+				}
+				expect( ']', "Expected ]" );
+				c.attributes.push_back( std::move( test ) );
+			}
+
+			[[nodiscard]] std::int32_t integer( ) {
+				if( at_end( ) or m_sel[m_pos] < '0' or m_sel[m_pos] > '9' ) {
+					fail( "Expected a number" );
+				}
+				std::int32_t result = 0;
+				while( not at_end( ) and m_sel[m_pos] >= '0' and m_sel[m_pos] <= '9' ) {
+					if( result > 100'000'000 ) {
+						fail( "Number is too large" );
+					}
+					result = result * 10 + ( m_sel[m_pos] - '0' );
+					++m_pos;
+				}
+				return result;
+			}
+
+			/// The argument of the nth pseudo classes: odd, even or an+b
+			void nth( pseudo_test &test ) {
+				skip_space( );
+				bool const is_keyword = at_identifier( ) and
+				                        ascii_lower( peek( ) ) != 'n' and
+				                        peek( ) != '-' and
+				                        ( peek( ) < '0' or peek( ) > '9' );
+				if( is_keyword ) {
+					auto const start = m_pos;
+					auto const name = to_lower( identifier( ) );
+					if( name == "odd" ) {
+						test.a = 2;
+						test.b = 1;
+					} else if( name == "even" ) {
+						test.a = 2;
+						test.b = 0;
+					} else {
+						m_pos = start;
+						fail( "Expected odd, even or an+b" );
+					}
+					skip_space( );
+					return;
+				}
+				std::int32_t sign = 1;
+				if( peek( ) == '+' or peek( ) == '-' ) {
+					sign = peek( ) == '-' ? -1 : 1;
+					++m_pos;
+				}
+				std::int32_t number = 1;
+				bool const has_number = peek( ) >= '0' and peek( ) <= '9';
+				if( has_number ) {
+					number = integer( );
+				}
+				if( ascii_lower( peek( ) ) != 'n' ) {
+					if( not has_number ) {
+						fail( "Expected an+b" );
+					}
+					test.a = 0;
+					test.b = sign * number;
+					skip_space( );
+					return;
+				}
+				++m_pos;
+				test.a = sign * number;
+				skip_space( );
+				if( peek( ) == '+' or peek( ) == '-' ) {
+					std::int32_t const b_sign = peek( ) == '-' ? -1 : 1;
+					++m_pos;
+					skip_space( );
+					test.b = b_sign * integer( );
+					skip_space( );
+				}
+			}
+
+			/// The compound selectors of :is( ) and :not( )
+			void compound_list( pseudo_test &test ) {
+				skip_space( );
+				while( true ) {
+					test.selectors.push_back( compound_selector( ) );
+					skip_space( );
+					if( peek( ) != ',' ) {
+						break;
+					}
+					++m_pos;
+					skip_space( );
+				}
+				if( peek( ) != ')' ) {
+					fail( "Only compound selectors are supported in :is( ) and :not( )" );
+				}
+			}
+
+			void pseudo_class( compound &c ) {
+				++m_pos;
+				if( peek( ) == ':' ) {
+					fail( "Pseudo elements are not supported" );
+				}
+				auto const start = m_pos;
+				auto const name = to_lower( identifier( ) );
+				auto test = pseudo_test{ };
+				bool has_argument = false;
+				if( name == "root" ) {
+					test.kind = pseudo_kind::root;
+				} else if( name == "empty" ) {
+					test.kind = pseudo_kind::empty;
+				} else if( name == "first-child" ) {
+					test.kind = pseudo_kind::nth_child;
+					test.b = 1;
+				} else if( name == "last-child" ) {
+					test.kind = pseudo_kind::nth_last_child;
+					test.b = 1;
+				} else if( name == "only-child" ) {
+					test.kind = pseudo_kind::only_child;
+				} else if( name == "first-of-type" ) {
+					test.kind = pseudo_kind::nth_of_type;
+					test.b = 1;
+				} else if( name == "last-of-type" ) {
+					test.kind = pseudo_kind::nth_last_of_type;
+					test.b = 1;
+				} else if( name == "only-of-type" ) {
+					test.kind = pseudo_kind::only_of_type;
+				} else if( name == "nth-child" ) {
+					test.kind = pseudo_kind::nth_child;
+					has_argument = true;
+				} else if( name == "nth-last-child" ) {
+					test.kind = pseudo_kind::nth_last_child;
+					has_argument = true;
+				} else if( name == "nth-of-type" ) {
+					test.kind = pseudo_kind::nth_of_type;
+					has_argument = true;
+				} else if( name == "nth-last-of-type" ) {
+					test.kind = pseudo_kind::nth_last_of_type;
+					has_argument = true;
+				} else if( name == "is" or name == "where" ) {
+					test.kind = pseudo_kind::is;
+					has_argument = true;
+				} else if( name == "not" ) {
+					test.kind = pseudo_kind::not_;
+					has_argument = true;
+				} else {
+					m_pos = start;
+					fail( "Unsupported pseudo class" );
+				}
+				if( has_argument ) {
+					expect( '(', "Expected (" );
+					if( test.kind == pseudo_kind::is or test.kind == pseudo_kind::not_ ) {
+						compound_list( test );
+					} else {
+						nth( test );
+					}
+					expect( ')', "Expected )" );
+				}
+				c.pseudos.push_back( std::move( test ) );
+			}
+
+			compound compound_selector( ) {
+				auto result = compound{ };
+				bool has_selector = false;
+				if( peek( ) == '*' ) {
+					++m_pos;
+					has_selector = true;
+				} else if( at_identifier( ) ) {
+					result.tag_name = to_lower( identifier( ) );
+					result.tag = gumbo_tagn_enum(
+					  result.tag_name.data( ),
+					  static_cast<unsigned>( result.tag_name.size( ) ) );
+					if( result.tag != GUMBO_TAG_UNKNOWN ) {
+						result.tag_name.clear( );
+					}
+					has_selector = true;
+				}
+				while( true ) {
+					switch( peek( ) ) {
+					case '#': {
+						++m_pos;
+						result.attributes.push_back( attribute_test{
+						  "id", identifier( ), attribute_op::equals, false } );
+						break;
+					}
+					case '.': {
+						++m_pos;
+						result.attributes.push_back( attribute_test{
+						  "class", identifier( ), attribute_op::includes, false } );
+						break;
+					}
+					case '[':
+						attribute( result );
+						break;
+					case ':':
+						pseudo_class( result );
+						break;
+					default:
+						if( not has_selector ) {
+							fail( "Expected a selector" );
+						}
+						return result;
+					}
+					has_selector = true;
+				}
+			}
+
+			complex_selector complex( ) {
+				auto result = complex_selector{ };
+				result.compounds.push_back( compound_selector( ) );
+				while( true ) {
+					bool const had_space = skip_space( );
+					if( at_end( ) or peek( ) == ',' ) {
+						return result;
+					}
+					auto next = combinator::descendant;
+					switch( peek( ) ) {
+					case '>':
+						next = combinator::child;
+						break;
+					case '+':
+						next = combinator::adjacent;
+						break;
+					case '~':
+						next = combinator::sibling;
+						break;
+					default:
+						if( not had_space ) {
+							fail( "Unexpected character" );
+						}
+						break;
+					}
+					if( next != combinator::descendant ) {
+						++m_pos;
+						skip_space( );
+					}
+					result.compounds.back( ).next = next;
+					result.compounds.push_back( compound_selector( ) );
+				}
+			}
+
+		public:
+			explicit selector_parser( daw::string_view sel ) noexcept
+			  : m_sel( sel ) {}
+
+			std::vector<complex_selector> parse( ) {
+				std::vector<complex_selector> result{ };
+				skip_space( );
+				while( true ) {
+					result.push_back( complex( ) );
+					if( at_end( ) ) {
+						return result;
+					}
+					expect( ',', "Expected ," );
+					skip_space( );
+				}
+			}
+		};
+
+		[[nodiscard]] bool is_element( GumboNode const &node ) noexcept {
+			return node.type == GUMBO_NODE_ELEMENT or
+			       node.type == GUMBO_NODE_TEMPLATE;
+		}
+
+		/// The tag name as written in the source, for tags gumbo does not know
+		[[nodiscard]] daw::string_view original_tag_name( GumboNode const &node ) {
+			auto const &tag = node.v.element.original_tag;
+			auto const text = daw::string_view( tag.data, tag.length );
+			std::size_t first = 0;
+			while( first < text.size( ) and ( text[first] == '<' or
+			                                  text[first] == '/' ) ) {
+				++first;
+			}
+			auto last = first;
+			while( last < text.size( ) and not is_html_space( text[last] ) and
+			       text[last] != '/' and text[last] != '>' ) {
+				++last;
+			}
+			return text.substr( first, last - first );
+		}
+
+		[[nodiscard]] bool same_type( GumboNode const &lhs,
+		                              GumboNode const &rhs ) {
+			if( lhs.v.element.tag != rhs.v.element.tag ) {
+				return false;
+			}
+			return lhs.v.element.tag != GUMBO_TAG_UNKNOWN or
+			       iequal( original_tag_name( lhs ), original_tag_name( rhs ) );
+		}
+
+		struct sibling_position {
+			std::uint32_t index = 1;
+			std::uint32_t count = 1;
+		};
+
+		/// The 1 based position of node among its element siblings, or among
+		/// those of the same type
+		[[nodiscard]] sibling_position position_of( GumboNode const &node,
+		                                            bool of_type ) {
+			auto result = sibling_position{ 0, 0 };
+			GumboNode const *parent = node.parent;
+			if( not parent ) {
+				return sibling_position{ };
+			}
+			auto const child_count = get_children_count( *parent );
+			for( std::size_t n = 0; n < child_count; ++n ) {
+				GumboNode const &child = *get_child_node_at( *parent, n );
+				if( not is_element( child ) or
+				    ( of_type and not same_type( child, node ) ) ) {
+					continue;
+				}
+				++result.count;
+				if( &child == &node ) {
+					result.index = result.count;
+				}
+			}
+			return result;
+		}
+
+		/// Remembers the sibling positions of the children of each parent seen,
+		/// so that checking the nth pseudo classes on every child of a parent is
+		/// linear in the number of children instead of quadratic
+		class match_context {
+			struct cached_position {
+				sibling_position child;
+				sibling_position of_type;
+			};
+
+			std::unordered_map<GumboNode const *, cached_position> m_positions{ };
+			std::vector<std::uint32_t> m_type_counts =
+			  std::vector<std::uint32_t>( GUMBO_TAG_LAST + 1U );
+
+			void add_children( GumboNode const &parent ) {
+				auto const child_count = get_children_count( parent );
+				std::uint32_t element_count = 0;
+				for( std::size_t n = 0; n < child_count; ++n ) {
+					GumboNode const &child = *get_child_node_at( parent, n );
+					if( is_element( child ) ) {
+						auto const type_index = ++m_type_counts[child.v.element.tag];
+						m_positions[&child] =
+						  cached_position{ { ++element_count, 0 }, { type_index, 0 } };
+					}
+				}
+				for( std::size_t n = 0; n < child_count; ++n ) {
+					GumboNode const &child = *get_child_node_at( parent, n );
+					if( is_element( child ) ) {
+						auto &pos = m_positions[&child];
+						pos.child.count = element_count;
+						pos.of_type.count = m_type_counts[child.v.element.tag];
+					}
+				}
+				for( std::size_t n = 0; n < child_count; ++n ) {
+					GumboNode const &child = *get_child_node_at( parent, n );
+					if( is_element( child ) ) {
+						m_type_counts[child.v.element.tag] = 0;
+					}
+				}
+			}
+
+		public:
+			[[nodiscard]] sibling_position position( GumboNode const &node,
+			                                         bool of_type ) {
+				// Unknown tags are all GUMBO_TAG_UNKNOWN, their type is the name
+				if( not node.parent or
+				    ( of_type and node.v.element.tag == GUMBO_TAG_UNKNOWN ) ) {
+					return position_of( node, of_type );
+				}
+				auto pos = m_positions.find( &node );
+				if( pos == m_positions.end( ) ) {
+					add_children( *node.parent );
+					pos = m_positions.find( &node );
+				}
+				return of_type ? pos->second.of_type : pos->second.child;
+			}
+		};
+
+		/// Sibling positions from the context when there is one
+		[[nodiscard]] sibling_position
+		position_of( GumboNode const &node, bool of_type, match_context *ctx ) {
+			if( ctx ) {
+				return ctx->position( node, of_type );
+			}
+			return position_of( node, of_type );
+		}
+
+		[[nodiscard]] constexpr bool nth_matches( std::int32_t a,
+		                                          std::int32_t b,
+		                                          std::int32_t position ) {
+			if( a == 0 ) {
+				return position == b;
+			}
+			auto const diff = position - b;
+			return diff % a == 0 and diff / a >= 0;
+		}
+
+		[[nodiscard]] bool is_empty_element( GumboNode const &node ) {
+			auto const child_count = get_children_count( node );
+			for( std::size_t n = 0; n < child_count; ++n ) {
+				if( get_child_node_at( node, n )->type != GUMBO_NODE_COMMENT ) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		[[nodiscard]] bool compound_matches( compound const &c,
+		                                     GumboNode const &node,
+		                                     match_context *ctx );
+
+		[[nodiscard]] bool pseudo_matches( pseudo_test const &test,
+		                                   GumboNode const &node,
+		                                   match_context *ctx ) {
+			auto const nth = [&]( bool of_type, bool from_end ) {
+				auto const pos = position_of( node, of_type, ctx );
+				auto const index =
+				  static_cast<std::int32_t>( from_end ? pos.count - pos.index + 1U
+				                                      : pos.index );
+				return nth_matches( test.a, test.b, index );
+			};
+			switch( test.kind ) {
+			case pseudo_kind::nth_child:
+				return nth( false, false );
+			case pseudo_kind::nth_last_child:
+				return nth( false, true );
+			case pseudo_kind::nth_of_type:
+				return nth( true, false );
+			case pseudo_kind::nth_last_of_type:
+				return nth( true, true );
+			case pseudo_kind::only_child:
+				return position_of( node, false, ctx ).count == 1U;
+			case pseudo_kind::only_of_type:
+				return position_of( node, true, ctx ).count == 1U;
+			case pseudo_kind::empty:
+				return is_empty_element( node );
+			case pseudo_kind::root:
+				return node.parent and node.parent->type == GUMBO_NODE_DOCUMENT;
+			case pseudo_kind::is:
+			case pseudo_kind::not_: {
+				bool found = false;
+				for( compound const &sel : test.selectors ) {
+					if( compound_matches( sel, node, ctx ) ) {
+						found = true;
+						break;
+					}
+				}
+				return test.kind == pseudo_kind::is ? found : not found;
+			}
+			}
+			return false;
+		}
+
+		[[nodiscard]] bool attribute_matches( attribute_test const &test,
+		                                      GumboNode const &node ) {
+			GumboAttribute const *attr =
+			  gumbo_get_attribute( &node.v.element.attributes, test.name.c_str( ) );
+			if( not attr ) {
+				return false;
+			}
+			auto const value = daw::string_view( attr->value );
+			auto const expected =
+			  daw::string_view( test.value.data( ), test.value.size( ) );
+			auto const equal = [&]( daw::string_view lhs ) {
+				return test.ignore_case ? iequal( lhs, expected ) : lhs == expected;
+			};
+			switch( test.op ) {
+			case attribute_op::exists:
+				return true;
+			case attribute_op::equals:
+				return equal( value );
+			case attribute_op::includes: {
+				bool found = false;
+				for_each_class_token( value, [&]( daw::string_view token ) {
+					found = found or equal( token );
+				} );
+				return found;
+			}
+			case attribute_op::dash_match:
+				return equal( value ) or
+				       ( value.size( ) > expected.size( ) and
+				         value[expected.size( )] == '-' and
+				         equal( value.substr( 0, expected.size( ) ) ) );
+			case attribute_op::prefix:
+				return not expected.empty( ) and value.size( ) >= expected.size( ) and
+				       equal( value.substr( 0, expected.size( ) ) );
+			case attribute_op::suffix:
+				return not expected.empty( ) and value.size( ) >= expected.size( ) and
+				       equal( value.substr( value.size( ) - expected.size( ) ) );
+			case attribute_op::substring:
+				if( expected.empty( ) or value.size( ) < expected.size( ) ) {
+					return false;
+				}
+				for( std::size_t n = 0; n + expected.size( ) <= value.size( ); ++n ) {
+					if( equal( value.substr( n, expected.size( ) ) ) ) {
+						return true;
+					}
+				}
+				return false;
+			}
+			return false;
+		}
+
+		bool compound_matches( compound const &c,
+		                       GumboNode const &node,
+		                       match_context *ctx ) {
+			if( not is_element( node ) ) {
+				return false;
+			}
+			if( c.tag != GUMBO_TAG_LAST ) {
+				if( node.v.element.tag != c.tag ) {
+					return false;
+				}
+				if( c.tag == GUMBO_TAG_UNKNOWN and
+				    not iequal( original_tag_name( node ), c.tag_name ) ) {
+					return false;
+				}
+			}
+			for( attribute_test const &test : c.attributes ) {
+				if( not attribute_matches( test, node ) ) {
+					return false;
+				}
+			}
+			for( pseudo_test const &test : c.pseudos ) {
+				if( not pseudo_matches( test, node, ctx ) ) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// The element a combinator leads to from node, going right to left
+		[[nodiscard]] GumboNode const *step( GumboNode const &node,
+		                                     combinator comb ) {
+			switch( comb ) {
+			case combinator::descendant:
+			case combinator::child: {
+				GumboNode const *parent = node.parent;
+				if( parent and is_element( *parent ) ) {
+					return parent;
+				}
+				return nullptr;
+			}
+			case combinator::adjacent:
+			case combinator::sibling: {
+				GumboNode const *parent = node.parent;
+				if( not parent ) {
+					return nullptr;
+				}
+				for( auto idx = node.index_within_parent; idx > 0; --idx ) {
+					GumboNode const *sibling = get_child_node_at( *parent, idx - 1U );
+					if( is_element( *sibling ) ) {
+						return sibling;
+					}
+				}
+				return nullptr;
+			}
+			}
+			return nullptr;
+		}
+
+		/// The outcome of matching part of a selector.  Failures say how far
+		/// back the caller must restart, so that no candidate is tried twice
+		enum class match_result {
+			matched,
+			restart_from_later_sibling,
+			restart_from_descendant,
+			not_matched_globally
+		};
+
+		/// Match the compounds up to and including idx against node, right to
+		/// left.  Descendant and general sibling combinators try each candidate
+		/// in turn, but a failure that no other candidate could fix stops the
+		/// search, which keeps matching linear in the depth of the tree
+		[[nodiscard]] match_result match_complex( complex_selector const &sel,
+		                                          std::size_t idx,
+		                                          GumboNode const &node,
+		                                          match_context *ctx ) {
+			if( not compound_matches( sel.compounds[idx], node, ctx ) ) {
+				return match_result::restart_from_later_sibling;
+			}
+			if( idx == 0 ) {
+				return match_result::matched;
+			}
+			auto const comb = sel.compounds[idx - 1U].next;
+			bool const is_sibling_combinator =
+			  comb == combinator::adjacent or comb == combinator::sibling;
+			auto const candidate_not_found =
+			  is_sibling_combinator ? match_result::restart_from_descendant
+			                        : match_result::not_matched_globally;
+			GumboNode const *next = step( node, comb );
+			while( next ) {
+				auto const result = match_complex( sel, idx - 1U, *next, ctx );
+				if( result == match_result::matched or
+				    result == match_result::not_matched_globally or
+				    comb == combinator::adjacent ) {
+					return result;
+				}
+				if( comb == combinator::child ) {
+					return match_result::restart_from_descendant;
+				}
+				if( result == match_result::restart_from_descendant and
+				    comb == combinator::sibling ) {
+					return result;
+				}
+				next = step( *next, comb );
+			}
+			return candidate_not_found;
+		}
+
+		[[nodiscard]] bool selector_matches( css_selector const &selector,
+		                                     GumboNode const &node,
+		                                     match_context *ctx ) {
+			if( not is_element( node ) ) {
+				return false;
+			}
+			for( complex_selector const &sel : selector.selectors( ) ) {
+				if( match_complex( sel, sel.compounds.size( ) - 1U, node, ctx ) ==
+				    match_result::matched ) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		[[nodiscard]] std::vector<GumboNode const *>
+		select_all( gumbo_node_iterator_t first,
+		            gumbo_node_iterator_t last,
+		            css_selector const &selector ) {
+			auto ctx = match_context( );
+			std::vector<GumboNode const *> result{ };
+			for( ; first != last; ++first ) {
+				if( selector_matches( selector, *first, &ctx ) ) {
+					result.push_back( first.get( ) );
+				}
+			}
+			return result;
+		}
+	} // namespace
+
+	css_selector::css_selector( daw::string_view selector )
+	  : m_source( selector.data( ), selector.size( ) )
+	  , m_selectors( selector_parser( selector ).parse( ) ) {}
+
+	bool css_selector::operator( )( GumboNode const &node ) const {
+		return selector_matches( *this, node, nullptr );
+	}
+
+	std::shared_ptr<css_selector const>
+	cached_selector( daw::string_view selector ) {
+		static std::mutex cache_mutex{ };
+		static std::unordered_map<std::string, std::shared_ptr<css_selector const>>
+		  cache{ };
+
+		auto key = std::string( selector.data( ), selector.size( ) );
+		{
+			auto const lck = std::lock_guard<std::mutex>( cache_mutex );
+			if( auto pos = cache.find( key ); pos != cache.end( ) ) {
+				return pos->second;
+			}
+		}
+		// Parse outside the lock.  Invalid selectors throw and are not cached
+		auto result = std::make_shared<css_selector const>( selector );
+		auto const lck = std::lock_guard<std::mutex>( cache_mutex );
+		if( cache.size( ) >= max_cached_selectors ) {
+			cache.clear( );
+		}
+		return cache.try_emplace( std::move( key ), std::move( result ) )
+		  .first->second;
+	}
+
+	std::vector<GumboNode const *> select( gumbo_range const &rng,
+	                                       daw::string_view selector ) {
+		return select( rng, *cached_selector( selector ) );
+	}
+
+	std::vector<GumboNode const *> select( gumbo_range const &rng,
+	                                       css_selector const &selector ) {
+		return select_all( rng.begin( ), rng.end( ), selector );
+	}
+
+	std::vector<GumboNode const *> select( GumboNode const &node,
+	                                       daw::string_view selector ) {
+		return select( node, *cached_selector( selector ) );
+	}
+
+	std::vector<GumboNode const *> select( GumboNode const &node,
+	                                       css_selector const &selector ) {
+		auto const rng = descendants( node );
+		return select_all( rng.begin( ), rng.end( ), selector );
+	}
+
+	GumboNode const *select_first( gumbo_range const &rng,
+	                               daw::string_view selector ) {
+		auto const sel = cached_selector( selector );
+		auto ctx = match_context( );
+		for( auto it = rng.begin( ); it != rng.end( ); ++it ) {
+			if( selector_matches( *sel, *it, &ctx ) ) {
+				return it.get( );
+			}
+		}
+		return nullptr;
+	}
+} // namespace daw::gumbo
@@ -0,0 +1,441 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_snapshot.h>
+
+#include <daw/daw_memory_mapped_file.h>
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <gumbo.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace daw::gumbo {
+	namespace {
+		constexpr char snapshot_magic[8] = {
+		  'G', 'U', 'M', 'B', 'O', 'P', 'P', 'S' };
+		constexpr std::uint32_t byte_order_mark = 0x01020304U;
+		constexpr std::uint32_t no_text = static_cast<std::uint32_t>( -1 );
+		constexpr std::size_t section_alignment = 8U;
+
+		struct header_t {
+			char magic[8];
+			std::uint32_t byte_order;
+			std::uint32_t version;
+			std::uint32_t node_count;
+			std::uint32_t attribute_count;
+			std::uint32_t root;
+			std::uint32_t reserved;
+			std::uint64_t nodes_offset;
+			std::uint64_t spans_offset;
+			std::uint64_t attributes_offset;
+			std::uint64_t strings_offset;
+			std::uint64_t strings_size;
+			std::uint64_t html_offset;
+			std::uint64_t html_size;
+		};
+
+		// Nodes are in document order, the document node first
+		struct node_t {
+			std::uint8_t type;
+			std::uint8_t reserved;
+			std::uint16_t tag;
+			std::uint32_t parent;
+			// The attributes are [attribute_first, next node's attribute_first)
+			std::uint32_t attribute_first;
+			// Offset in the string pool, no_text for elements and the document
+			std::uint32_t text;
+		};
+
+		struct span_t {
+			source_span outer;
+			source_span inner;
+		};
+
+		struct attribute_t {
+			std::uint32_t name;
+			std::uint32_t value;
+		};
+
+		static_assert( std::is_trivially_copyable_v<header_t> );
+		static_assert( std::is_trivially_copyable_v<node_t> );
+		static_assert( std::is_trivially_copyable_v<span_t> );
+		static_assert( std::is_trivially_copyable_v<attribute_t> );
+
+		[[nodiscard]] bool has_text( GumboNodeType type ) noexcept {
+			switch( type ) {
+			case GumboNodeType::GUMBO_NODE_DOCUMENT:
+			case GumboNodeType::GUMBO_NODE_ELEMENT:
+			case GumboNodeType::GUMBO_NODE_TEMPLATE:
+				return false;
+			default:
+				return true;
+			}
+		}
+
+		[[nodiscard]] bool has_children( GumboNodeType type ) noexcept {
+			return not has_text( type );
+		}
+
+		class snapshot_writer {
+			std::string m_out{ };
+
+		public:
+			[[nodiscard]] std::uint64_t align( ) {
+				m_out.resize( ( m_out.size( ) + ( section_alignment - 1U ) ) &
+				              ~( section_alignment - 1U ) );
+				return m_out.size( );
+			}
+
+			template<typename T>
+			void write( T const &value ) {
+				auto const pos = m_out.size( );
+				m_out.resize( pos + sizeof( T ) );
+				std::memcpy( m_out.data( ) + pos, &value, sizeof( T ) );
+			}
+
+			void write_bytes( daw::string_view bytes ) {
+				m_out.append( bytes.data( ), bytes.size( ) );
+			}
+
+			template<typename T>
+			void write_at( std::size_t pos, T const &value ) {
+				std::memcpy( m_out.data( ) + pos, &value, sizeof( T ) );
+			}
+
+			[[nodiscard]] std::string release( ) {
+				return std::move( m_out );
+			}
+		};
+
+		/// Deduplicated, NUL terminated strings
+		class string_pool_writer {
+			std::string m_pool{ };
+			std::unordered_map<std::string_view, std::uint32_t> m_offsets{ };
+
+		public:
+			// The keys are views of the flat_document's strings, the pool must not
+			// outlive it
+			[[nodiscard]] std::uint32_t add( daw::string_view str ) {
+				auto const key = std::string_view( str.data( ), str.size( ) );
+				if( auto pos = m_offsets.find( key ); pos != m_offsets.end( ) ) {
+					return pos->second;
+				}
+				auto const result = static_cast<std::uint32_t>( m_pool.size( ) );
+				m_pool.append( key );
+				m_pool.push_back( '\0' );
+				m_offsets.emplace( key, result );
+				return result;
+			}
+
+			[[nodiscard]] std::string const &str( ) const noexcept {
+				return m_pool;
+			}
+		};
+
+		[[noreturn]] void invalid_snapshot( char const *reason ) {
+			throw std::runtime_error( std::string( "Invalid gumbo snapshot: " ) +
+			                          reason );
+		}
+
+		template<typename T>
+		[[nodiscard]] T read_at( daw::string_view data, std::uint64_t offset ) {
+			T result;
+			std::memcpy( &result, data.data( ) + offset, sizeof( T ) );
+			return result;
+		}
+
+		[[nodiscard]] bool section_fits( daw::string_view data,
+		                                 std::uint64_t offset,
+		                                 std::uint64_t count,
+		                                 std::uint64_t element_size ) noexcept {
+			return offset <= data.size( ) and
+			       count <= ( data.size( ) - offset ) / element_size;
+		}
+
+		[[nodiscard]] bool span_fits( source_span span,
+		                              std::uint64_t html_size ) noexcept {
+			return span.first <= span.last and span.last <= html_size;
+		}
+
+		[[nodiscard]] std::uint32_t clamped_size( std::uint32_t first,
+		                                          std::uint32_t last ) noexcept {
+			return last > first ? last - first : 0U;
+		}
+	} // namespace
+
+	std::string to_snapshot( flat_document const &doc ) {
+		auto const node_count = doc.size( );
+		auto pool = string_pool_writer( );
+		auto nodes = std::vector<node_t>( );
+		auto spans = std::vector<span_t>( );
+		auto attributes = std::vector<attribute_t>( );
+		nodes.reserve( node_count );
+		spans.reserve( node_count );
+		for( flat_document::index_t n = 0; n < node_count; ++n ) {
+			auto const type = doc.type( n );
+			nodes.push_back( node_t{
+			  static_cast<std::uint8_t>( type ),
+			  0,
+			  static_cast<std::uint16_t>( doc.tag( n ) ),
+			  doc.parent( n ),
+			  static_cast<std::uint32_t>( attributes.size( ) ),
+			  has_text( type ) ? pool.add( doc.text( n ) ) : no_text } );
+			spans.push_back( span_t{ doc.outer_span( n ), doc.inner_span( n ) } );
+			auto const *last = doc.attributes_end( n );
+			for( auto const *attr = doc.attributes_begin( n ); attr != last;
+			     ++attr ) {
+				attributes.push_back(
+				  attribute_t{ pool.add( doc.attribute_name( *attr ) ),
+				               pool.add( doc.attribute_value( *attr ) ) } );
+			}
+		}
+
+		auto header = header_t{ };
+		std::memcpy( header.magic, snapshot_magic, sizeof( snapshot_magic ) );
+		header.byte_order = byte_order_mark;
+		header.version = snapshot_version;
+		header.node_count = node_count;
+		header.attribute_count = static_cast<std::uint32_t>( attributes.size( ) );
+		header.root = doc.root( );
+		header.strings_size = pool.str( ).size( );
+		header.html_size = doc.html( ).size( );
+
+		auto out = snapshot_writer( );
+		out.write( header );
+		header.nodes_offset = out.align( );
+		for( auto const &node : nodes ) {
+			out.write( node );
+		}
+		header.spans_offset = out.align( );
+		for( auto const &span : spans ) {
+			out.write( span );
+		}
+		header.attributes_offset = out.align( );
+		for( auto const &attr : attributes ) {
+			out.write( attr );
+		}
+		header.strings_offset = out.align( );
+		out.write_bytes( pool.str( ) );
+		header.html_offset = out.align( );
+		out.write_bytes( doc.html( ) );
+		// The offsets are only known now
+		out.write_at( 0, header );
+		return out.release( );
+	}
+
+	void save_snapshot( flat_document const &doc, daw::string_view path ) {
+		auto const snapshot = to_snapshot( doc );
+		auto file = std::ofstream( static_cast<std::string>( path ),
+		                           std::ios::binary | std::ios::trunc );
+		file.write( snapshot.data( ),
+		            static_cast<std::streamsize>( snapshot.size( ) ) );
+		if( not file ) {
+			throw std::runtime_error( "Unable to write snapshot: " +
+			                          static_cast<std::string>( path ) );
+		}
+	}
+
+	snapshot_document::snapshot_document( std::shared_ptr<void const> source,
+	                                      daw::string_view data )
+	  : m_source( std::move( source ) ) {
+		if( data.size( ) < sizeof( header_t ) ) {
+			invalid_snapshot( "too small" );
+		}
+		auto const header = read_at<header_t>( data, 0 );
+		if( std::memcmp( header.magic, snapshot_magic, sizeof( snapshot_magic ) ) !=
+		    0 ) {
+			invalid_snapshot( "bad magic" );
+		}
+		if( header.byte_order != byte_order_mark ) {
+			invalid_snapshot( "written with a different byte order" );
+		}
+		if( header.version != snapshot_version ) {
+			invalid_snapshot( "unsupported version" );
+		}
+		auto const node_count = header.node_count;
+		auto const attribute_count = header.attribute_count;
+		if( node_count == 0 or header.root >= node_count or
+		    not section_fits(
+		      data, header.nodes_offset, node_count, sizeof( node_t ) ) or
+		    not section_fits(
+		      data, header.spans_offset, node_count, sizeof( span_t ) ) or
+		    not section_fits( data,
+		                      header.attributes_offset,
+		                      attribute_count,
+		                      sizeof( attribute_t ) ) or
+		    not section_fits(
+		      data, header.strings_offset, header.strings_size, 1U ) or
+		    not section_fits( data, header.html_offset, header.html_size, 1U ) ) {
+			invalid_snapshot( "section out of bounds" );
+		}
+		if( header.strings_size == 0 or
+		    data[header.strings_offset + header.strings_size - 1U] != '\0' ) {
+			invalid_snapshot( "string pool is not terminated" );
+		}
+		char const *const strings = data.data( ) + header.strings_offset;
+		char const *const html = data.data( ) + header.html_offset;
+		m_html = daw::string_view( html, header.html_size );
+
+		// Read and check the tables before building anything that points into
+		// them
+		auto nodes = std::vector<node_t>( node_count );
+		auto child_counts = std::vector<std::uint32_t>( node_count, 0U );
+		for( std::uint32_t n = 0; n < node_count; ++n ) {
+			auto const node = read_at<node_t>(
+			  data, header.nodes_offset + std::uint64_t{ n } * sizeof( node_t ) );
+			auto const type = static_cast<GumboNodeType>( node.type );
+			bool const is_document = n == 0;
+			if( node.type > GumboNodeType::GUMBO_NODE_TEMPLATE or
+			    is_document != ( type == GumboNodeType::GUMBO_NODE_DOCUMENT ) or
+			    node.tag > GUMBO_TAG_LAST or
+			    node.attribute_first > attribute_count or
+			    ( n > 0 and node.attribute_first < nodes[n - 1U].attribute_first ) or
+			    has_text( type ) != ( node.text != no_text ) or
+			    ( node.text != no_text and node.text >= header.strings_size ) ) {
+				invalid_snapshot( "bad node" );
+			}
+			if( is_document ) {
+				if( node.parent != flat_document::npos ) {
+					invalid_snapshot( "bad node" );
+				}
+			} else {
+				// Nodes are in document order, parents come first
+				if( node.parent >= n or
+				    not has_children(
+				      static_cast<GumboNodeType>( nodes[node.parent].type ) ) ) {
+					invalid_snapshot( "bad node parent" );
+				}
+				++child_counts[node.parent];
+			}
+			nodes[n] = node;
+		}
+
+		// Children of each node are contiguous in m_pointers, followed by the
+		// attributes of all nodes
+		auto child_first = std::vector<std::uint32_t>( node_count, 0U );
+		std::uint32_t child_total = 0;
+		for( std::uint32_t n = 0; n < node_count; ++n ) {
+			child_first[n] = child_total;
+			child_total += child_counts[n];
+		}
+		m_pointers.resize( std::size_t{ child_total } + attribute_count );
+		m_attributes.resize( attribute_count );
+		m_nodes.resize( node_count );
+		void **const attribute_pointers = m_pointers.data( ) + child_total;
+
+		for( std::uint32_t a = 0; a < attribute_count; ++a ) {
+			auto const attr = read_at<attribute_t>(
+			  data,
+			  header.attributes_offset + std::uint64_t{ a } * sizeof( attribute_t ) );
+			if( attr.name >= header.strings_size or
+			    attr.value >= header.strings_size ) {
+				invalid_snapshot( "bad attribute" );
+			}
+			auto &result = m_attributes[a];
+			result.attr_namespace = GUMBO_ATTR_NAMESPACE_NONE;
+			result.name = strings + attr.name;
+			result.original_name = { result.name, std::strlen( result.name ) };
+			result.value = strings + attr.value;
+			result.original_value = { result.value, std::strlen( result.value ) };
+			attribute_pointers[a] = &result;
+		}
+
+		auto child_fill = std::vector<std::uint32_t>( node_count, 0U );
+		for( std::uint32_t n = 0; n < node_count; ++n ) {
+			auto const &node = nodes[n];
+			auto const span = read_at<span_t>(
+			  data, header.spans_offset + std::uint64_t{ n } * sizeof( span_t ) );
+			if( not span_fits( span.outer, header.html_size ) or
+			    not span_fits( span.inner, header.html_size ) ) {
+				invalid_snapshot( "bad source span" );
+			}
+			GumboNode &result = m_nodes[n];
+			result.type = static_cast<GumboNodeType>( node.type );
+			result.parse_flags = GUMBO_INSERTION_NORMAL;
+			if( n > 0 ) {
+				auto const parent = node.parent;
+				result.parent = &m_nodes[parent];
+				result.index_within_parent = child_fill[parent];
+				m_pointers[child_first[parent] + child_fill[parent]++] = &result;
+			}
+			auto const children = GumboVector{
+			  child_counts[n] > 0 ? m_pointers.data( ) + child_first[n] : nullptr,
+			  child_counts[n],
+			  child_counts[n] };
+			switch( result.type ) {
+			case GumboNodeType::GUMBO_NODE_DOCUMENT:
+				result.v.document.children = children;
+				result.v.document.name = "";
+				result.v.document.public_identifier = "";
+				result.v.document.system_identifier = "";
+				break;
+			case GumboNodeType::GUMBO_NODE_ELEMENT:
+			case GumboNodeType::GUMBO_NODE_TEMPLATE: {
+				auto const attribute_last = n + 1U < node_count
+				                              ? nodes[n + 1U].attribute_first
+				                              : attribute_count;
+				auto &element = result.v.element;
+				element.children = children;
+				element.tag = static_cast<GumboTag>( node.tag );
+				element.tag_namespace = GUMBO_NAMESPACE_HTML;
+				element.original_tag = {
+				  html + span.outer.first,
+				  clamped_size( span.outer.first, span.inner.first ) };
+				element.original_end_tag = {
+				  html + span.inner.last,
+				  clamped_size( span.inner.last, span.outer.last ) };
+				element.start_pos.offset = span.outer.first;
+				element.end_pos.offset = span.inner.last;
+				element.attributes = GumboVector{
+				  attribute_last > node.attribute_first
+				    ? attribute_pointers + node.attribute_first
+				    : nullptr,
+				  attribute_last - node.attribute_first,
+				  attribute_last - node.attribute_first };
+				break;
+			}
+			default: {
+				auto &text = result.v.text;
+				text.text = strings + node.text;
+				text.original_text = { html + span.outer.first, span.outer.size( ) };
+				text.start_pos.offset = span.outer.first;
+				break;
+			}
+			}
+		}
+		m_root = &m_nodes[header.root];
+	}
+
+	snapshot_document snapshot_document::from_bytes( daw::string_view data ) {
+		return snapshot_document( nullptr, data );
+	}
+
+	snapshot_document snapshot_document::from_file( daw::string_view path ) {
+		using mapping_t = daw::filesystem::memory_mapped_file_t<char>;
+		auto mapping = std::make_shared<mapping_t>(
+		  std::string_view( path.data( ), path.size( ) ) );
+		if( not *mapping ) {
+			throw std::runtime_error( "Unable to memory map file: " +
+			                          static_cast<std::string>( path ) );
+		}
+		auto const data = daw::string_view( mapping->data( ), mapping->size( ) );
+		return snapshot_document( std::move( mapping ), data );
+	}
+} // namespace daw::gumbo
@@ -0,0 +1,106 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_source_span_map.h>
+#include <daw/gumbo_pp/gumbo_util.h>
+
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <gumbo.h>
+#include <vector>
+
+namespace daw::gumbo {
+	namespace {
+		struct open_element {
+			GumboNode const *node;
+			source_span outer;
+			source_span inner;
+			bool implied_start;
+			bool implied_end;
+		};
+
+		[[nodiscard]] source_span clamp( source_span span,
+		                                 std::uint32_t html_size ) noexcept {
+			span.last = std::min( span.last, html_size );
+			span.first = std::min( span.first, span.last );
+			return span;
+		}
+
+		/// Widen parent to cover a child's source.  The inner span only grows on
+		/// the sides whose tag was implied, as real tags bound it
+		void extend( open_element &parent, source_span child ) noexcept {
+			parent.outer.first = std::min( parent.outer.first, child.first );
+			parent.outer.last = std::max( parent.outer.last, child.last );
+			if( parent.implied_start ) {
+				parent.inner.first = std::min( parent.inner.first, child.first );
+			}
+			if( parent.implied_end ) {
+				parent.inner.last = std::max( parent.inner.last, child.last );
+			}
+		}
+	} // namespace
+
+	source_span_map::source_span_map( gumbo_range const &rng )
+	  : source_span_map( *rng.document( ), rng.html( ) ) {}
+
+	source_span_map::source_span_map( GumboNode const &node,
+	                                  daw::string_view html_doc )
+	  : m_html( html_doc ) {
+		auto const html_size = static_cast<std::uint32_t>( m_html.size( ) );
+		// Elements whose subtree is still being visited.  They are widened by
+		// each child as it is finished and stored when their subtree ends
+		std::vector<open_element> open{ };
+		auto const close_until = [&]( GumboNode const *parent ) {
+			while( not open.empty( ) and open.back( ).node != parent ) {
+				auto const finished = open.back( );
+				open.pop_back( );
+				auto const outer = clamp( finished.outer, html_size );
+				auto const inner = clamp( finished.inner, html_size );
+				m_spans.emplace( finished.node, node_spans{ outer, inner } );
+				if( not open.empty( ) ) {
+					extend( open.back( ), outer );
+				}
+			}
+		};
+		auto const last = subtree_end( node );
+		for( auto it = gumbo_node_iterator_t( node ); it != last; ++it ) {
+			GumboNode const *cur = it.get( );
+			if( cur != &node ) {
+				close_until( cur->parent );
+			}
+			switch( cur->type ) {
+			case GumboNodeType::GUMBO_NODE_DOCUMENT: {
+				auto const whole = source_span{ 0, html_size };
+				open.push_back( open_element{ cur, whole, whole, false, false } );
+				break;
+			}
+			case GumboNodeType::GUMBO_NODE_ELEMENT:
+			case GumboNodeType::GUMBO_NODE_TEMPLATE: {
+				auto const &element = cur->v.element;
+				open.push_back( open_element{ cur,
+				                              node_source_span( *cur ),
+				                              node_inner_source_span( *cur ),
+				                              element.original_tag.length == 0,
+				                              element.original_end_tag.length == 0 } );
+				break;
+			}
+			default: {
+				auto const outer = clamp( node_source_span( *cur ), html_size );
+				m_spans.emplace( cur, node_spans{ outer, outer } );
+				if( not open.empty( ) ) {
+					extend( open.back( ), outer );
+				}
+				break;
+			}
+			}
+		}
+		close_until( nullptr );
+	}
+} // namespace daw::gumbo
@@ -0,0 +1,31 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_tag_index.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <gumbo.h>
+
+namespace daw::gumbo {
+	tag_index::tag_index( gumbo_node_iterator_t first,
+	                      gumbo_node_iterator_t last )
+	  : m_entries( static_cast<std::size_t>( GUMBO_TAG_LAST ) + 1U ) {
+		std::uint32_t position = 0;
+		for( ; first != last; ++first, ++position ) {
+			if( first->type != GUMBO_NODE_ELEMENT ) {
+				continue;
+			}
+			m_entries[static_cast<std::size_t>( first->v.element.tag )].push_back(
+			  tag_index_entry{ position, first.get( ) } );
+		}
+	}
+
+	tag_index::tag_index( gumbo_range const &rng )
+	  : tag_index( rng.begin( ), rng.end( ) ) {}
+} // namespace daw::gumbo
@@ -0,0 +1,281 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/gumbo_pp/gumbo_node_iterator.h>
+#include <daw/gumbo_pp/gumbo_text.h>
+#include <daw/gumbo_pp/gumbo_util.h>
+
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <gumbo.h>
+#include <string>
+
+namespace daw::gumbo {
+	namespace {
+		constexpr std::uint64_t repeat_byte( std::uint8_t b ) noexcept {
+			return 0x0101'0101'0101'0101ULL * b;
+		}
+
+		/// Position of the first whitespace character in str, or str.size( ).
+		/// Eight bytes at a time are tested for a byte below 0x21, which all of
+		/// the whitespace characters are.  Only blocks that have one are looked
+		/// at a byte at a time
+		[[nodiscard]] std::size_t find_space( char const *str,
+		                                      std::size_t size ) noexcept {
+			std::size_t pos = 0;
+			while( true ) {
+				while( pos + sizeof( std::uint64_t ) <= size ) {
+					std::uint64_t word;
+					std::memcpy( &word, str + pos, sizeof( word ) );
+					if( ( ( word - repeat_byte( 0x21U ) ) & ~word &
+					      repeat_byte( 0x80U ) ) != 0 ) {
+						break;
+					}
+					pos += sizeof( std::uint64_t );
+				}
+				auto const block_end = std::min( pos + sizeof( std::uint64_t ), size );
+				for( ; pos < block_end; ++pos ) {
+					if( is_html_space( str[pos] ) ) {
+						return pos;
+					}
+				}
+				if( pos == size ) {
+					return size;
+				}
+			}
+		}
+
+		[[nodiscard]] bool is_skipped( GumboNode const &node ) noexcept {
+			switch( node.type ) {
+			case GumboNodeType::GUMBO_NODE_COMMENT:
+			case GumboNodeType::GUMBO_NODE_TEMPLATE:
+				return true;
+			case GumboNodeType::GUMBO_NODE_ELEMENT:
+				switch( node.v.element.tag ) {
+				case GUMBO_TAG_HEAD:
+				case GUMBO_TAG_SCRIPT:
+				case GUMBO_TAG_STYLE:
+				case GUMBO_TAG_NOSCRIPT:
+				case GUMBO_TAG_TEMPLATE:
+					return true;
+				default:
+					return false;
+				}
+			default:
+				return false;
+			}
+		}
+
+		/// The number of line breaks around a block level element, 0 for inline
+		[[nodiscard]] unsigned block_line_breaks( GumboTag tag ) noexcept {
+			switch( tag ) {
+			case GUMBO_TAG_P:
+				return 2U;
+			case GUMBO_TAG_ADDRESS:
+			case GUMBO_TAG_ARTICLE:
+			case GUMBO_TAG_ASIDE:
+			case GUMBO_TAG_BLOCKQUOTE:
+			case GUMBO_TAG_CAPTION:
+			case GUMBO_TAG_CENTER:
+			case GUMBO_TAG_DD:
+			case GUMBO_TAG_DETAILS:
+			case GUMBO_TAG_DIR:
+			case GUMBO_TAG_DIV:
+			case GUMBO_TAG_DL:
+			case GUMBO_TAG_DT:
+			case GUMBO_TAG_FIELDSET:
+			case GUMBO_TAG_FIGCAPTION:
+			case GUMBO_TAG_FIGURE:
+			case GUMBO_TAG_FOOTER:
+			case GUMBO_TAG_FORM:
+			case GUMBO_TAG_H1:
+			case GUMBO_TAG_H2:
+			case GUMBO_TAG_H3:
+			case GUMBO_TAG_H4:
+			case GUMBO_TAG_H5:
+			case GUMBO_TAG_H6:
+			case GUMBO_TAG_HEADER:
+			case GUMBO_TAG_HGROUP:
+			case GUMBO_TAG_HR:
+			case GUMBO_TAG_LEGEND:
+			case GUMBO_TAG_LI:
+			case GUMBO_TAG_LISTING:
+			case GUMBO_TAG_MAIN:
+			case GUMBO_TAG_MENU:
+			case GUMBO_TAG_NAV:
+			case GUMBO_TAG_OL:
+			case GUMBO_TAG_PRE:
+			case GUMBO_TAG_SECTION:
+			case GUMBO_TAG_SUMMARY:
+			case GUMBO_TAG_TABLE:
+			case GUMBO_TAG_TR:
+			case GUMBO_TAG_UL:
+				return 1U;
+			default:
+				return 0U;
+			}
+		}
+
+		[[nodiscard]] bool preserves_whitespace( GumboTag tag ) noexcept {
+			switch( tag ) {
+			case GUMBO_TAG_PRE:
+			case GUMBO_TAG_LISTING:
+			case GUMBO_TAG_TEXTAREA:
+			case GUMBO_TAG_PLAINTEXT:
+			case GUMBO_TAG_XMP:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		/// Appends text to the buffer, holding back separators until the next
+		/// text so that runs of them collapse and none are left at the ends
+		class rendered_text_writer {
+			std::string &m_out;
+			std::size_t m_start;
+			unsigned m_line_breaks = 0;
+			unsigned m_preformatted = 0;
+			bool m_tab = false;
+			bool m_space = false;
+
+			void flush( ) {
+				if( m_out.size( ) != m_start ) {
+					if( m_line_breaks > 0 ) {
+						m_out.append( m_line_breaks, '\n' );
+					} else if( m_tab ) {
+						m_out.push_back( '\t' );
+					} else if( m_space ) {
+						m_out.push_back( ' ' );
+					}
+				}
+				m_line_breaks = 0;
+				m_tab = false;
+				m_space = false;
+			}
+
+		public:
+			explicit rendered_text_writer( std::string &out )
+			  : m_out( out )
+			  , m_start( out.size( ) ) {}
+
+			void text( daw::string_view str ) {
+				if( m_preformatted > 0 ) {
+					if( not str.empty( ) ) {
+						flush( );
+						m_out.append( str.data( ), str.size( ) );
+					}
+					return;
+				}
+				char const *first = str.data( );
+				std::size_t size = str.size( );
+				while( size > 0 ) {
+					if( is_html_space( *first ) ) {
+						m_space = true;
+						++first;
+						--size;
+						continue;
+					}
+					auto const run = find_space( first, size );
+					flush( );
+					m_out.append( first, run );
+					first += run;
+					size -= run;
+				}
+			}
+
+			void enter( GumboNode const &node ) {
+				if( node.type != GumboNodeType::GUMBO_NODE_ELEMENT ) {
+					return;
+				}
+				auto const tag = node.v.element.tag;
+				m_line_breaks = std::max( m_line_breaks, block_line_breaks( tag ) );
+				if( preserves_whitespace( tag ) ) {
+					++m_preformatted;
+				}
+			}
+
+			void leave( GumboNode const &node ) {
+				if( node.type != GumboNodeType::GUMBO_NODE_ELEMENT ) {
+					return;
+				}
+				auto const tag = node.v.element.tag;
+				switch( tag ) {
+				case GUMBO_TAG_BR:
+					// A forced break is kept even when there is no text around it
+					m_line_breaks = 0;
+					m_tab = false;
+					m_space = false;
+					m_out.push_back( '\n' );
+					return;
+				case GUMBO_TAG_TD:
+				case GUMBO_TAG_TH:
+					m_tab = true;
+					return;
+				default:
+					break;
+				}
+				m_line_breaks = std::max( m_line_breaks, block_line_breaks( tag ) );
+				if( preserves_whitespace( tag ) and m_preformatted > 0 ) {
+					--m_preformatted;
+				}
+			}
+		};
+	} // namespace
+
+	void node_rendered_text( GumboNode const &node, std::string &buffer ) {
+		auto out = rendered_text_writer( buffer );
+		// Elements are left when the walk moves to a node that is not their
+		// descendant, found by following the parent links
+		auto const leave_until = [&]( GumboNode const *cur,
+		                              GumboNode const *ancestor ) {
+			for( ; cur and cur != ancestor; cur = cur->parent ) {
+				out.leave( *cur );
+			}
+		};
+		GumboNode const *prev = nullptr;
+		auto const last = subtree_end( node );
+		auto it = gumbo_node_iterator_t( node );
+		while( it != last ) {
+			GumboNode const &cur = *it;
+			if( prev ) {
+				leave_until( prev, cur.parent );
+			}
+			prev = &cur;
+			if( is_skipped( cur ) ) {
+				// Left without being entered, which does nothing for these
+				it = subtree_end( cur );
+				continue;
+			}
+			switch( cur.type ) {
+			case GumboNodeType::GUMBO_NODE_TEXT:
+			case GumboNodeType::GUMBO_NODE_WHITESPACE:
+			case GumboNodeType::GUMBO_NODE_CDATA:
+				out.text( daw::string_view( cur.v.text.text ) );
+				break;
+			default:
+				out.enter( cur );
+				break;
+			}
+			++it;
+		}
+		if( prev ) {
+			leave_until( prev, node.parent );
+		}
+	}
+
+	std::string node_rendered_text( GumboNode const &node ) {
+		std::string result{ };
+		node_rendered_text( node, result );
+		return result;
+	}
+} // namespace daw::gumbo
@@ -0,0 +1,36 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace daw::gumbo::testing {
+	/// Generate a html document with a table of row_count rows and a list of
+	/// links.  Used to get a reproducible document of a given size for the
+	/// benchmarks
+	inline std::string generate_document( std::size_t row_count ) {
+		std::string result =
+		  "<!DOCTYPE html>\n<html>\n<head>\n\t<title>Generated</title>\n"
+		  "\t<meta charset=\"utf-8\">\n</head>\n<body>\n"
+		  "<div id=\"main\" class=\"content wide\">\n<table class=\"data\">\n";
+		for( std::size_t n = 0; n < row_count; ++n ) {
+			auto const num = std::to_string( n );
+			result += "\t<tr class=\"row\"><td class=\"name\">Item ";
+			result += num;
+			result += "</td><td><a href=\"/item/";
+			result += num;
+			result += "\" title=\"Item &amp; more\">Link</a></td><td>";
+			result += num;
+			result += "</td></tr>\n";
+		}
+		result += "</table>\n</div>\n</body>\n</html>\n";
+		return result;
+	}
+} // namespace daw::gumbo::testing
@@ -0,0 +1,46 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	auto rng = daw::gumbo::gumbo_range( html );
+
+	auto const links =
+	  match::tag::A and match::attribute::exists( "href" ) and
+	  match::attribute::value::starts_with( "href", "/item/" ) and
+	  match::attribute::value::contains( "title", "more" ) and
+	  match::attribute::value::has_value( "title" ) and
+	  not match::class_type::has( "hidden" ) and
+	  match::content_text::is( "Link" );
+	auto const compiled_links = daw::gumbo::compile_matcher( links );
+	assert( std::count_if( rng.begin( ), rng.end( ), links ) == 1'000 );
+	assert( std::count_if( rng.begin( ), rng.end( ), compiled_links ) == 1'000 );
+
+	auto const cells =
+	  match::tag::TD and ( match::class_type::has( "name" ) or
+	                       match::content_text::starts_with( "99" ) );
+	auto const compiled_cells = daw::gumbo::compile_matcher( cells );
+	auto const cell_count = std::count_if( rng.begin( ), rng.end( ), cells );
+	assert( cell_count == 1'000 + 11 );
+	assert( std::count_if( rng.begin( ), rng.end( ), compiled_cells ) ==
+	        cell_count );
+	(void)compiled_links;
+	(void)compiled_cells;
+	(void)cell_count;
+}
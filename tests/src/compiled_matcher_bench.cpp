@@ -0,0 +1,48 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <string>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	auto rng = daw::gumbo::gumbo_range( html );
+
+	auto const links =
+	  match::tag::A and match::attribute::exists( "href" ) and
+	  match::attribute::value::starts_with( "href", "/item/" ) and
+	  match::attribute::value::contains( "title", "more" ) and
+	  match::attribute::value::has_value( "title" ) and
+	  not match::class_type::has( "hidden" ) and
+	  match::content_text::is( "Link" );
+	auto const compiled_links = daw::gumbo::compile_matcher( links );
+
+	daw::bench_n_test_mbs<25>(
+	  "composed matcher",
+	  html.size( ),
+	  [&]( auto const &r ) {
+		  daw::do_not_optimize( std::count_if( r.begin( ), r.end( ), links ) );
+	  },
+	  rng );
+	daw::bench_n_test_mbs<25>(
+	  "compiled matcher",
+	  html.size( ),
+	  [&]( auto const &r ) {
+		  daw::do_not_optimize(
+		    std::count_if( r.begin( ), r.end( ), compiled_links ) );
+	  },
+	  rng );
+}
@@ -0,0 +1,58 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <type_traits>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	auto rng = daw::gumbo::gumbo_range( html );
+
+	auto const links = DAW_GUMBO_CSS( "a[href^='/item/'][title*=more]" );
+	auto const hand_written =
+	  match::tag::A and
+	  match::attribute::value::starts_with( "href", "/item/" ) and
+	  match::attribute::value::contains( "title", "more" );
+	static_assert( std::is_same_v<decltype( links ), decltype( hand_written )> );
+	auto const runtime =
+	  daw::gumbo::css_selector( "a[href^='/item/'][title*=more]" );
+	assert( std::count_if( rng.begin( ), rng.end( ), links ) == 1'000 );
+	assert( std::count_if( rng.begin( ), rng.end( ), runtime ) == 1'000 );
+
+	auto const cells = DAW_GUMBO_CSS( "td:not(.name), th, :is(#main)" );
+	assert( std::count_if( rng.begin( ), rng.end( ), cells ) == 2'000 + 1 );
+	auto const tokens = DAW_GUMBO_CSS( "DIV[class~=wide][id=main]" );
+	assert( std::count_if( rng.begin( ), rng.end( ), tokens ) == 1 );
+	(void)runtime;
+	(void)cells;
+	(void)tokens;
+
+	// A <template> is an element to * and :not( ), as it is to css_selector.
+	// Its content is not walked, leaving html, head, body, template and b
+	{
+		auto const tmpl_rng = daw::gumbo::gumbo_range(
+		  "<body><template><p>x</p></template><b></b></body>" );
+		auto const count = [&]( auto const &matcher ) {
+			return std::count_if( tmpl_rng.begin( ), tmpl_rng.end( ), matcher );
+		};
+		assert( count( DAW_GUMBO_CSS( "*" ) ) == 5 );
+		assert( count( daw::gumbo::css_selector( "*" ) ) == 5 );
+		assert( count( DAW_GUMBO_CSS( ":not(b)" ) ) ==
+		        count( daw::gumbo::css_selector( ":not(b)" ) ) );
+		(void)count;
+	}
+}
@@ -0,0 +1,41 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <string>
+
+int main( ) {
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	auto rng = daw::gumbo::gumbo_range( html );
+
+	auto const links = DAW_GUMBO_CSS( "a[href^='/item/'][title*=more]" );
+	auto const runtime =
+	  daw::gumbo::css_selector( "a[href^='/item/'][title*=more]" );
+
+	daw::bench_n_test_mbs<25>(
+	  "css literal",
+	  html.size( ),
+	  [&]( auto const &r ) {
+		  daw::do_not_optimize( std::count_if( r.begin( ), r.end( ), links ) );
+	  },
+	  rng );
+	daw::bench_n_test_mbs<25>(
+	  "runtime selector",
+	  html.size( ),
+	  [&]( auto const &r ) {
+		  daw::do_not_optimize( std::count_if( r.begin( ), r.end( ), runtime ) );
+	  },
+	  rng );
+}
@@ -0,0 +1,66 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+
+	auto cache = daw::gumbo::document_cache( 64U * 1024U * 1024U );
+	auto first = cache.get( html );
+	// A different buffer with the same bytes is a hit
+	std::string const doc_copy = doc;
+	auto second = cache.get( doc_copy );
+	assert( first == second );
+	assert( first->html( ).data( ) != html.data( ) );
+	assert( std::count_if( second->begin( ), second->end( ), match::tag::TR ) ==
+	        1'000 );
+	auto stats = cache.stats( );
+	assert( stats.hits == 1 and stats.misses == 1 and stats.entries == 1 );
+	assert( stats.memory_used > doc.size( ) );
+
+	// Shrinking the budget evicts, but ranges held stay valid
+	cache.set_memory_budget( 0 );
+	stats = cache.stats( );
+	assert( stats.entries == 0 and stats.evictions == 1 );
+	assert( std::count_if( first->begin( ), first->end( ), match::tag::TD ) ==
+	        3'000 );
+	first.reset( );
+	second.reset( );
+
+	cache.set_memory_budget( 64U * 1024U * 1024U );
+	auto threads = std::vector<std::thread>( );
+	for( std::size_t n = 0; n < 4; ++n ) {
+		threads.emplace_back( [&] {
+			for( std::size_t m = 0; m < 16; ++m ) {
+				auto rng = cache.get( html );
+				assert( rng->root( ) );
+				(void)rng;
+			}
+		} );
+	}
+	for( auto &t : threads ) {
+		t.join( );
+	}
+	stats = cache.stats( );
+	assert( stats.hits + stats.misses == 2U + 64U );
+	assert( stats.entries == 1 );
+	(void)stats;
+}
@@ -0,0 +1,30 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <string>
+
+int main( ) {
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+
+	auto cache = daw::gumbo::document_cache( 64U * 1024U * 1024U );
+	daw::do_not_optimize( cache.get( html ) );
+	daw::bench_n_test_mbs<25>(
+	  "document_cache hit",
+	  html.size( ),
+	  [&cache]( daw::string_view h ) {
+		  daw::do_not_optimize( cache.get( h ) );
+	  },
+	  html );
+}
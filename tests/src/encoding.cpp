@@ -0,0 +1,203 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+/// A view of the whole literal, including any embedded NUL bytes
+template<std::size_t N>
+constexpr daw::string_view bytes( char const ( &str )[N] ) {
+	return daw::string_view( str, N - 1 );
+}
+
+int main( ) {
+	using daw::gumbo::html_encoding;
+	auto buffer = std::string( );
+
+	// Byte order marks
+	{
+		constexpr auto raw = bytes( "\xEF\xBB\xBF<p>x</p>" );
+		auto const sniffed = daw::gumbo::sniff_encoding( raw );
+		assert( sniffed.encoding == html_encoding::utf8 and
+		        sniffed.bom_size == 3U );
+		auto const decoded = daw::gumbo::to_utf8( raw, buffer );
+		assert( not decoded.transcoded );
+		assert( decoded.html == "<p>x</p>" );
+		assert( decoded.html.data( ) == raw.data( ) + 3 );
+		assert( buffer.empty( ) );
+		(void)sniffed;
+		(void)decoded;
+	}
+	assert( daw::gumbo::sniff_encoding( bytes( "\xFF\xFE<\0" ) ).encoding ==
+	        html_encoding::utf16le );
+	assert( daw::gumbo::sniff_encoding( bytes( "\xFE\xFF\0<" ) ).encoding ==
+	        html_encoding::utf16be );
+
+	// The <meta> prescan
+	assert( daw::gumbo::sniff_encoding( "<p>no declaration</p>" ).encoding ==
+	        html_encoding::unknown );
+	assert( daw::gumbo::sniff_encoding( "<meta charset=\"windows-1252\">" )
+	          .encoding == html_encoding::windows_1252 );
+	assert( daw::gumbo::sniff_encoding( "<META CharSet=latin9>" ).encoding ==
+	        html_encoding::iso_8859_15 );
+	assert( daw::gumbo::sniff_encoding(
+	          "<meta http-equiv='Content-Type' "
+	          "content='text/html; charset=ISO-8859-1'>" )
+	          .encoding == html_encoding::windows_1252 );
+	assert( daw::gumbo::sniff_encoding(
+	          "<!-- <meta charset=\"latin1\"> --><meta charset=utf-8>" )
+	          .encoding == html_encoding::utf8 );
+	// A document that can be prescanned is ASCII compatible, so not UTF-16
+	assert( daw::gumbo::sniff_encoding( "<meta charset=utf-16>" ).encoding ==
+	        html_encoding::utf8 );
+	{
+		// Only the first 1024 bytes are prescanned
+		auto const late = std::string( 1024, ' ' ) + "<meta charset=latin1>";
+		assert( daw::gumbo::sniff_encoding( late ).encoding ==
+		        html_encoding::unknown );
+	}
+	assert( daw::gumbo::encoding_from_label( " Latin1 " ) ==
+	        html_encoding::windows_1252 );
+	assert( daw::gumbo::encoding_from_label( "shift_jis" ) ==
+	        html_encoding::unsupported );
+	assert( daw::gumbo::encoding_from_label( " " ) == html_encoding::unknown );
+
+	// The UTF-8 check skips ASCII 8 bytes at a time.  Put the multi byte
+	// sequences on and across every position of the words
+	for( std::size_t pos = 0; pos < 24U; ++pos ) {
+		auto text = std::string( 32, 'a' );
+		assert( daw::gumbo::is_valid_utf8( text ) );
+		text.insert( pos, "\xE2\x82\xAC" );
+		assert( daw::gumbo::is_valid_utf8( text ) );
+		text[pos + 2U] = 'a';
+		assert( not daw::gumbo::is_valid_utf8( text ) );
+		text = std::string( 32, 'a' );
+		text[pos] = '\xFF';
+		assert( not daw::gumbo::is_valid_utf8( text ) );
+	}
+	// A sequence truncated by the end of the input, just after a full word
+	assert( not daw::gumbo::is_valid_utf8( "abcdefgh\xC3" ) );
+	assert( daw::gumbo::is_valid_utf8( "abcdefgh\xC3\xA9" ) );
+
+	// Declared UTF-8 that is not valid is repaired with U+FFFD
+	{
+		constexpr auto raw = bytes( "\xEF\xBB\xBF"
+		                            "ab\xC0\xAF"     // overlong '/'
+		                            "\xE0\x80\xAF"   // overlong '/'
+		                            "\xED\xA0\x80"   // surrogate
+		                            "\xC3\xA9"       // valid
+		                            "\xE2\x82" );    // truncated
+		auto const decoded = daw::gumbo::to_utf8( raw, buffer );
+		assert( decoded.transcoded );
+		assert( decoded.encoding == html_encoding::utf8 );
+		auto expected = std::string( "ab" );
+		for( int n = 0; n < 8; ++n ) {
+			expected += "\xEF\xBF\xBD";
+		}
+		expected += "\xC3\xA9";
+		expected += "\xEF\xBF\xBD\xEF\xBF\xBD";
+		assert( decoded.html == expected );
+		(void)decoded;
+	}
+
+	// UTF-16, including a surrogate pair, a lone surrogate and an odd byte
+	{
+		constexpr auto raw = bytes( "\xFF\xFE"
+		                            "<\0p\0>\0"
+		                            "\xAC\x20"           // U+20AC
+		                            "\x3D\xD8\x00\xDE"   // U+1F600
+		                            "\x3D\xD8"           // lone high surrogate
+		                            "x\0"
+		                            "y" );
+		auto const decoded = daw::gumbo::to_utf8( raw, buffer );
+		assert( decoded.transcoded );
+		assert( decoded.encoding == html_encoding::utf16le );
+		assert( decoded.html == "<p>\xE2\x82\xAC\xF0\x9F\x98\x80"
+		                        "\xEF\xBF\xBDx\xEF\xBF\xBD" );
+		(void)decoded;
+	}
+	{
+		constexpr auto raw = bytes( "\xFE\xFF"
+		                            "\0<\0p\0>"
+		                            "\x20\xAC"
+		                            "\xD8\x3D\xDE\x00" );
+		auto const decoded = daw::gumbo::to_utf8( raw, buffer );
+		assert( decoded.encoding == html_encoding::utf16be );
+		assert( decoded.html == "<p>\xE2\x82\xAC\xF0\x9F\x98\x80" );
+		(void)decoded;
+	}
+
+	// Single byte encodings.  0xA4 is the euro sign in ISO-8859-15 only
+	{
+		auto const decoded = daw::gumbo::to_utf8(
+		  "<meta charset=windows-1252>\x80\xA4\xE9", buffer );
+		assert( decoded.transcoded );
+		assert( decoded.encoding == html_encoding::windows_1252 );
+		assert( decoded.html ==
+		        "<meta charset=windows-1252>\xE2\x82\xAC\xC2\xA4\xC3\xA9" );
+		(void)decoded;
+	}
+	{
+		auto const decoded =
+		  daw::gumbo::to_utf8( "<meta charset=iso-8859-15>\xA4\xE9", buffer );
+		assert( decoded.encoding == html_encoding::iso_8859_15 );
+		assert( decoded.html == "<meta charset=iso-8859-15>\xE2\x82\xAC\xC3\xA9" );
+		(void)decoded;
+	}
+	{
+		// Undeclared and not UTF-8 is decoded as windows-1252
+		auto const decoded = daw::gumbo::to_utf8( "caf\xE9", buffer );
+		assert( decoded.encoding == html_encoding::windows_1252 );
+		assert( decoded.html == "caf\xC3\xA9" );
+		(void)decoded;
+	}
+	{
+		// ASCII in a single byte encoding is already UTF-8
+		constexpr auto raw = daw::string_view( "<meta charset=latin1><p>x</p>" );
+		auto const decoded = daw::gumbo::to_utf8( raw, buffer );
+		assert( not decoded.transcoded );
+		assert( decoded.html.data( ) == raw.data( ) );
+		(void)decoded;
+	}
+
+	// A declared encoding that cannot be converted is reported, not decoded
+	// as windows-1252
+	{
+		constexpr auto raw =
+		  daw::string_view( "<meta charset=shift_jis><p>\x93\xFA\x96\x7B</p>" );
+		assert( daw::gumbo::sniff_encoding( raw ).encoding ==
+		        html_encoding::unsupported );
+		auto const decoded = daw::gumbo::to_utf8( raw, buffer );
+		assert( decoded.encoding == html_encoding::unsupported );
+		assert( not decoded.transcoded );
+		assert( decoded.html.data( ) == raw.data( ) );
+		bool has_thrown = false;
+		try {
+			(void)daw::gumbo::gumbo_range::from_bytes( raw );
+		} catch( std::runtime_error const & ) { has_thrown = true; }
+		assert( has_thrown );
+		(void)decoded;
+		(void)has_thrown;
+	}
+
+	// from_bytes parses UTF-8 in place and owns what it transcodes
+	{
+		constexpr auto raw = daw::string_view( "<p>caf\xC3\xA9</p>" );
+		auto const rng = daw::gumbo::gumbo_range::from_bytes( raw );
+		assert( rng.html( ).data( ) == raw.data( ) );
+	}
+	{
+		auto const rng = daw::gumbo::gumbo_range::from_bytes( "<p>caf\xE9</p>" );
+		assert( rng.html( ) == "<p>caf\xC3\xA9</p>" );
+	}
+}
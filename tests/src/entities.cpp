@@ -0,0 +1,44 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <cassert>
+#include <string>
+
+int main( ) {
+	using daw::gumbo::decode_entities;
+	assert( decode_entities( "a &amp; b" ) == "a & b" );
+	// Legacy names are decoded without the ;
+	assert( decode_entities( "&lt&gt" ) == "<>" );
+	assert( decode_entities( "&notit;" ) == "\xC2\xACit;" );
+	assert( decode_entities( "&#x27;&#39;" ) == "''" );
+	// C1 controls map to windows-1252 and invalid code points to U+FFFD
+	assert( decode_entities( "&#128;" ) == "\xE2\x82\xAC" );
+	assert( decode_entities( "&#0;" ) == "\xEF\xBF\xBD" );
+	assert( decode_entities( "&bogus; & &#;" ) == "&bogus; & &#;" );
+
+	std::string in_place = "&amp;&lt;z";
+	daw::gumbo::decode_entities_in_place( in_place );
+	assert( in_place == "&<z" );
+	// &nGt; decodes to more bytes than its source
+	in_place = "x&nGt;y&amp;";
+	daw::gumbo::decode_entities_in_place( in_place );
+	assert( in_place == decode_entities( "x&nGt;y&amp;" ) );
+	assert( in_place.size( ) == 9 );
+
+	// References split across chunks are held back until they are complete
+	auto decoder = daw::gumbo::entity_decoder( );
+	std::string streamed{ };
+	decoder.decode( "a &am", streamed );
+	decoder.decode( "p; &#x4", streamed );
+	decoder.decode( "1;&", streamed );
+	decoder.finish( streamed );
+	assert( streamed == "a & A&" );
+}
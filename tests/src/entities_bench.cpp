@@ -0,0 +1,34 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <cstddef>
+#include <string>
+
+int main( ) {
+	std::string doc = daw::gumbo::testing::generate_document( 1'000 );
+	for( std::size_t n = 0; n < 1'000; ++n ) {
+		doc += "&amp;&lt;&quot;&#x2014;";
+	}
+	auto const html = daw::string_view( doc );
+	std::string out{ };
+	daw::bench_n_test_mbs<25>(
+	  "decode_entities",
+	  html.size( ),
+	  [&out]( daw::string_view h ) {
+		  out.clear( );
+		  daw::gumbo::decode_entities( h, out );
+		  daw::do_not_optimize( out );
+	  },
+	  html );
+}
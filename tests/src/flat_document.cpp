@@ -0,0 +1,133 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+
+inline constexpr daw::string_view test_doc = R"html(
+<html>
+<head>
+	<title>Flat example</title>
+</head>
+<body>
+	<div id="main" class="content">
+		<p>Some <b>bold</b> text</p>
+		<a href="/next">Next</a>
+	</div>
+</body>
+</html>)html";
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	auto rng = daw::gumbo::gumbo_range( test_doc );
+	auto const expected_count = std::distance( rng.begin( ), rng.end( ) );
+
+	auto const flat = daw::gumbo::flat_document( rng );
+	assert( flat.end( ) - flat.begin( ) == expected_count );
+
+	auto div = std::find_if( flat.begin( ),
+	                         flat.end( ),
+	                         match::tag::DIV and match::id::is( "main" ) );
+	assert( div != flat.end( ) );
+	assert( flat.attribute_value( div.index( ), "class" ) == "content" );
+	auto anchor = std::find_if( div + 1,
+	                            flat.begin( ) + flat.subtree_end( div.index( ) ),
+	                            match::tag::A );
+	assert( anchor != flat.end( ) );
+	assert( flat.outer_text( anchor.index( ) ) == R"(<a href="/next">Next</a>)" );
+	assert( flat.inner_text( anchor.index( ) ) == "Next" );
+	assert( daw::gumbo::node_content_text( *anchor ) == "Next" );
+
+	// The flat data outlives the gumbo tree
+	auto const released = daw::gumbo::flat_document(
+	  daw::gumbo::gumbo_range( test_doc ),
+	  daw::gumbo::gumbo_tree_retention::release );
+	assert( not released.has_tree( ) );
+	auto const bold_pos = std::find_if(
+	  released.begin( ), released.end( ), []( daw::gumbo::flat_node n ) {
+		  return n.tag( ) == GUMBO_TAG_B;
+	  } );
+	assert( bold_pos != released.end( ) );
+	auto const bold_text = bold_pos.index( ) + 1U;
+	assert( released.type( bold_text ) == GUMBO_NODE_TEXT );
+	assert( released.text( bold_text ) == "bold" );
+
+	// The tag and attribute matchers read the flat arrays
+	auto const released_div =
+	  std::find_if( released.begin( ),
+	                released.end( ),
+	                match::tag::DIV and match::id::is( "main" ) and
+	                  match::class_type::has( "content" ) );
+	assert( released_div.index( ) == div.index( ) );
+	assert( std::count_if( released.begin( ),
+	                       released.end( ),
+	                       match::attribute::exists( "href" ) ) == 1 );
+	assert( std::count_if( released.begin( ),
+	                       released.end( ),
+	                       match::tag::where( []( GumboTag tag ) {
+		                       return tag == GUMBO_TAG_P or tag == GUMBO_TAG_B;
+	                       } ) ) == 2 );
+	bool has_thrown = false;
+	try {
+		(void)released.gumbo_node( bold_pos.index( ) );
+	} catch( std::runtime_error const & ) { has_thrown = true; }
+	assert( has_thrown );
+	(void)released_div;
+	(void)has_thrown;
+
+	// Attribute names and short values are atoms, shared between documents
+	auto interner = std::make_shared<daw::gumbo::string_interner>( );
+	auto const first_doc = daw::gumbo::flat_document( rng, interner );
+	// The temporary range is moved into and owned by the document
+	auto const second_doc =
+	  daw::gumbo::flat_document( daw::gumbo::gumbo_range( test_doc ), interner );
+	assert( second_doc.has_tree( ) );
+	assert( std::find_if( second_doc.begin( ), second_doc.end( ), match::tag::A )
+	          .index( ) == anchor.index( ) );
+	auto const atom_count = interner->size( );
+	assert( atom_count > 0 );
+	assert( second_doc.attribute_value( div.index( ), "class" ) == "content" );
+	(void)atom_count;
+	auto const href_matcher =
+	  match::attribute::atom::is( *interner, "href", "/missing", "/next" );
+	auto const atom_anchor =
+	  std::find_if( second_doc.begin( ), second_doc.end( ), href_matcher );
+	assert( atom_anchor.index( ) == anchor.index( ) );
+	(void)atom_anchor;
+	assert( std::count_if( first_doc.begin( ),
+	                       first_doc.end( ),
+	                       match::attribute::atom::exists( *interner, "id" ) ) ==
+	        1 );
+	assert( std::none_of( first_doc.begin( ),
+	                      first_doc.end( ),
+	                      match::attribute::atom::exists( *interner, "nope" ) ) );
+	assert( interner->size( ) == atom_count );
+
+	// Matchers created before a later document interns their strings
+	auto const later_value =
+	  match::attribute::atom::is( *interner, "data-role", "later" );
+	auto const later_name =
+	  match::attribute::atom::exists( *interner, "data-role" );
+	auto const third_doc = daw::gumbo::flat_document(
+	  daw::gumbo::gumbo_range( R"(<p data-role="later">x</p>)" ), interner );
+	assert( interner->find( "later" ) != daw::gumbo::string_interner::no_atom );
+	assert( std::count_if( third_doc.begin( ), third_doc.end( ), later_value ) ==
+	        1 );
+	assert( std::count_if( third_doc.begin( ), third_doc.end( ), later_name ) ==
+	        1 );
+	(void)later_value;
+	(void)later_name;
+
+	(void)anchor;
+	(void)bold_text;
+}
@@ -0,0 +1,77 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+inline constexpr daw::string_view test_doc = R"html(<html>
+<head><title>From file</title></head>
+<body><div class="greeting"><b>Hey folks!</b></div></body>
+</html>)html";
+
+void write_file( std::filesystem::path const &file_path,
+                 daw::string_view contents ) {
+	auto out = std::ofstream( file_path, std::ios::binary | std::ios::trunc );
+	out.write( contents.data( ),
+	           static_cast<std::streamsize>( contents.size( ) ) );
+}
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	auto const dir = std::filesystem::temp_directory_path( );
+	auto const doc_path = dir / "gumbo_pp_from_file_test.html";
+	auto const empty_path = dir / "gumbo_pp_from_file_empty_test.html";
+	write_file( doc_path, test_doc );
+	write_file( empty_path, { } );
+
+	{
+		auto const rng = daw::gumbo::gumbo_range::from_file( doc_path.string( ) );
+		// The range parses the mapping of the file, not a copy
+		auto const html = rng.html( );
+		assert( html == test_doc );
+		assert( html.data( ) != test_doc.data( ) );
+		auto const bold = std::find_if( rng.begin( ), rng.end( ), match::tag::B );
+		assert( bold != rng.end( ) );
+		auto const inner = daw::gumbo::node_inner_text( *bold, rng );
+		assert( inner == "Hey folks!" );
+		assert( inner.data( ) >= html.data( ) and
+		        inner.data( ) + inner.size( ) <= html.data( ) + html.size( ) );
+		auto const div = std::find_if(
+		  rng.begin( ), rng.end( ), match::class_type::has( "greeting" ) );
+		assert( daw::gumbo::node_outer_text( *div, rng ) ==
+		        R"(<div class="greeting"><b>Hey folks!</b></div>)" );
+		(void)html;
+		(void)inner;
+		(void)div;
+	}
+	{
+		// An empty file is an empty document
+		auto const rng =
+		  daw::gumbo::gumbo_range::from_file( empty_path.string( ) );
+		assert( rng.html( ).empty( ) );
+		assert( std::find_if( rng.begin( ), rng.end( ), match::tag::BODY ) !=
+		        rng.end( ) );
+	}
+	bool has_thrown = false;
+	try {
+		(void)daw::gumbo::gumbo_range::from_file(
+		  ( dir / "gumbo_pp_from_file_missing.html" ).string( ) );
+	} catch( std::runtime_error const & ) { has_thrown = true; }
+	assert( has_thrown );
+	(void)has_thrown;
+
+	std::filesystem::remove( doc_path );
+	std::filesystem::remove( empty_path );
+}
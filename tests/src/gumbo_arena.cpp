@@ -0,0 +1,101 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <string>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+
+	// The allocator itself
+	{
+		auto arena = daw::gumbo::gumbo_arena( 1024U );
+		assert( arena.capacity( ) == 0 and arena.size( ) == 0 );
+		void *first = arena.allocate( 10 );
+		assert( first != nullptr );
+		assert( arena.size( ) >= 10U );
+		// Larger than a block gets a block of its own
+		assert( arena.allocate( 4096U ) != nullptr );
+		auto const capacity = arena.capacity( );
+		assert( capacity >= 1024U + 4096U );
+		arena.reset( );
+		assert( arena.size( ) == 0 and arena.capacity( ) == capacity );
+		// The blocks are reused after a reset
+		assert( arena.allocate( 10 ) == first );
+		assert( arena.capacity( ) == capacity );
+		arena.shrink_to( 1024U );
+		assert( arena.capacity( ) <= 1024U and arena.size( ) == 0 );
+		arena.reserve( 64U * 1024U );
+		assert( arena.capacity( ) >= 64U * 1024U );
+		auto const reserved = arena.capacity( );
+		(void)arena.allocate( 32U * 1024U );
+		assert( arena.capacity( ) == reserved );
+		arena.release( );
+		assert( arena.capacity( ) == 0 );
+		(void)first;
+		(void)capacity;
+		(void)reserved;
+	}
+
+	std::string const doc = daw::gumbo::testing::generate_document( 100 );
+	auto const html = daw::string_view( doc );
+	auto arena = daw::gumbo::gumbo_arena( );
+	{
+		auto rng = daw::gumbo::gumbo_range( html, arena );
+		assert( arena.live_outputs( ) == 1 );
+		assert( arena.size( ) > 0 );
+		assert( std::count_if( rng.begin( ), rng.end( ), match::tag::TR ) == 100 );
+	}
+	// Destroying the last output resets the arena
+	assert( arena.live_outputs( ) == 0 );
+	assert( arena.size( ) == 0 );
+	auto const warm_capacity = arena.capacity( );
+	assert( warm_capacity > 0 );
+
+	// Parsing the same document again reuses the blocks
+	{
+		auto rng = daw::gumbo::gumbo_range( html, arena );
+		assert( arena.live_outputs( ) == 1 );
+		assert( arena.capacity( ) == warm_capacity );
+	}
+	assert( arena.size( ) == 0 );
+
+	// The arena is reset only once every output parsed into it is destroyed
+	{
+		auto first = daw::gumbo::gumbo_range( html, arena );
+		{
+			auto second = daw::gumbo::gumbo_range( html, arena );
+			assert( arena.live_outputs( ) == 2 );
+		}
+		assert( arena.live_outputs( ) == 1 );
+		assert( arena.size( ) > 0 );
+		assert( std::count_if( first.begin( ), first.end( ), match::tag::TD ) ==
+		        300 );
+	}
+	assert( arena.live_outputs( ) == 0 );
+	assert( arena.size( ) == 0 );
+
+	// A large document does not pin its memory past max_retained
+	arena.shrink_to( warm_capacity );
+	arena.set_max_retained( warm_capacity );
+	{
+		std::string const large = daw::gumbo::testing::generate_document( 5'000 );
+		auto rng = daw::gumbo::gumbo_range( large, arena );
+		assert( arena.capacity( ) > warm_capacity );
+	}
+	assert( arena.live_outputs( ) == 0 );
+	assert( arena.capacity( ) <= warm_capacity );
+	(void)warm_capacity;
+}
@@ -0,0 +1,74 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+int main( ) {
+	std::string const doc = daw::gumbo::testing::generate_document( 5'000 );
+	auto const html = daw::string_view( doc );
+	namespace match = daw::gumbo::match;
+
+	auto const expected_rows = [&] {
+		auto rng = daw::gumbo::gumbo_range( html );
+		return std::count_if( rng.begin( ), rng.end( ), match::tag::TR );
+	}( );
+	assert( expected_rows == 5'000 );
+
+	daw::bench_n_test_mbs<25>(
+	  "kGumboDefaultOptions",
+	  html.size( ),
+	  []( daw::string_view h ) {
+		  auto rng = daw::gumbo::gumbo_range( h );
+		  daw::do_not_optimize( rng.root( ) );
+	  },
+	  html );
+
+	auto arena = daw::gumbo::gumbo_arena( );
+	daw::bench_n_test_mbs<25>(
+	  "gumbo_arena",
+	  html.size( ),
+	  [&arena]( daw::string_view h ) {
+		  auto rng = daw::gumbo::gumbo_range( h, arena );
+		  daw::do_not_optimize( rng.root( ) );
+	  },
+	  html );
+
+	auto &ctx = daw::gumbo::parse_context::this_thread( );
+	ctx.reserve( html.size( ) );
+	daw::bench_n_test_mbs<25>(
+	  "parse_context",
+	  html.size( ),
+	  [&ctx]( daw::string_view h ) {
+		  auto rng = ctx.parse( h );
+		  daw::do_not_optimize( rng.root( ) );
+	  },
+	  html );
+
+	{
+		auto rng = daw::gumbo::gumbo_range( html, arena );
+		auto const rows = std::count_if( rng.begin( ), rng.end( ), match::tag::TR );
+		assert( rows == expected_rows );
+		(void)rows;
+		assert( arena.live_outputs( ) == 1 );
+	}
+	assert( arena.live_outputs( ) == 0 );
+	assert( arena.size( ) == 0 );
+	std::cout << "arena capacity: " << arena.capacity( ) << " bytes\n";
+	(void)expected_rows;
+}
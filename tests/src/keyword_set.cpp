@@ -0,0 +1,64 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <vector>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+
+	auto const words = daw::gumbo::keyword_set{ "he", "she", "his", "hers" };
+	auto const found = words.find_all( "ushers" );
+	assert( found.size( ) == 3U );
+	assert( words.keyword( found[0].keyword ) == "she" and
+	        found[0].position == 1U );
+	assert( words.keyword( found[1].keyword ) == "he" and
+	        found[1].position == 2U );
+	assert( words.keyword( found[2].keyword ) == "hers" and
+	        found[2].position == 2U );
+	assert( words.contains_any( "this" ) and not words.contains_any( "hi sh" ) );
+
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	auto rng = daw::gumbo::gumbo_range( html );
+
+	auto names = std::vector<std::string>{ };
+	for( int n = 500; n < 1'000; ++n ) {
+		names.push_back( "Item " + std::to_string( n ) );
+	}
+	auto const keywords = daw::gumbo::keyword_set( names );
+	auto const cells =
+	  match::tag::TD and match::content_text::contains( keywords );
+	auto const slow_cells =
+	  match::tag::TD and match::content_text::contains( names );
+	assert( std::count_if( rng.begin( ), rng.end( ), cells ) == 500 );
+	assert( std::count_if( rng.begin( ), rng.end( ), slow_cells ) == 500 );
+
+	auto const hrefs = daw::gumbo::keyword_set{ "/item/7", "/item/8" };
+	assert( std::count_if( rng.begin( ),
+	                       rng.end( ),
+	                       match::attribute::value::contains( "href", hrefs ) ) ==
+	        222 );
+	assert( std::count_if(
+	          rng.begin( ),
+	          rng.end( ),
+	          match::tag::A and match::inner_text::contains(
+	                              html, daw::gumbo::keyword_set{ "Link" } ) ) ==
+	        1'000 );
+	(void)found;
+	(void)cells;
+	(void)slow_cells;
+	(void)hrefs;
+}
@@ -0,0 +1,50 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	auto rng = daw::gumbo::gumbo_range( html );
+
+	auto names = std::vector<std::string>{ };
+	for( int n = 500; n < 1'000; ++n ) {
+		names.push_back( "Item " + std::to_string( n ) );
+	}
+	auto const keywords = daw::gumbo::keyword_set( names );
+	auto const cells =
+	  match::tag::TD and match::content_text::contains( keywords );
+	auto const slow_cells =
+	  match::tag::TD and match::content_text::contains( names );
+
+	daw::bench_n_test_mbs<25>(
+	  "keyword_set",
+	  html.size( ),
+	  [&]( auto const &r ) {
+		  daw::do_not_optimize( std::count_if( r.begin( ), r.end( ), cells ) );
+	  },
+	  rng );
+	daw::bench_n_test_mbs<25>(
+	  "find per keyword",
+	  html.size( ),
+	  [&]( auto const &r ) {
+		  daw::do_not_optimize(
+		    std::count_if( r.begin( ), r.end( ), slow_cells ) );
+	  },
+	  rng );
+}
@@ -0,0 +1,54 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <vector>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	auto rng = daw::gumbo::gumbo_range( html );
+
+	auto const names = match::tag::TD and match::class_type::has( "name" );
+	auto const numbers = match::tag::TD and
+	                     not match::class_type::has( "name" ) and
+	                     not match::content_text::starts_with( "Link" );
+	auto const links = match::tag::A and
+	                   match::attribute::value::starts_with( "href", "/item/" );
+	auto const nines = match::tag::TD and match::content_text::ends_with( "9" );
+	auto const rows = match::tag::TR and match::class_type::has( "row" );
+	auto const title = match::tag::TITLE;
+
+	auto const buckets =
+	  daw::gumbo::match_many( rng, names, numbers, links, nines, rows, title );
+	auto const expected = [&]( auto const &query ) {
+		auto result = std::vector<GumboNode const *>{ };
+		for( GumboNode const &node : rng ) {
+			if( query( node ) ) {
+				result.push_back( &node );
+			}
+		}
+		return result;
+	};
+	assert( buckets[0] == expected( names ) and buckets[0].size( ) == 1'000U );
+	assert( buckets[1] == expected( numbers ) and buckets[1].size( ) == 1'000U );
+	assert( buckets[2] == expected( links ) and buckets[2].size( ) == 1'000U );
+	assert( buckets[3] == expected( nines ) and buckets[3].size( ) == 200U );
+	assert( buckets[4] == expected( rows ) and buckets[4].size( ) == 1'000U );
+	assert( buckets[5] == expected( title ) and buckets[5].size( ) == 1U );
+	(void)buckets;
+	(void)expected;
+}
@@ -0,0 +1,56 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <string>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	auto rng = daw::gumbo::gumbo_range( html );
+
+	auto const names = match::tag::TD and match::class_type::has( "name" );
+	auto const numbers = match::tag::TD and
+	                     not match::class_type::has( "name" ) and
+	                     not match::content_text::starts_with( "Link" );
+	auto const links = match::tag::A and
+	                   match::attribute::value::starts_with( "href", "/item/" );
+	auto const nines = match::tag::TD and match::content_text::ends_with( "9" );
+	auto const rows = match::tag::TR and match::class_type::has( "row" );
+	auto const title = match::tag::TITLE;
+
+	daw::bench_n_test_mbs<25>(
+	  "count_if per query",
+	  html.size( ),
+	  [&]( auto const &r ) {
+		  auto const first = r.begin( );
+		  auto const last = r.end( );
+		  daw::do_not_optimize( std::count_if( first, last, names ) );
+		  daw::do_not_optimize( std::count_if( first, last, numbers ) );
+		  daw::do_not_optimize( std::count_if( first, last, links ) );
+		  daw::do_not_optimize( std::count_if( first, last, nines ) );
+		  daw::do_not_optimize( std::count_if( first, last, rows ) );
+		  daw::do_not_optimize( std::count_if( first, last, title ) );
+	  },
+	  rng );
+	daw::bench_n_test_mbs<25>(
+	  "match_many",
+	  html.size( ),
+	  [&]( auto const &r ) {
+		  daw::do_not_optimize( daw::gumbo::match_many(
+		    r, names, numbers, links, nines, rows, title ) );
+	  },
+	  rng );
+}
@@ -0,0 +1,85 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <thread>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	constexpr std::size_t max_retained = 1024U * 1024U;
+	auto ctx = daw::gumbo::parse_context( max_retained );
+	assert( ctx.max_retained_bytes( ) == max_retained );
+
+	// An outlier page grows the arena past the cap while it is alive, and the
+	// context shrinks back once it is destroyed
+	std::string const large = daw::gumbo::testing::generate_document( 20'000 );
+	{
+		auto rng = ctx.parse( large );
+		assert( std::count_if( rng.begin( ), rng.end( ), match::tag::TR ) ==
+		        20'000 );
+		assert( ctx.arena( ).capacity( ) > max_retained );
+	}
+	assert( ctx.arena( ).live_outputs( ) == 0 );
+	assert( ctx.arena( ).capacity( ) <= max_retained );
+
+	std::string const small = daw::gumbo::testing::generate_document( 10 );
+	{
+		auto rng = ctx.parse( small );
+		assert( std::count_if( rng.begin( ), rng.end( ), match::tag::TR ) == 10 );
+	}
+	auto const warm_capacity = ctx.arena( ).capacity( );
+	assert( warm_capacity <= max_retained );
+	{
+		// Warm, a page of the same size does not grow the arena
+		auto rng = ctx.parse( small );
+		assert( ctx.arena( ).capacity( ) == warm_capacity );
+	}
+	(void)warm_capacity;
+
+	// Lowering the cap shrinks an idle context immediately
+	ctx.set_max_retained_bytes( 0 );
+	assert( ctx.arena( ).capacity( ) == 0 );
+	ctx.set_max_retained_bytes( max_retained );
+
+	// reserve stays within the cap
+	ctx.reserve( small.size( ) );
+	assert( ctx.arena( ).capacity( ) > 0 );
+	assert( ctx.arena( ).capacity( ) <= max_retained );
+	ctx.reserve( large.size( ) );
+	assert( ctx.arena( ).capacity( ) <= max_retained );
+
+	// The scratch buffer keeps its capacity unless it grew past the cap
+	{
+		auto &scratch = ctx.scratch_buffer( );
+		scratch.assign( 1000U, 'x' );
+		assert( ctx.scratch_buffer( ).empty( ) );
+		assert( ctx.scratch_buffer( ).capacity( ) >= 1000U );
+		ctx.scratch_buffer( ).assign( 2U * max_retained, 'x' );
+		assert( ctx.scratch_buffer( ).empty( ) );
+		assert( ctx.scratch_buffer( ).capacity( ) <= max_retained );
+	}
+
+	// Each thread has its own context, reused between calls
+	auto *const main_ctx = &daw::gumbo::parse_context::this_thread( );
+	assert( main_ctx == &daw::gumbo::parse_context::this_thread( ) );
+	std::thread( [&] {
+		auto &other_ctx = daw::gumbo::parse_context::this_thread( );
+		assert( &other_ctx != main_ctx );
+		auto rng = other_ctx.parse( small );
+		assert( std::count_if( rng.begin( ), rng.end( ), match::tag::TD ) == 30 );
+	} ).join( );
+	(void)main_ctx;
+}
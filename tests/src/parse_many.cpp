@@ -0,0 +1,91 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+int main( ) {
+	namespace match = daw::gumbo::match;
+	// A list, so the documents cannot be indexed in constant time
+	auto docs = std::list<std::string>{ };
+	auto rows = std::vector<std::size_t>{ };
+	for( std::size_t n = 0; n < 24; ++n ) {
+		rows.push_back( n % 6 == 0 ? 2'000U : 5U + n );
+		docs.push_back( daw::gumbo::testing::generate_document( rows.back( ) ) );
+	}
+	auto const row_count = []( daw::gumbo::gumbo_range const &rng ) {
+		return static_cast<std::size_t>(
+		  std::count_if( rng.begin( ), rng.end( ), match::tag::TR ) );
+	};
+
+	for( std::size_t const thread_count : { 1U, 4U } ) {
+		auto executor = daw::gumbo::parse_executor( thread_count );
+		assert( executor.thread_count( ) == thread_count );
+
+		// The ranges are in the order of the documents
+		auto const ranges = daw::gumbo::parse_many( docs, executor );
+		assert( ranges.size( ) == docs.size( ) );
+		auto doc = docs.begin( );
+		for( std::size_t n = 0; n < ranges.size( ); ++n, ++doc ) {
+			assert( ranges[n].html( ).data( ) == doc->data( ) );
+			assert( row_count( ranges[n] ) == rows[n] );
+		}
+
+		// Each index is passed to the callback once
+		auto counts = std::vector<std::size_t>( docs.size( ) );
+		auto calls = std::atomic<std::size_t>{ 0 };
+		daw::gumbo::parse_many(
+		  docs,
+		  executor,
+		  [&]( std::size_t n, daw::gumbo::gumbo_range &rng ) {
+			  counts[n] = row_count( rng );
+			  ++calls;
+		  } );
+		assert( calls == docs.size( ) );
+		assert( counts == rows );
+
+		// The first exception is rethrown once the rest of the batch is done
+		calls = 0;
+		bool has_thrown = false;
+		try {
+			daw::gumbo::parse_many(
+			  docs,
+			  executor,
+			  [&]( std::size_t n, daw::gumbo::gumbo_range & ) {
+				  if( n == 3 ) {
+					  throw std::runtime_error( "3" );
+				  }
+				  if( n == 5 ) {
+					  throw std::logic_error( "5" );
+				  }
+				  ++calls;
+			  } );
+		} catch( std::runtime_error const &ex ) {
+			// Items are taken in order, so one thread reaches 3 first
+			has_thrown = thread_count > 1 or std::string( ex.what( ) ) == "3";
+		} catch( std::logic_error const & ) { has_thrown = thread_count > 1; }
+		assert( has_thrown );
+		assert( calls == docs.size( ) - 2U );
+
+		// The executor is usable after a batch threw
+		assert( daw::gumbo::parse_many( docs, executor ).size( ) == docs.size( ) );
+		(void)ranges;
+		(void)has_thrown;
+	}
+	(void)row_count;
+}
@@ -0,0 +1,73 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+int main( ) {
+	// Page sizes vary by 1000x like a real crawl
+	std::vector<std::string> docs{ };
+	std::size_t total_size = 0;
+	for( std::size_t n = 0; n < 64; ++n ) {
+		auto const rows = n % 8 == 0 ? std::size_t{ 10'000 } : 10U + n;
+		docs.push_back( daw::gumbo::testing::generate_document( rows ) );
+		total_size += docs.back( ).size( );
+	}
+	auto const views = std::vector<daw::string_view>( docs.begin( ), docs.end( ) );
+	namespace match = daw::gumbo::match;
+
+	for( std::size_t const thread_count : { 1U, 4U, 16U } ) {
+		auto executor = daw::gumbo::parse_executor( thread_count );
+		daw::bench_n_test_mbs<5>(
+		  "parse_many " + std::to_string( thread_count ) + " threads",
+		  total_size,
+		  [&]( auto const &documents ) {
+			  auto ranges = daw::gumbo::parse_many( documents, executor );
+			  daw::do_not_optimize( ranges );
+		  },
+		  views );
+
+		daw::bench_n_test_mbs<5>(
+		  "parse_many callback " + std::to_string( thread_count ) + " threads",
+		  total_size,
+		  [&]( auto const &documents ) {
+			  auto row_count = std::atomic<std::size_t>{ 0 };
+			  daw::gumbo::parse_many(
+			    documents,
+			    executor,
+			    [&]( std::size_t, daw::gumbo::gumbo_range &rng ) {
+				    row_count += static_cast<std::size_t>(
+				      std::count_if( rng.begin( ), rng.end( ), match::tag::TR ) );
+			    } );
+			  daw::do_not_optimize( row_count );
+		  },
+		  views );
+	}
+
+	auto executor = daw::gumbo::parse_executor( 4 );
+	auto ranges = daw::gumbo::parse_many( views, executor );
+	assert( ranges.size( ) == docs.size( ) );
+	for( std::size_t n = 0; n < ranges.size( ); ++n ) {
+		auto const rows =
+		  std::count_if( ranges[n].begin( ), ranges[n].end( ), match::tag::TR );
+		auto const expected = n % 8 == 0 ? std::size_t{ 10'000 } : 10U + n;
+		assert( static_cast<std::size_t>( rows ) == expected );
+		(void)rows;
+		(void)expected;
+	}
+}
@@ -0,0 +1,57 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+int main( ) {
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	auto rng = daw::gumbo::gumbo_range( html );
+
+	// Gumbo adds a tbody, so the rows are not children of the table
+	auto const cells =
+	  daw::gumbo::select( rng, "div#main > table.data tr:nth-child(n+2) td" );
+	assert( cells.size( ) == 999U * 3U );
+	assert( daw::gumbo::select( rng, "table.data > tr" ).empty( ) );
+	assert( daw::gumbo::select( rng, "tr:nth-child(odd) > td.name" ).size( ) ==
+	        500U );
+	assert( daw::gumbo::select( rng, "a[href$='7'][title*=more i]" ).size( ) ==
+	        100U );
+	assert( daw::gumbo::select( rng, "td:not(.name):last-child" ).size( ) ==
+	        1'000U );
+	assert( daw::gumbo::select( rng, "title, meta" ).size( ) == 2U );
+
+	auto const *first = daw::gumbo::select_first( rng, "td + td > a" );
+	assert( first != nullptr );
+	assert( daw::gumbo::node_attribute_value( *first, "href" ) == "/item/0" );
+
+	auto const sel = daw::gumbo::css_selector( "tr td:first-of-type" );
+	assert( static_cast<std::size_t>(
+	          std::count_if( rng.begin( ), rng.end( ), sel ) ) == 1'000U );
+	assert( daw::gumbo::cached_selector( "td" ) ==
+	        daw::gumbo::cached_selector( "td" ) );
+
+	bool threw = false;
+	try {
+		(void)daw::gumbo::css_selector( "div > :hover" );
+	} catch( daw::gumbo::css_selector_error const &e ) {
+		threw = e.position( ) == 7U;
+	}
+	assert( threw );
+	(void)cells;
+	(void)first;
+	(void)sel;
+	(void)threw;
+}
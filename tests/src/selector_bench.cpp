@@ -0,0 +1,30 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <string>
+
+int main( ) {
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	auto rng = daw::gumbo::gumbo_range( html );
+
+	daw::bench_n_test_mbs<25>(
+	  "select",
+	  html.size( ),
+	  [&]( auto const &r ) {
+		  daw::do_not_optimize( daw::gumbo::select(
+		    r, "div#main > table.data tr:nth-child(n+2) td" ) );
+	  },
+	  rng );
+}
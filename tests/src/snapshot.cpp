@@ -0,0 +1,70 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+int main( ) {
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+	namespace match = daw::gumbo::match;
+
+	auto rng = daw::gumbo::gumbo_range( html );
+	auto const flat = daw::gumbo::flat_document( rng );
+	std::string const snapshot = daw::gumbo::to_snapshot( flat );
+
+	auto const loaded = daw::gumbo::snapshot_document::from_bytes( snapshot );
+	assert( loaded.size( ) == flat.size( ) );
+	assert( loaded.html( ) == html );
+	assert( std::distance( loaded.begin( ), loaded.end( ) ) ==
+	        std::distance( rng.begin( ), rng.end( ) ) );
+
+	// The existing matchers work on the loaded tree
+	assert( std::count_if( loaded.begin( ), loaded.end( ), match::tag::TR ) ==
+	        1'000 );
+	auto main_div = std::find_if( loaded.begin( ),
+	                              loaded.end( ),
+	                              match::tag::DIV and match::id::is( "main" ) );
+	assert( main_div != loaded.end( ) );
+	assert( daw::gumbo::node_attribute_value( *main_div, "class" ) ==
+	        "content wide" );
+	auto first_td =
+	  std::find_if( loaded.begin( ), loaded.end( ), match::tag::TD );
+	assert( first_td != loaded.end( ) );
+	assert( daw::gumbo::node_content_text( *first_td ) == "Item 0" );
+	assert( daw::gumbo::node_outer_text( *first_td, loaded.html( ) ) ==
+	        R"(<td class="name">Item 0</td>)" );
+
+	bool threw = false;
+	try {
+		(void)daw::gumbo::snapshot_document::from_bytes(
+		  daw::string_view( snapshot ).substr( 0, snapshot.size( ) / 2U ) );
+	} catch( std::runtime_error const & ) {
+		threw = true;
+	}
+	assert( threw );
+
+	std::string const path = "snapshot_test.gppsnap";
+	daw::gumbo::save_snapshot( flat, path );
+	{
+		auto const mapped = daw::gumbo::snapshot_document::from_file( path );
+		assert( std::count_if( mapped.begin( ), mapped.end( ), match::tag::A ) ==
+		        1'000 );
+	}
+	std::remove( path.c_str( ) );
+	(void)threw;
+}
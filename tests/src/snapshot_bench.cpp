@@ -0,0 +1,42 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <string>
+
+int main( ) {
+	std::string const doc = daw::gumbo::testing::generate_document( 1'000 );
+	auto const html = daw::string_view( doc );
+
+	auto rng = daw::gumbo::gumbo_range( html );
+	auto const flat = daw::gumbo::flat_document( rng );
+	std::string const snapshot = daw::gumbo::to_snapshot( flat );
+
+	daw::bench_n_test_mbs<25>(
+	  "parse",
+	  html.size( ),
+	  []( daw::string_view h ) {
+		  auto r = daw::gumbo::gumbo_range( h );
+		  daw::do_not_optimize( r.root( ) );
+	  },
+	  html );
+
+	daw::bench_n_test_mbs<25>(
+	  "load snapshot",
+	  html.size( ),
+	  []( daw::string_view s ) {
+		  auto d = daw::gumbo::snapshot_document::from_bytes( s );
+		  daw::do_not_optimize( d.root( ) );
+	  },
+	  daw::string_view( snapshot ) );
+}
@@ -48,9 +48,18 @@ int main( ) {
 	                html.end( ),
 	                match::tag::DIV and match::id::is( "important_table" ) );
 	assert( parent_div != html.end( ) );
-	auto tbl =
-	  std::find_if( parent_div.begin( ), parent_div.end( ), match::tag::TBODY );
-	assert( tbl != html.end( ) );
+	auto const div_descendants = daw::gumbo::descendants( parent_div );
+	auto tbl = std::find_if( div_descendants.begin( ),
+	                         div_descendants.end( ),
+	                         match::tag::TBODY );
+	assert( tbl != div_descendants.end( ) );
+	// The search must stop at the end of the first row's subtree
+	auto const first_row = daw::gumbo::descendants(
+	  *std::find_if( tbl, div_descendants.end( ), match::tag::TR ) );
+	assert( std::count_if( first_row.begin( ),
+	                       first_row.end( ),
+	                       match::tag::TD ) == 2 );
+	(void)first_row;
 	for( daw::gumbo::gumbo_node_iterator_t tr_it :
 	     daw::find_iterator( tbl.children.begin( ),
 	                         tbl.children.end( ),
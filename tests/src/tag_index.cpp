@@ -0,0 +1,71 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+int main( ) {
+	std::string const doc = daw::gumbo::testing::generate_document( 5'000 );
+	auto const html = daw::string_view( doc );
+	namespace match = daw::gumbo::match;
+
+	auto rng = daw::gumbo::gumbo_range( html );
+	auto const idx = daw::gumbo::tag_index( rng );
+
+	auto const rows = idx.find( match::tag::TR );
+	assert( std::distance( rows.begin( ), rows.end( ) ) == 5'000 );
+	assert( idx.count( match::tag::TR ) == 5'000 );
+	assert( idx.count( match::tag::TD ) == 15'000 );
+
+	// Multiple tags are merged in document order
+	auto const expected = [&] {
+		auto result = std::vector<GumboNode const *>( );
+		for( auto it = rng.begin( ); it != rng.end( ); ++it ) {
+			if( match::tag::types<GUMBO_TAG_TITLE, GUMBO_TAG_A>( *it ) ) {
+				result.push_back( it.get( ) );
+			}
+		}
+		return result;
+	}( );
+	auto const merged =
+	  idx.find( match::tag::types<GUMBO_TAG_A, GUMBO_TAG_TITLE> );
+	assert( std::distance( merged.begin( ), merged.end( ) ) ==
+	        static_cast<std::ptrdiff_t>( expected.size( ) ) );
+	assert( std::equal( merged.begin( ),
+	                    merged.end( ),
+	                    expected.begin( ),
+	                    []( GumboNode const &lhs, GumboNode const *rhs ) {
+		                    return &lhs == rhs;
+	                    } ) );
+	assert( merged.begin( )->v.element.tag == GUMBO_TAG_TITLE );
+
+	auto const classes = daw::gumbo::class_index( rng );
+	assert( classes.count( "row" ) == 5'000 );
+	// class="content wide" is in both token lists
+	auto const main_div = classes.find( "content", "wide" );
+	assert( std::distance( main_div.begin( ), main_div.end( ) ) == 1 );
+	assert( std::find_if( rng.begin( ),
+	                      rng.end( ),
+	                      match::class_type::has( "wide" ) ) ==
+	        main_div.begin( ).node( ) );
+	assert( std::find_if( rng.begin( ),
+	                      rng.end( ),
+	                      match::class_type::is( "wide" ) ) == rng.end( ) );
+	(void)rows;
+	(void)merged;
+	(void)main_div;
+}
@@ -0,0 +1,63 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+
+#include "generate_document.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_string_view.h>
+#include <daw/gumbo_pp.h>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+int main( ) {
+	std::string const doc = daw::gumbo::testing::generate_document( 5'000 );
+	auto const html = daw::string_view( doc );
+	namespace match = daw::gumbo::match;
+
+	auto rng = daw::gumbo::gumbo_range( html );
+	auto const idx = daw::gumbo::tag_index( rng );
+	auto const classes = daw::gumbo::class_index( rng );
+
+	daw::bench_n_test_mbs<25>(
+	  "scan for TR",
+	  html.size( ),
+	  []( daw::gumbo::gumbo_range const &r ) {
+		  daw::do_not_optimize(
+		    std::count_if( r.begin( ), r.end( ), match::tag::TR ) );
+	  },
+	  rng );
+
+	daw::bench_n_test_mbs<25>(
+	  "tag_index for TR",
+	  html.size( ),
+	  []( daw::gumbo::tag_index const &i ) {
+		  auto const r = i.find( match::tag::TR );
+		  daw::do_not_optimize( std::distance( r.begin( ), r.end( ) ) );
+	  },
+	  idx );
+
+	daw::bench_n_test_mbs<25>(
+	  "scan for .row",
+	  html.size( ),
+	  []( daw::gumbo::gumbo_range const &r ) {
+		  daw::do_not_optimize( std::count_if(
+		    r.begin( ), r.end( ), match::class_type::has( "row" ) ) );
+	  },
+	  rng );
+
+	daw::bench_n_test_mbs<25>(
+	  "class_index for .row",
+	  html.size( ),
+	  []( daw::gumbo::class_index const &c ) {
+		  auto const r = c.find( "row" );
+		  daw::do_not_optimize( std::distance( r.begin( ), r.end( ) ) );
+	  },
+	  classes );
+}
@@ -11,6 +11,8 @@
 
 #include <cassert>
 #include <iostream>
+#include <iterator>
+#include <string>
 
 int main( ) {
 	constexpr std::string_view html =
@@ -23,11 +25,78 @@ int main( ) {
 </html>)html";
 
 	auto doc_range = daw::gumbo::gumbo_range( html );
+	assert( doc_range.html( ).data( ) == html.data( ) );
 
 	std::cout << "****************\n";
 	std::cout << daw::gumbo::node_content_text( *doc_range.document( ) ) << '\n';
 	std::cout << "****************\n";
 
+	std::string const doc_text =
+	  daw::gumbo::node_content_text( *doc_range.document( ) );
+	std::string appended = "> ";
+	daw::gumbo::node_content_text( *doc_range.document( ), appended );
+	assert( appended == "> " + doc_text );
+	std::string copied{ };
+	daw::gumbo::node_content_text( *doc_range.document( ),
+	                               std::back_inserter( copied ) );
+	assert( copied == doc_text );
+	// A sink returning bool stops the walk when it returns false
+	std::size_t pieces = 0;
+	daw::gumbo::for_each_content_text( *doc_range.document( ),
+	                                   [&]( daw::string_view ) {
+		                                   ++pieces;
+		                                   return pieces < 2U;
+	                                   } );
+	assert( pieces == 2U );
+	assert( daw::gumbo::has_content_text( *doc_range.document( ) ) );
+
+	auto const text_idx = daw::gumbo::content_text_index( doc_range );
+	assert( text_idx.text( *doc_range.document( ) ) == doc_text );
+	auto const folks = std::find_if(
+	  doc_range.begin( ),
+	  doc_range.end( ),
+	  daw::gumbo::match::tag::B and
+	    daw::gumbo::match::content_text::contains( text_idx, "folks" ) );
+	assert( folks != doc_range.end( ) );
+	assert( text_idx.text( *folks ) == "Hey folks!" );
+
+	// The tag check runs before the content text is built, whatever the order
+	static_assert( decltype( daw::gumbo::match::content_text::contains( "" ) and
+	                         daw::gumbo::match::tag::B )::cost ==
+	               daw::gumbo::matcher_cost::text );
+	auto const is_b_tag = daw::gumbo::match::tag::where( []( GumboTag tag ) {
+		return tag == GUMBO_TAG_B;
+	} );
+	static_assert( daw::gumbo::matcher_cost_v<decltype( is_b_tag )> ==
+	               daw::gumbo::matcher_cost::tag );
+	assert( std::find_if( doc_range.begin( ), doc_range.end( ), is_b_tag ) ==
+	        folks );
+	std::size_t text_calls = 0;
+	auto const counted_text =
+	  daw::gumbo::with_cost<daw::gumbo::matcher_cost::text>(
+	    [&]( GumboNode const &node ) {
+		    ++text_calls;
+		    return daw::gumbo::node_content_text( node ) == "Hey folks!";
+	    } );
+	assert( std::find_if( doc_range.begin( ),
+	                      doc_range.end( ),
+	                      counted_text and daw::gumbo::match::tag::B ) == folks );
+	assert( text_calls == 1 );
+
+	auto const body = std::find_if(
+	  doc_range.begin( ), doc_range.end( ), daw::gumbo::match::tag::BODY );
+	assert( body != doc_range.end( ) );
+	assert( daw::gumbo::node_rendered_text( *body ) == "Hey folks!\nGoogle" );
+
+	auto const spans = daw::gumbo::source_span_map( doc_range );
+	assert( spans.outer_text( *doc_range.document( ) ) == doc_range.html( ) );
+	assert( spans.outer_text( *folks ) == "<b>Hey folks!</b>" );
+	assert( spans.inner_text( *folks ) == "Hey folks!" );
+	GumboNode const &folks_text = *daw::gumbo::get_child_node_at( *folks, 0 );
+	auto const text_span = daw::gumbo::node_source_span( folks_text );
+	assert( html.substr( text_span.first, text_span.size( ) ) == "Hey folks!" );
+	assert( spans.outer_span( folks_text ).last == text_span.last );
+
 	namespace match = daw::gumbo::match;
 	daw::algorithm::for_each_if(
 	  doc_range.begin( ),
@@ -42,6 +111,8 @@ int main( ) {
 		  std::cout << "node inner text:\n";
 		  std::cout << "****************\n";
 		  std::cout << daw::gumbo::node_inner_text( node, html ) << '\n';
+		  assert( daw::gumbo::node_inner_text( node, doc_range ) ==
+		          daw::gumbo::node_inner_text( node, html ) );
 		  std::cout << "****************\n";
 	  } );
 
@@ -101,4 +172,50 @@ int main( ) {
 	assert( std::find( some.results.begin( ), some.results.end( ), false ) ==
 	        some.results.end( ) );
 	std::cout << "****************\n";
+
+	auto const html2_ids =
+	  daw::gumbo::id_index( html2_rng.begin( ), html2_rng.end( ) );
+	assert( html2_ids.find( "example" ) == html2_example_pos.get( ) );
+	assert( not html2_ids.contains( "missing" ) );
+	assert( std::find_if( html2_rng.begin( ),
+	                      html2_rng.end( ),
+	                      match::id::is( html2_ids, "example" ) ) ==
+	        html2_example_pos );
+	{
+		// A repeated id finds the first element, and the matcher matches all
+		auto const dup_rng = daw::gumbo::gumbo_range(
+		  "<p id=a>1</p><b id=b>2</b><i id=a>3</i><u id=c>4</u>" );
+		auto const dup_ids = daw::gumbo::id_index( dup_rng );
+		assert( dup_ids.size( ) == 3U );
+		assert( dup_ids.find_all( "a" ).size( ) == 2U );
+		assert( dup_ids.find_all( "missing" ).empty( ) );
+		assert( dup_ids.find( "a" )->v.element.tag == GUMBO_TAG_P );
+		static_assert( daw::gumbo::matcher_cost_v<decltype(
+		                 match::id::is( dup_ids, "a" ) )> ==
+		               daw::gumbo::matcher_cost::tag );
+		assert( std::count_if( dup_rng.begin( ),
+		                       dup_rng.end( ),
+		                       match::id::is( dup_ids, "a", "c" ) ) == 3 );
+	}
+
+	auto head_rng = daw::gumbo::gumbo_range::head_only( html );
+	assert( std::find_if( head_rng.begin( ),
+	                      head_rng.end( ),
+	                      match::tag::TITLE ) != head_rng.end( ) );
+	assert( std::find_if( head_rng.begin( ), head_rng.end( ), match::tag::DIV ) ==
+	        head_rng.end( ) );
+
+	// TEMPLATE nodes have the source positions of an element
+	constexpr std::string_view template_html =
+	  "<body><template><p>x</p></template></body>";
+	auto template_rng = daw::gumbo::gumbo_range( template_html );
+	auto const template_pos = std::find_if(
+	  template_rng.begin( ), template_rng.end( ), []( GumboNode const &node ) {
+		  return node.type == GUMBO_NODE_TEMPLATE;
+	  } );
+	assert( template_pos != template_rng.end( ) );
+	assert( daw::gumbo::node_outer_text( *template_pos, template_rng ) ==
+	        "<template><p>x</p></template>" );
+	assert( daw::gumbo::node_inner_text( *template_pos, template_rng ) ==
+	        "<p>x</p>" );
 }
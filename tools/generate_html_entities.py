@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+# Copyright (c) Darrell Wright
+#
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+# Official repository: https://github.com/beached/gumbo_pp
+#
+# Generate src/gumbo_html_entities.cpp, the named character references and a
+# perfect hash of their names, from entities.json.  That is the table of the
+# WHATWG HTML standard, https://html.spec.whatwg.org/entities.json
+#
+# Usage: generate_html_entities.py [entities.json] [output.cpp]
+
+import json
+import os
+import sys
+
+tools_dir = os.path.dirname(os.path.abspath(__file__))
+input_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+    tools_dir, 'entities.json')
+output_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(
+    tools_dir, '..', 'src', 'gumbo_html_entities.cpp')
+
+with open(input_path, encoding='utf-8') as f:
+    # Keys are like "&amp;", and "&amp" for the legacy names that may be used
+    # without the semicolon
+    h = {k[1:]: v['characters'] for k, v in json.load(f).items()}
+names = sorted(k[:-1] for k in h if k.endswith(';'))
+legacy = set(k for k in h if not k.endswith(';'))
+n = len(names)
+
+def fnv(s, seed):
+    x = (0x811C9DC5 ^ seed) & 0xFFFFFFFF
+    for c in s.encode():
+        x ^= c
+        x = (x * 0x01000193) & 0xFFFFFFFF
+    return x
+
+N = 4096
+B = 1024
+buckets = [[] for _ in range(B)]
+for i, nm in enumerate(names):
+    buckets[fnv(nm, 0) % B].append(i)
+order = sorted(range(B), key=lambda b: -len(buckets[b]))
+slots = [None] * N
+disp = [0] * B
+for b in order:
+    items = buckets[b]
+    if not items:
+        continue
+    d = 1
+    while True:
+        pos = [fnv(names[i], d) % N for i in items]
+        if len(set(pos)) == len(pos) and all(slots[p] is None for p in pos):
+            break
+        d += 1
+    disp[b] = d
+    for i, p in zip(items, pos):
+        slots[p] = i
+assert max(disp) < 65536
+
+pool = ''
+offs = []
+for nm in names:
+    offs.append(len(pool))
+    pool += nm
+assert len(pool) < 65536
+
+def cstr(b):
+    return ''.join('\\x%02x' % c for c in b)
+
+out = []
+w = out.append
+w('''// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/gumbo_pp
+//
+// The named character references of the WHATWG HTML standard and a perfect
+// hash of their names.  The hash is checked when this file is compiled.
+// Generated by tools/generate_html_entities.py from tools/entities.json, do
+// not edit by hand
+
+#include <daw/gumbo_pp/details/html_entities.h>
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace daw::gumbo::entity_details {
+	namespace {
+''')
+w('\t\tconstexpr char entity_names[] =')
+chunks = [pool[i:i+64] for i in range(0, len(pool), 64)]
+for c in chunks:
+    w('\n\t\t  "%s"' % c)
+w(';\n\n')
+w('\t\tconstexpr html_entity entities[] = {\n')
+for i, nm in enumerate(names):
+    v = h[nm + ';'].encode()
+    w('\t\t  { %d, %d, %d, %s, "%s" },\n' % (offs[i], len(nm), len(v), 'true' if nm in legacy else 'false', cstr(v)))
+w('\t\t};\n\n')
+w('\t\tconstexpr std::size_t entity_count = %d;\n' % n)
+w('\t\tconstexpr std::size_t bucket_count = %d;\n' % B)
+w('\t\tconstexpr std::size_t slot_count = %d;\n' % N)
+w('\t\tconstexpr std::uint16_t no_entity = 0xFFFF;\n\n')
+def table(name, typ, vals, per=None):
+    w('\t\tconstexpr %s %s[] = {' % (typ, name))
+    line = ''
+    for x in vals:
+        item = str(x) + ','
+        if line and 10 + len(line) + 1 + len(item) > 80:
+            w('\n\t\t  ' + line)
+            line = ''
+        line = item if not line else line + ' ' + item
+    if line:
+        w('\n\t\t  ' + line)
+    w(' };\n\n')
+table('displacements', 'std::uint16_t', disp)
+table('slots', 'std::uint16_t', ['no_entity' if s is None else s for s in slots], 8)
+w('''		static_assert( sizeof( entities ) / sizeof( entities[0] ) == entity_count );
+
+		[[nodiscard]] constexpr std::uint32_t hash( daw::string_view name,
+		                                            std::uint32_t seed ) noexcept {
+			std::uint32_t result = 0x811C'9DC5U ^ seed;
+			for( char c : name ) {
+				result ^= static_cast<unsigned char>( c );
+				result *= 0x0100'0193U;
+			}
+			return result;
+		}
+
+		[[nodiscard]] constexpr daw::string_view
+		entity_name( html_entity const &entity ) noexcept {
+			return daw::string_view( entity_names + entity.name_offset,
+			                         entity.name_size );
+		}
+
+		[[nodiscard]] constexpr std::size_t
+		slot_of( daw::string_view name ) noexcept {
+			auto const bucket = hash( name, 0 ) % bucket_count;
+			return hash( name, displacements[bucket] ) % slot_count;
+		}
+
+		[[nodiscard]] constexpr bool is_perfect_hash( ) noexcept {
+			for( std::size_t n = 0; n < entity_count; ++n ) {
+				if( slots[slot_of( entity_name( entities[n] ) )] != n ) {
+					return false;
+				}
+			}
+			return true;
+		}
+		static_assert( is_perfect_hash( ),
+		               "Every entity must hash to its own slot" );
+	} // namespace
+
+	html_entity const *find_html_entity( daw::string_view name ) noexcept {
+		if( name.empty( ) or name.size( ) > max_entity_name_size ) {
+			return nullptr;
+		}
+		auto const idx = slots[slot_of( name )];
+		if( idx == no_entity ) {
+			return nullptr;
+		}
+		html_entity const &entity = entities[idx];
+		if( entity_name( entity ) != name ) {
+			return nullptr;
+		}
+		return &entity;
+	}
+} // namespace daw::gumbo::entity_details
+''')
+with open(output_path, 'w', encoding='utf-8', newline='\n') as f:
+    f.write(''.join(out))